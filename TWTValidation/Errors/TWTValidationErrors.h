@@ -81,6 +81,30 @@ extern NSString *const TWTValidationValueValidationErrorsKey;
  */
 extern NSString *const TWTValidationKeyValuePairValidationErrorsKey;
 
+/*!
+ @abstract userInfo key whose value is an RFC 6901 JSON pointer to the value that failed validation.
+ @discussion The pointer is relative to the value passed to the outermost validator, so the empty string refers to
+     that value itself. Paths are only recorded when validating with a TWTValidationContext; see
+     TWTValidationContext.h for more information.
+ */
+extern NSString *const TWTValidationInstancePathKey;
+
+/*!
+ @abstract userInfo key whose value is an RFC 6901 JSON pointer to the schema keyword that failed validation.
+ @discussion The pointer is relative to the schema of the outermost validator and includes the keywords that
+     apply schemas to properties and items, e.g., "/properties/name" or "/items/2". Keywords that combine schemas
+     for the same value, like allOf and anyOf, are not included.
+ */
+extern NSString *const TWTValidationSchemaPathKey;
+
+/*!
+ @abstract userInfo key whose value is an NSNumber indicating whether the error is missing underlying errors.
+ @discussion Validators stop collecting errors from their subvalidators once their validation context’s maximum
+     error count is reached. If this key’s value is YES, some failures that occurred while validating the value
+     are not described by the error or its underlying errors. See TWTValidationContext.h for more information.
+ */
+extern NSString *const TWTValidationErrorsTruncatedKey;
+
 /*!
  @abstract The error domain for errors originating from TWTValidation’s JSON schema parser.
  */
@@ -160,7 +184,13 @@ typedef NS_ENUM(NSInteger, TWTValidationErrorCode) {
     TWTValidationErrorCodeRequiredPropertyMissing,
 
     /*! Indicates a JSON object or array contains additional elements that are not allowed. */
-    TWTValidationErrorCodeAdditionalElementsNotAllowed
+    TWTValidationErrorCodeAdditionalElementsNotAllowed,
+
+    /*! Indicates a JSON document being validated as it is read is not well-formed. */
+    TWTValidationErrorCodeMalformedJSON,
+
+    /*! Indicates validation stopped because its validation context’s deadline passed. */
+    TWTValidationErrorCodeDeadlineExceeded
 };
 
 
@@ -270,6 +300,57 @@ typedef NS_ENUM(NSUInteger, TWTJSONSchemaParserErrorCode) {
                     localizedDescription:(NSString *)description
                         underlyingErrors:(NSArray *)errors;
 
+/*!
+ @abstract Creates and returns a new error in the TWTValidationErrorDomain domain with the specified code,
+     failing validator, validated value, and lazily created localized description.
+ @discussion This is equivalent to invoking
+
+     [NSError twt_validationErrorWithCode:code
+                         failingValidator:validator
+                                    value:value
+                localizedDescriptionBlock:descriptionBlock
+                         underlyingErrors:nil];
+
+ @param code The error code for the new error.
+ @param validator The validator that failed.
+ @param value The value being validated when the error occured. If non-nil, this object will be the value
+     corresponding to TWTValidationValidatedValueKey in the error’s userInfo dictionary.
+ @param descriptionBlock A block that returns a human-readable description of the error. It is invoked at most
+     once, the first time the error’s localized description or userInfo dictionary is accessed.
+ @result A new validation error with the specified code, validated value, and lazily created localized description.
+ */
++ (NSError *)twt_validationErrorWithCode:(NSInteger)code
+                        failingValidator:(TWTValidator *)validator
+                                   value:(id)value
+               localizedDescriptionBlock:(NSString *(^)(void))descriptionBlock;
+
+/*!
+ @abstract Creates and returns a new error in the TWTValidationErrorDomain domain with the specified code,
+     failing validator, validated value, lazily created localized description, and underlying errors.
+ @discussion Formatting an error’s description usually costs more than the validation that failed, and most
+     validation errors are never shown to anyone. Errors created with this method store the description block
+     instead, and only invoke it and build their userInfo dictionaries when someone asks for them. Validators
+     should prefer this method to +twt_validationErrorWithCode:failingValidator:value:localizedDescription:underlyingErrors:
+     whenever their descriptions require formatting or localization.
+ @param code The error code for the new error.
+ @param validator The validator that failed.
+ @param value The value being validated when the error occured. If non-nil, this object will be the value
+     corresponding to TWTValidationValidatedValueKey in the error’s userInfo dictionary.
+ @param descriptionBlock A block that returns a human-readable description of the error. It is invoked at most
+     once, the first time the error’s localized description or userInfo dictionary is accessed. If the block
+     returns a non-nil string, that string will be the value corresponding to NSLocalizedDescriptionKey in the
+     error’s userInfo dictionary.
+ @param errors The underyling errors that caused the new error to occur. If non-nil, this array will be
+     the value corresponding to TWTValidationUnderlyingErrorsKey in the error’s userInfo dictionary.
+ @result A new validation error with the specified code, validated value, lazily created localized description,
+     and underlying errors.
+ */
++ (NSError *)twt_validationErrorWithCode:(NSInteger)code
+                        failingValidator:(TWTValidator *)validator
+                                   value:(id)value
+               localizedDescriptionBlock:(NSString *(^)(void))descriptionBlock
+                        underlyingErrors:(NSArray *)errors;
+
 /*!
  @abstract Returns an error’s failing validator.
  @discussion This is equivalent to accessing error.userInfo[TWTValidationFailingValidatorKey].
@@ -333,4 +414,43 @@ typedef NS_ENUM(NSUInteger, TWTJSONSchemaParserErrorCode) {
  */
 - (NSArray *)twt_keyValuePairValidationErrors;
 
+/*!
+ @abstract Returns the JSON pointer to the value that failed validation.
+ @discussion This is equivalent to accessing error.userInfo[TWTValidationInstancePathKey].
+ @result The error’s instance path.
+ */
+- (NSString *)twt_instancePath;
+
+/*!
+ @abstract Returns the JSON pointer to the schema keyword that failed validation.
+ @discussion This is equivalent to accessing error.userInfo[TWTValidationSchemaPathKey].
+ @result The error’s schema path.
+ */
+- (NSString *)twt_schemaPath;
+
+/*!
+ @abstract Returns a copy of the error with the specified instance and schema paths.
+ @discussion Underlying errors without instance paths are assumed to have occurred at the same location and are
+     given the same paths. Errors that already have an instance path are not modified, so validators can add
+     paths to every error they receive from their subvalidators as it passes through them.
+ @param instancePath The JSON pointer to the value that failed validation. May not be nil.
+ @param schemaPath The JSON pointer to the schema keyword that failed validation. May not be nil.
+ @result A copy of the error with the specified paths, or the error itself if it already has an instance path.
+ */
+- (NSError *)twt_errorByAddingInstancePath:(NSString *)instancePath schemaPath:(NSString *)schemaPath;
+
+/*!
+ @abstract Returns whether the error is missing underlying errors because error collection was truncated.
+ @discussion This is equivalent to accessing [error.userInfo[TWTValidationErrorsTruncatedKey] boolValue].
+ @result Whether error collection was truncated.
+ */
+- (BOOL)twt_isTruncated;
+
+/*!
+ @abstract Returns a copy of the error that indicates that error collection was truncated.
+ @result A copy of the error whose TWTValidationErrorsTruncatedKey is YES, or the error itself if it already
+     indicates that error collection was truncated.
+ */
+- (NSError *)twt_errorByMarkingTruncated;
+
 @end
@@ -43,10 +43,251 @@ NSString *const TWTValidationKeyValidationErrorsKey = @"TWTValidationKeyValidati
 NSString *const TWTValidationValueValidationErrorsKey = @"TWTValidationValueValidationErrors";
 NSString *const TWTValidationKeyValuePairValidationErrorsKey = @"TWTValidationKeyValuePairValidationErrors";
 
+NSString *const TWTValidationInstancePathKey = @"TWTValidationInstancePath";
+NSString *const TWTValidationSchemaPathKey = @"TWTValidationSchemaPath";
+NSString *const TWTValidationErrorsTruncatedKey = @"TWTValidationErrorsTruncated";
+
 NSString *const TWTJSONSchemaParserErrorDomain = @"TWTJSONSchemaParserErrorDomain";
 NSString *const TWTJSONSchemaParserInvalidObjectKey = @"TWTJSONSchemaParserInvalidObject";
 
 
+#pragma mark Functions
+
+/*!
+ @abstract Returns the specified errors with the specified paths added to those that don’t have instance paths.
+ @result The errors with paths added. If no error needed paths, this is the errors array itself.
+ */
+static NSArray *TWTValidationErrorsByAddingPaths(NSArray *errors, NSString *instancePath, NSString *schemaPath)
+{
+    NSMutableArray *errorsWithPaths = nil;
+    NSUInteger index = 0;
+    for (NSError *error in errors) {
+        NSError *errorWithPaths = [error twt_errorByAddingInstancePath:instancePath schemaPath:schemaPath];
+        if (errorWithPaths != error && !errorsWithPaths) {
+            errorsWithPaths = [errors mutableCopy];
+        }
+
+        errorsWithPaths[index] = errorWithPaths;
+        ++index;
+    }
+
+    return errorsWithPaths ? [errorsWithPaths copy] : errors;
+}
+
+
+#pragma mark
+
+/*!
+ TWTValidationErrors are the errors created by the NSError (TWTValidation) factory methods. Rather than building a
+ userInfo dictionary up front, they store their failing validator, validated value, and underlying errors directly,
+ and only build the dictionary (and format their localized description) the first time it is requested. Most
+ validation errors are discarded without ever being inspected, so this keeps failing validation about as cheap as
+ passing validation.
+ */
+@interface TWTValidationError : NSError
+
+- (instancetype)initWithCode:(NSInteger)code
+            failingValidator:(TWTValidator *)validator
+                       value:(id)value
+        localizedDescription:(NSString *)description
+   localizedDescriptionBlock:(NSString *(^)(void))descriptionBlock
+            underlyingErrors:(NSArray *)errors;
+
+@end
+
+
+@implementation TWTValidationError {
+    TWTValidator *_failingValidator;
+    id _validatedValue;
+    NSArray *_underlyingErrors;
+    NSString *_localizedDescription;
+    NSString *(^_localizedDescriptionBlock)(void);
+    NSDictionary *_additionalUserInfo;
+    NSDictionary *_lazyUserInfo;
+}
+
+- (instancetype)initWithCode:(NSInteger)code
+            failingValidator:(TWTValidator *)validator
+                       value:(id)value
+        localizedDescription:(NSString *)description
+   localizedDescriptionBlock:(NSString *(^)(void))descriptionBlock
+            underlyingErrors:(NSArray *)errors
+{
+    self = [super initWithDomain:TWTValidationErrorDomain code:code userInfo:nil];
+    if (self) {
+        _failingValidator = validator;
+        _validatedValue = value;
+        _underlyingErrors = errors.count ? [errors copy] : nil;
+        _localizedDescription = description;
+        _localizedDescriptionBlock = [descriptionBlock copy];
+    }
+
+    return self;
+}
+
+
+- (NSDictionary *)userInfo
+{
+    @synchronized(self) {
+        if (!_lazyUserInfo) {
+            if (_localizedDescriptionBlock) {
+                _localizedDescription = [_localizedDescriptionBlock() copy];
+                _localizedDescriptionBlock = nil;
+            }
+
+            NSMutableDictionary *userInfo = [[NSMutableDictionary alloc] initWithCapacity:4 + _additionalUserInfo.count];
+            if (_failingValidator) {
+                userInfo[TWTValidationFailingValidatorKey] = _failingValidator;
+            }
+
+            if (_validatedValue) {
+                userInfo[TWTValidationValidatedValueKey] = _validatedValue;
+            }
+
+            if (_localizedDescription) {
+                userInfo[NSLocalizedDescriptionKey] = _localizedDescription;
+            }
+
+            if (_underlyingErrors) {
+                userInfo[TWTValidationUnderlyingErrorsKey] = _underlyingErrors;
+            }
+
+            if (_additionalUserInfo) {
+                [userInfo addEntriesFromDictionary:_additionalUserInfo];
+            }
+
+            _lazyUserInfo = [userInfo copy];
+        }
+
+        return _lazyUserInfo;
+    }
+}
+
+
+- (NSUInteger)hash
+{
+    return self.domain.hash ^ self.code;
+}
+
+
+- (BOOL)isEqual:(id)object
+{
+    if (self == object) {
+        return YES;
+    } else if (![object isKindOfClass:[NSError class]]) {
+        return NO;
+    }
+
+    // Compare the userInfo dictionaries through their accessors, since ours isn’t stored where NSError expects it
+    NSError *other = object;
+    return other.code == self.code && [other.domain isEqualToString:self.domain] && [other.userInfo isEqualToDictionary:self.userInfo];
+}
+
+
+- (NSString *)localizedDescription
+{
+    return self.userInfo[NSLocalizedDescriptionKey] ?: [super localizedDescription];
+}
+
+
+- (id)replacementObjectForCoder:(NSCoder *)coder
+{
+    // Archive a plain error so that unarchiving doesn’t depend on this private class
+    return [NSError errorWithDomain:self.domain code:self.code userInfo:self.userInfo];
+}
+
+
+- (TWTValidator *)twt_failingValidator
+{
+    return _failingValidator;
+}
+
+
+- (id)twt_validatedValue
+{
+    return _validatedValue;
+}
+
+
+- (NSArray *)twt_underlyingErrors
+{
+    return _underlyingErrors;
+}
+
+
+- (NSString *)twt_instancePath
+{
+    return _additionalUserInfo[TWTValidationInstancePathKey];
+}
+
+
+- (NSString *)twt_schemaPath
+{
+    return _additionalUserInfo[TWTValidationSchemaPathKey];
+}
+
+
+- (BOOL)twt_isTruncated
+{
+    return [_additionalUserInfo[TWTValidationErrorsTruncatedKey] boolValue];
+}
+
+
+- (NSError *)twt_errorByAddingInstancePath:(NSString *)instancePath schemaPath:(NSString *)schemaPath
+{
+    NSParameterAssert(instancePath);
+    NSParameterAssert(schemaPath);
+
+    if (self.twt_instancePath) {
+        return self;
+    }
+
+    return [self errorByAddingUserInfo:@{ TWTValidationInstancePathKey : [instancePath copy], TWTValidationSchemaPathKey : [schemaPath copy] }
+                      underlyingErrors:TWTValidationErrorsByAddingPaths(_underlyingErrors, instancePath, schemaPath)];
+}
+
+
+- (NSError *)twt_errorByMarkingTruncated
+{
+    if (self.twt_isTruncated) {
+        return self;
+    }
+
+    return [self errorByAddingUserInfo:@{ TWTValidationErrorsTruncatedKey : @YES } underlyingErrors:_underlyingErrors];
+}
+
+
+/*!
+ @abstract Returns a copy of the receiver with the specified userInfo entries and underlying errors.
+ @discussion The copy is made from the receiver’s stored values rather than its userInfo dictionary so that the
+     copy’s description is still formatted lazily.
+ */
+- (NSError *)errorByAddingUserInfo:(NSDictionary *)entries underlyingErrors:(NSArray *)underlyingErrors
+{
+    TWTValidationError *error = nil;
+    @synchronized(self) {
+        error = [[TWTValidationError alloc] initWithCode:self.code
+                                        failingValidator:_failingValidator
+                                                   value:_validatedValue
+                                    localizedDescription:_localizedDescription
+                               localizedDescriptionBlock:_localizedDescriptionBlock
+                                        underlyingErrors:underlyingErrors];
+    }
+
+    if (_additionalUserInfo) {
+        NSMutableDictionary *additionalUserInfo = [_additionalUserInfo mutableCopy];
+        [additionalUserInfo addEntriesFromDictionary:entries];
+        error->_additionalUserInfo = [additionalUserInfo copy];
+    } else {
+        error->_additionalUserInfo = entries;
+    }
+
+    return error;
+}
+
+@end
+
+
 #pragma mark
 
 @implementation NSError (TWTValidation)
@@ -78,24 +319,36 @@ NSString *const TWTJSONSchemaParserInvalidObjectKey = @"TWTJSONSchemaParserInval
                     localizedDescription:(NSString *)description
                         underlyingErrors:(NSArray *)errors
 {
-    NSMutableDictionary *userInfo = [[NSMutableDictionary alloc] initWithCapacity:4];
-    if (validator) {
-        userInfo[TWTValidationFailingValidatorKey] = validator;
-    }
+    return [[TWTValidationError alloc] initWithCode:code
+                                   failingValidator:validator
+                                              value:value
+                               localizedDescription:[description copy]
+                          localizedDescriptionBlock:nil
+                                   underlyingErrors:errors];
+}
 
-    if (value) {
-        userInfo[TWTValidationValidatedValueKey] = value;
-    }
-    
-    if (description) {
-        userInfo[NSLocalizedDescriptionKey] = [description copy];
-    }
-    
-    if (errors.count) {
-        userInfo[TWTValidationUnderlyingErrorsKey] = [errors copy];
-    }
-    
-    return [NSError errorWithDomain:TWTValidationErrorDomain code:code userInfo:userInfo];
+
++ (NSError *)twt_validationErrorWithCode:(NSInteger)code
+                        failingValidator:(TWTValidator *)validator
+                                   value:(id)value
+               localizedDescriptionBlock:(NSString *(^)(void))descriptionBlock
+{
+    return [self twt_validationErrorWithCode:code failingValidator:validator value:value localizedDescriptionBlock:descriptionBlock underlyingErrors:nil];
+}
+
+
++ (NSError *)twt_validationErrorWithCode:(NSInteger)code
+                        failingValidator:(TWTValidator *)validator
+                                   value:(id)value
+               localizedDescriptionBlock:(NSString *(^)(void))descriptionBlock
+                        underlyingErrors:(NSArray *)errors
+{
+    return [[TWTValidationError alloc] initWithCode:code
+                                   failingValidator:validator
+                                              value:value
+                               localizedDescription:nil
+                          localizedDescriptionBlock:descriptionBlock
+                                   underlyingErrors:errors];
 }
 
 
@@ -152,4 +405,56 @@ NSString *const TWTJSONSchemaParserInvalidObjectKey = @"TWTJSONSchemaParserInval
     return self.userInfo[TWTValidationKeyValuePairValidationErrorsKey];
 }
 
+
+- (NSString *)twt_instancePath
+{
+    return self.userInfo[TWTValidationInstancePathKey];
+}
+
+
+- (NSString *)twt_schemaPath
+{
+    return self.userInfo[TWTValidationSchemaPathKey];
+}
+
+
+- (NSError *)twt_errorByAddingInstancePath:(NSString *)instancePath schemaPath:(NSString *)schemaPath
+{
+    NSParameterAssert(instancePath);
+    NSParameterAssert(schemaPath);
+
+    if (self.twt_instancePath) {
+        return self;
+    }
+
+    NSMutableDictionary *userInfo = [self.userInfo mutableCopy] ?: [[NSMutableDictionary alloc] init];
+    userInfo[TWTValidationInstancePathKey] = instancePath;
+    userInfo[TWTValidationSchemaPathKey] = schemaPath;
+
+    NSArray *underlyingErrors = userInfo[TWTValidationUnderlyingErrorsKey];
+    if (underlyingErrors) {
+        userInfo[TWTValidationUnderlyingErrorsKey] = TWTValidationErrorsByAddingPaths(underlyingErrors, instancePath, schemaPath);
+    }
+
+    return [NSError errorWithDomain:self.domain code:self.code userInfo:[userInfo copy]];
+}
+
+
+- (BOOL)twt_isTruncated
+{
+    return [self.userInfo[TWTValidationErrorsTruncatedKey] boolValue];
+}
+
+
+- (NSError *)twt_errorByMarkingTruncated
+{
+    if (self.twt_isTruncated) {
+        return self;
+    }
+
+    NSMutableDictionary *userInfo = [self.userInfo mutableCopy] ?: [[NSMutableDictionary alloc] init];
+    userInfo[TWTValidationErrorsTruncatedKey] = @YES;
+    return [NSError errorWithDomain:self.domain code:self.code userInfo:[userInfo copy]];
+}
+
 @end
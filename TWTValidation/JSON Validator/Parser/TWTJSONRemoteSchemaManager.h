@@ -10,6 +10,7 @@
 
 @class TWTJSONSchemaASTNode;
 @class TWTJSONSchemaReferenceASTNode;
+@class TWTJSONSchemaTopLevelASTNode;
 
 
 /*!
@@ -24,13 +25,55 @@ typedef NS_ENUM(NSInteger, TWTJSONRemoteSchemaManagerErrorCode) {
 
     /*! Indicates the file's contents did not represent a valid JSON object. */
     TWTJSONRemoteSchemaManagerErrorCodeInvalidSchemaError,
+
+    /*! Indicates the file's schema references itself, either directly or through other files. */
+    TWTJSONRemoteSchemaManagerErrorCodeCyclicReferenceError,
 };
 
 
 NS_ASSUME_NONNULL_BEGIN
 
+/*!
+ TWTJSONRemoteSchemaManagers load and parse the files referenced by JSON schemas. Files are memory-mapped when it is
+ safe to do so, and each file’s parsed schema is kept until the file’s modification date changes. When several threads
+ need the same file at the same time, it is only read and parsed once; the other threads wait for that result.
+
+ TWTJSONRemoteSchemaManagers are safe to use from multiple threads.
+ */
 @interface TWTJSONRemoteSchemaManager : NSObject
 
+/*!
+ @abstract Returns the process-wide remote schema manager.
+ @discussion This is the manager used by TWTJSONSchemaParsers that are not given one, so remote schemas are shared by
+     every schema compiled in the process.
+ @result The shared remote schema manager.
+ */
++ (instancetype)sharedManager;
+
+/*!
+ @abstract Removes all parsed schemas from the receiver.
+ @discussion Files are still reloaded automatically when their modification dates change, so this is typically only
+     needed to reclaim memory.
+ */
+- (void)removeAllSchemas;
+
+/*!
+ @abstract Loads the file named by a reference path and returns its top-level node.
+ @discussion This checks the file’s modification date, so clients that resolve several references to the same file
+     should keep the returned node and resolve the references with it rather than using
+     -remoteNodeForReferenceNode:, which checks the file again for every reference.
+ @param referencePath The reference path, e.g., @"/subSchemas.json#/definitions/integer".
+ @param outFilePath On return, the path of the referenced file. Only set if outPathComponents is also non-NULL.
+ @param outPathComponents On return, the components of the path within the file, or nil if there are none. Only set
+     if outFilePath is also non-NULL.
+ @param outError On return, the error that occurred if the file could not be loaded.
+ @result The top-level node of the file’s schema, or nil if the file could not be loaded.
+ */
+- (nullable TWTJSONSchemaTopLevelASTNode *)topLevelNodeForReferencePath:(NSString *)referencePath
+                                                                filePath:(NSString *_Nullable *_Nullable)outFilePath
+                                                          pathComponents:(NSArray *_Nullable *_Nullable)outPathComponents
+                                                                   error:(NSError *_Nullable *_Nullable)outError;
+
 - (TWTJSONSchemaASTNode *)remoteNodeForReferenceNode:(TWTJSONSchemaReferenceASTNode *)referenceNode;
 
 - (BOOL)loadSchemaForReferencePath:(NSString *)referencePath filePath:(NSString *_Nullable *_Nonnull)outFilePath pathComponents:(NSArray *_Nullable *_Nonnull)outPathComponents error:(NSError *_Nullable *_Nullable)outError;
@@ -15,32 +15,119 @@
 
 
 static NSString *const kTWTJSONSchemaDraftFileInBundle = @"JSONSchemaDraft4";
+static NSString *const kTWTJSONRemoteSchemaManagerLoadingFilePathsKey = @"TWTJSONRemoteSchemaManagerLoadingFilePaths";
 
 
+#pragma mark Remote Schema Entries
+
+/*!
+ TWTJSONRemoteSchemaEntries hold the parsed schema for a particular version of a file. While an entry is loading, other
+ threads that need the same version of the file wait on the manager’s condition until loading finishes.
+ */
+@interface TWTJSONRemoteSchemaEntry : NSObject
+
+@property (nonatomic, strong) NSDate *modificationDate;
+@property (nonatomic, strong) TWTJSONSchemaTopLevelASTNode *topLevelNode;
+@property (nonatomic, strong) NSError *error;
+@property (nonatomic, assign, getter = isLoading) BOOL loading;
+
+@end
+
+
+@implementation TWTJSONRemoteSchemaEntry
+
+@end
+
+
+#pragma mark - Remote Schema Manager
+
 @interface TWTJSONRemoteSchemaManager ()
 
-@property (nonatomic, strong) NSMutableDictionary *filePathsToJSONSchemaTopLevelNodes;
+@property (nonatomic, strong, readonly) NSCondition *condition;
+@property (nonatomic, strong, readonly) NSMutableDictionary *filePathsToEntries;
 
 @end
 
 
+// Parser errors for reference paths that could not be loaded have the manager's error as their underlying error, and
+// manager errors for invalid schemas have the parser's error as theirs. Parser and manager error codes share a domain
+// and overlap, so only the manager's errors in that chain are checked.
+static NSError *TWTJSONRemoteSchemaManagerUnderlyingCyclicReferenceError(NSError *parserError)
+{
+    NSError *managerError = parserError.userInfo[NSUnderlyingErrorKey];
+    while ([managerError.domain isEqualToString:TWTJSONSchemaParserErrorDomain]) {
+        if (managerError.code == TWTJSONRemoteSchemaManagerErrorCodeCyclicReferenceError) {
+            return managerError;
+        }
+
+        NSError *underlyingParserError = managerError.userInfo[NSUnderlyingErrorKey];
+        managerError = underlyingParserError.userInfo[NSUnderlyingErrorKey];
+    }
+
+    return nil;
+}
+
+
 @implementation TWTJSONRemoteSchemaManager
 
++ (instancetype)sharedManager
+{
+    static TWTJSONRemoteSchemaManager *sharedManager = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedManager = [[self alloc] init];
+    });
+
+    return sharedManager;
+}
+
+
++ (NSString *)draft4FilePath
+{
+    static NSString *draft4FilePath = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        draft4FilePath = [[NSBundle bundleForClass:[TWTJSONRemoteSchemaManager class]] pathForResource:kTWTJSONSchemaDraftFileInBundle ofType:@"json"];
+    });
+
+    return draft4FilePath;
+}
+
+
 - (instancetype)init
 {
     self = [super init];
     if (self) {
-        _filePathsToJSONSchemaTopLevelNodes = [[NSMutableDictionary alloc] init];
+        _condition = [[NSCondition alloc] init];
+        _filePathsToEntries = [[NSMutableDictionary alloc] init];
     }
     return self;
 }
 
 
+- (void)removeAllSchemas
+{
+    // Threads waiting on loading entries hold references to them, so they are unaffected
+    [self.condition lock];
+    [self.filePathsToEntries removeAllObjects];
+    [self.condition unlock];
+}
+
+
 - (BOOL)loadSchemaForReferencePath:(NSString *)fullReferencePath filePath:(NSString **)outFilePath pathComponents:(NSArray **)outPathComponents error:(NSError **)outError;
+{
+    return [self topLevelNodeForReferencePath:fullReferencePath filePath:outFilePath pathComponents:outPathComponents error:outError] != nil;
+}
+
+
+- (TWTJSONSchemaTopLevelASTNode *)topLevelNodeForReferencePath:(NSString *)fullReferencePath
+                                                       filePath:(NSString **)outFilePath
+                                                 pathComponents:(NSArray **)outPathComponents
+                                                          error:(NSError **)outError
 {
     // Some references require validation against the schema rules; redirect these to the file's location in this bundle
     if ([fullReferencePath isEqualToString:TWTJSONSchemaKeywordDraft4Path]) {
-        fullReferencePath = [[NSBundle bundleForClass:[self class]] pathForResource:kTWTJSONSchemaDraftFileInBundle ofType:@"json"];
+        fullReferencePath = [[self class] draft4FilePath];
     }
 
     // Break the full path into the file path and components
@@ -55,9 +142,10 @@ static NSString *const kTWTJSONSchemaDraftFileInBundle = @"JSONSchemaDraft4";
         components = [componentString componentsSeparatedByString:@"/"];
     }
 
-    // If the file has not already been loaded, attempt to load it
-    if (!self.filePathsToJSONSchemaTopLevelNodes[filePath] && ![self fetchFileAtPath:filePath error:outError]) {
-        return NO;
+    // Load the file if the current version of it has not already been loaded
+    TWTJSONSchemaTopLevelASTNode *topLevelNode = [self topLevelNodeForFilePath:filePath error:outError];
+    if (!topLevelNode) {
+        return nil;
     }
 
     // The file has been loaded, set the return values and return
@@ -67,14 +155,101 @@ static NSString *const kTWTJSONSchemaDraftFileInBundle = @"JSONSchemaDraft4";
         *outPathComponents = components;
     }
 
-    return YES;
+    return topLevelNode;
 }
 
 
-- (BOOL)fetchFileAtPath:(NSString *)filePath error:(NSError **)outError
+- (TWTJSONSchemaTopLevelASTNode *)topLevelNodeForFilePath:(NSString *)filePath error:(NSError **)outError
+{
+    // Remote schemas may refer to other remote schemas, so this thread may already be loading files. If it is loading
+    // this one, the reference is cyclic and could never be resolved
+    NSMutableArray *loadingFilePaths = [self loadingFilePathsForCurrentThread];
+    if ([loadingFilePaths containsObject:filePath]) {
+        if (outError) {
+            *outError = [NSError errorWithDomain:TWTJSONSchemaParserErrorDomain
+                                            code:TWTJSONRemoteSchemaManagerErrorCodeCyclicReferenceError
+                                        userInfo:@{ NSLocalizedDescriptionKey : [NSString stringWithFormat:TWTLocalizedString(@"The reference file %@ refers back to itself"), filePath] }];
+        }
+
+        return nil;
+    }
+
+    NSDate *modificationDate = [[NSFileManager defaultManager] attributesOfItemAtPath:filePath error:NULL][NSFileModificationDate];
+
+    [self.condition lock];
+    TWTJSONRemoteSchemaEntry *entry = self.filePathsToEntries[filePath];
+    BOOL entryIsCurrent = modificationDate && [entry.modificationDate isEqualToDate:modificationDate];
+
+    // Threads that are loading other files never wait, since the thread they would wait on may be waiting on them.
+    // Instead, they load their own copy of the file
+    if (entryIsCurrent && (!entry.isLoading || loadingFilePaths.count == 0)) {
+        while (entry.isLoading) {
+            [self.condition wait];
+        }
+
+        [self.condition unlock];
+
+        if (!entry.topLevelNode && outError) {
+            *outError = entry.error;
+        }
+
+        return entry.topLevelNode;
+    }
+
+    TWTJSONRemoteSchemaEntry *loadingEntry = [[TWTJSONRemoteSchemaEntry alloc] init];
+    loadingEntry.modificationDate = modificationDate;
+    loadingEntry.loading = YES;
+
+    // Files without a modification date can’t be loaded anyway, so there’s no point in sharing their entries
+    if (modificationDate && !entryIsCurrent) {
+        self.filePathsToEntries[filePath] = loadingEntry;
+    }
+
+    [self.condition unlock];
+
+    [loadingFilePaths addObject:filePath];
+    NSError *error = nil;
+    TWTJSONSchemaTopLevelASTNode *topLevelNode = [self parseFileAtPath:filePath error:&error];
+    [loadingFilePaths removeLastObject];
+
+    [self.condition lock];
+    loadingEntry.topLevelNode = topLevelNode;
+    loadingEntry.error = error;
+    loadingEntry.loading = NO;
+
+    // Failures are not kept so that the next attempt to load the file tries again
+    if (!topLevelNode && self.filePathsToEntries[filePath] == loadingEntry) {
+        [self.filePathsToEntries removeObjectForKey:filePath];
+    }
+
+    [self.condition broadcast];
+    [self.condition unlock];
+
+    if (!topLevelNode && outError) {
+        *outError = error;
+    }
+
+    return topLevelNode;
+}
+
+
+- (NSMutableArray *)loadingFilePathsForCurrentThread
+{
+    NSMutableDictionary *threadDictionary = [NSThread currentThread].threadDictionary;
+    NSMutableArray *loadingFilePaths = threadDictionary[kTWTJSONRemoteSchemaManagerLoadingFilePathsKey];
+    if (!loadingFilePaths) {
+        loadingFilePaths = [[NSMutableArray alloc] init];
+        threadDictionary[kTWTJSONRemoteSchemaManagerLoadingFilePathsKey] = loadingFilePaths;
+    }
+
+    return loadingFilePaths;
+}
+
+
+- (TWTJSONSchemaTopLevelASTNode *)parseFileAtPath:(NSString *)filePath error:(NSError **)outError
 {
     NSError *error;
-    NSData *data = [NSData dataWithContentsOfFile:filePath options:0 error:&error];
+    NSData *data = [NSData dataWithContentsOfFile:filePath options:NSDataReadingMappedIfSafe error:&error];
 
     if (!data) {
         if (outError) {
@@ -85,7 +260,7 @@ static NSString *const kTWTJSONSchemaDraftFileInBundle = @"JSONSchemaDraft4";
             // Note: Foundation documentation guarantees that error will be returned from dataWithContentsOfFile:options:error:
         }
 
-        return NO;
+        return nil;
     }
 
     NSDictionary *remoteSchema = [NSJSONSerialization JSONObjectWithData:data options:0 error:&error];
@@ -97,30 +272,41 @@ static NSString *const kTWTJSONSchemaDraftFileInBundle = @"JSONSchemaDraft4";
                                                     NSUnderlyingErrorKey : error }];
             // Note: Foundation documentation guarantees that error will be returned from JSONObjectWithData:options:error:
         }
-        return NO;
+        return nil;
     }
 
-    TWTJSONSchemaParser *parser = [[TWTJSONSchemaParser alloc] initWithJSONSchema:remoteSchema];
+    // Files referenced by this one are loaded by this manager too, so that cyclic references can be detected
+    TWTJSONSchemaParser *parser = [[TWTJSONSchemaParser alloc] initWithJSONSchema:remoteSchema remoteSchemaManager:self];
     TWTJSONSchemaTopLevelASTNode *topLevelNode = [parser parseWithError:&error warnings:nil];
     if (!topLevelNode) {
         if (outError) {
-            *outError = [NSError errorWithDomain:TWTJSONSchemaParserErrorDomain
-                                            code:TWTJSONRemoteSchemaManagerErrorCodeInvalidSchemaError
-                                        userInfo:@{ NSLocalizedDescriptionKey : [NSString stringWithFormat:TWTLocalizedString(@"The reference file %@ does not contain a valid JSON Schema"), filePath],
-                                                    NSUnderlyingErrorKey : error }];
+            // When references are cyclic, the parser fails with the error this manager returned for the innermost
+            // file. Report that rather than an invalid schema so that clients can tell the two apart
+            NSError *cyclicReferenceError = TWTJSONRemoteSchemaManagerUnderlyingCyclicReferenceError(error);
+
+            if (cyclicReferenceError) {
+                *outError = [NSError errorWithDomain:TWTJSONSchemaParserErrorDomain
+                                                code:TWTJSONRemoteSchemaManagerErrorCodeCyclicReferenceError
+                                            userInfo:@{ NSLocalizedDescriptionKey : cyclicReferenceError.localizedDescription,
+                                                        NSUnderlyingErrorKey : error }];
+            } else {
+                *outError = [NSError errorWithDomain:TWTJSONSchemaParserErrorDomain
+                                                code:TWTJSONRemoteSchemaManagerErrorCodeInvalidSchemaError
+                                            userInfo:@{ NSLocalizedDescriptionKey : [NSString stringWithFormat:TWTLocalizedString(@"The reference file %@ does not contain a valid JSON Schema"), filePath],
+                                                        NSUnderlyingErrorKey : error }];
+            }
             // Note: This framework guarantees that error will be returned from parseWithError:warnings:
         }
-        return NO;
+        return nil;
     }
 
-    self.filePathsToJSONSchemaTopLevelNodes[filePath] = topLevelNode;
-    return YES;
+    return topLevelNode;
 }
 
 
 - (TWTJSONSchemaASTNode *)remoteNodeForReferenceNode:(TWTJSONSchemaReferenceASTNode *)referenceNode
 {
-    TWTJSONSchemaTopLevelASTNode *topLevelNode = self.filePathsToJSONSchemaTopLevelNodes[referenceNode.filePath];
+    TWTJSONSchemaTopLevelASTNode *topLevelNode = [self topLevelNodeForFilePath:referenceNode.filePath error:NULL];
     return [topLevelNode nodeForReferenceNode:referenceNode];
 }
 
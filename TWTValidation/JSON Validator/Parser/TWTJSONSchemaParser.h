@@ -27,13 +27,19 @@
 @import Foundation;
 
 
+@class TWTJSONRemoteSchemaManager;
 @class TWTJSONSchemaTopLevelASTNode;
 
 
 @interface TWTJSONSchemaParser : NSObject
 
+// Remote schemas are loaded using the shared remote schema manager
 - (instancetype)initWithJSONSchema:(NSDictionary *)topLevelSchema;
 
+// Remote schemas are loaded using the specified manager, so that a client can control which schemas are shared and
+// when they are discarded
+- (instancetype)initWithJSONSchema:(NSDictionary *)topLevelSchema remoteSchemaManager:(TWTJSONRemoteSchemaManager *)remoteSchemaManager;
+
 - (TWTJSONSchemaTopLevelASTNode *)parseWithError:(NSError **)outError warnings:(NSArray **)outWarnings;
 
 @end
@@ -44,6 +44,7 @@ static NSString *const TWTJSONExceptionErrorKey = @"TWTJSONExceptionError";
 @property (nonatomic, strong) NSMutableArray *warnings;
 
 @property (nonatomic, strong, readonly) TWTJSONRemoteSchemaManager *remoteSchemaManager;
+@property (nonatomic, strong, readonly) NSMutableDictionary *remoteTopLevelNodes;
 
 
 - (void)warnWithFormat:(NSString *)format, ... NS_FORMAT_FUNCTION(1, 2);
@@ -56,15 +57,24 @@ static NSString *const TWTJSONExceptionErrorKey = @"TWTJSONExceptionError";
 @implementation TWTJSONSchemaParser
 
 - (instancetype)initWithJSONSchema:(NSDictionary *)topLevelSchema
+{
+    return [self initWithJSONSchema:topLevelSchema remoteSchemaManager:[TWTJSONRemoteSchemaManager sharedManager]];
+}
+
+
+- (instancetype)initWithJSONSchema:(NSDictionary *)topLevelSchema remoteSchemaManager:(TWTJSONRemoteSchemaManager *)remoteSchemaManager
 {
     NSParameterAssert(topLevelSchema);
     NSParameterAssert([NSJSONSerialization isValidJSONObject:topLevelSchema]);
+    NSParameterAssert(remoteSchemaManager);
 
     self = [super init];
     if (self) {
         _JSONSchema = [topLevelSchema copy];
         _pathStack = [[NSMutableArray alloc] init];
         _warnings = [[NSMutableArray alloc] init];
+        _remoteSchemaManager = remoteSchemaManager;
+        _remoteTopLevelNodes = [[NSMutableDictionary alloc] init];
     }
     return self;
 }
@@ -108,7 +118,7 @@ static NSString *const TWTJSONExceptionErrorKey = @"TWTJSONExceptionError";
     if (referenceNodes.count > 0) {
         for (TWTJSONSchemaReferenceASTNode *referenceNode in referenceNodes) {
             TWTJSONSchemaASTNode *referent = (referenceNode.filePath ?
-                                              [self.remoteSchemaManager remoteNodeForReferenceNode:referenceNode] :
+                                              [self.remoteTopLevelNodes[referenceNode.filePath] nodeForReferenceNode:referenceNode] :
                                               [topLevelNode nodeForReferenceNode:referenceNode]);
 
             if (referent) {
@@ -319,10 +329,19 @@ static NSString *const TWTJSONExceptionErrorKey = @"TWTJSONExceptionError";
     } else {
         NSString *filePath;
         pathComponents = nil;
-        if (![self.remoteSchemaManager loadSchemaForReferencePath:referencePath filePath:&filePath pathComponents:&pathComponents error:&error]) {
-            [self failWithErrorCode:TWTJSONSchemaParserErrorCodeInvalidValue object:referencePath description:error.localizedDescription];
+
+        // Keep the file's top-level node so that references into the file resolve against the version loaded here
+        // without checking the file again for each of them
+        TWTJSONSchemaTopLevelASTNode *remoteTopLevelNode = [self.remoteSchemaManager topLevelNodeForReferencePath:referencePath
+                                                                                                         filePath:&filePath
+                                                                                                   pathComponents:&pathComponents
+                                                                                                            error:&error];
+        if (!remoteTopLevelNode) {
+            [self failWithErrorCode:TWTJSONSchemaParserErrorCodeInvalidValue object:referencePath description:error.localizedDescription underlyingError:error];
         }
 
+        self.remoteTopLevelNodes[filePath] = remoteTopLevelNode;
+
         referenceNode.filePath = filePath;
         referenceNode.referencePathComponents = pathComponents;
     }
@@ -870,8 +889,17 @@ static NSString *const TWTJSONExceptionErrorKey = @"TWTJSONExceptionError";
 
 - (void)failWithErrorCode:(NSUInteger)code object:(id)object description:(NSString *)description
 {
-    NSError *error = [NSError errorWithDomain:TWTJSONSchemaParserErrorDomain code:code userInfo:@{ TWTJSONSchemaParserInvalidObjectKey : object,
-                                                                                                   NSLocalizedDescriptionKey : TWTLocalizedString(description) }];
+    [self failWithErrorCode:code object:object description:description underlyingError:nil];
+}
+
+
+- (void)failWithErrorCode:(NSUInteger)code object:(id)object description:(NSString *)description underlyingError:(NSError *)underlyingError
+{
+    NSMutableDictionary *userInfo = [@{ TWTJSONSchemaParserInvalidObjectKey : object,
+                                        NSLocalizedDescriptionKey : TWTLocalizedString(description) } mutableCopy];
+    userInfo[NSUnderlyingErrorKey] = underlyingError;
+
+    NSError *error = [NSError errorWithDomain:TWTJSONSchemaParserErrorDomain code:code userInfo:userInfo];
 
     @throw [NSException exceptionWithName:TWTJSONParserException reason:nil userInfo:@{ TWTJSONExceptionErrorKey : error }];
 }
@@ -935,16 +963,4 @@ static NSString *const TWTJSONExceptionErrorKey = @"TWTJSONExceptionError";
     return types;
 }
 
-
-#pragma mark - Accessors
-
-@synthesize remoteSchemaManager = _remoteSchemaManager;
-- (TWTJSONRemoteSchemaManager *)remoteSchemaManager
-{
-    if (!_remoteSchemaManager) {
-        _remoteSchemaManager = [[TWTJSONRemoteSchemaManager alloc] init];
-    }
-    return _remoteSchemaManager;
-}
-
 @end
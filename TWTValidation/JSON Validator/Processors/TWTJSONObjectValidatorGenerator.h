@@ -34,6 +34,15 @@
 
 @interface TWTJSONObjectValidatorGenerator : NSObject <TWTJSONSchemaASTProcessor>
 
+// Whether generated validators are simplified once references are connected. Simplification collapses JSON object
+// and compound validators that only wrap one validator, flattens nested and/or validators, and replaces the mutually
+// exclusive type check for schemas whose type is implied with a direct test of the value’s type. Validation results
+// are unchanged, though underlying errors may be nested less deeply. YES by default.
+@property (nonatomic, assign) BOOL simplifiesValidators;
+
+// The number of validators that simplification removed from the most recently generated validator
+@property (nonatomic, assign, readonly) NSUInteger removedValidatorCount;
+
 - (TWTJSONObjectValidator *)validatorFromJSONSchema:(NSDictionary *)schema
                                               error:(NSError *__autoreleasing *)outError
                                            warnings:(NSArray *__autoreleasing *)outWarnings;
@@ -31,19 +31,56 @@
 #import <TWTValidation/TWTJSONSchemaASTCommon.h>
 #import <TWTValidation/TWTJSONSchemaParser.h>
 #import <TWTValidation/TWTJSONSchemaArrayValidator.h>
+#import <TWTValidation/TWTJSONSchemaImpliedTypeValidator.h>
 #import <TWTValidation/TWTJSONSchemaObjectValidator.h>
+#import <TWTValidation/TWTJSONSchemaTypeValidator.h>
 #import <TWTValidation/TWTProxyValidator.h>
 #import <TWTValidation/TWTValidationLocalization.h>
 
 
+@interface TWTJSONObjectValidator (TWTJSONObjectValidatorGenerator)
+
+@property (nonatomic, strong, readonly) TWTValidator *commonValidator;
+@property (nonatomic, strong, readonly) TWTValidator *typeValidator;
+
+@end
+
+
+@interface TWTJSONSchemaObjectValidator (TWTJSONObjectValidatorGenerator)
+
+@property (nonatomic, assign, readonly) BOOL allowsAllAdditionalProperties;
+
+- (instancetype)initWithMinimumPropertyCount:(NSNumber *)minimumPropertyCount
+                        maximumPropertyCount:(NSNumber *)maximumPropertyCount
+                        requiredPropertyKeys:(NSSet *)requiredPropertyKeys
+                          propertyValidators:(NSArray *)propertyValidators
+                   patternPropertyValidators:(NSArray *)patternPropertyValidators
+               additionalPropertiesValidator:(TWTValidator *)additionalPropertiesValidator
+               allowsAllAdditionalProperties:(BOOL)allowsAllAdditionalProperties
+                        propertyDependencies:(NSDictionary *)propertyDependencies;
+
+@end
+
+
 @interface TWTJSONObjectValidatorGenerator ()
 
+@property (nonatomic, assign, readwrite) NSUInteger removedValidatorCount;
+
 @property (nonatomic, strong, readonly) NSMutableArray *objectStack;
 
 @property (nonatomic, strong) NSMapTable *referenceNodesToProxyValidators;
 @property (nonatomic, strong) NSMapTable *referentNodesToValidators;
 @property (nonatomic, copy) NSSet *referentNodes;
 
+// Maps the mutually exclusive type checks generated for schemas whose type is implied to the implied types
+@property (nonatomic, strong, readonly) NSMapTable *impliedTypeValidatorsToTypes;
+
+// Maps validators to their simplified versions
+@property (nonatomic, strong, readonly) NSMapTable *simplifiedValidators;
+
+// Proxy validators whose validators have not been simplified yet
+@property (nonatomic, strong, readonly) NSMutableArray *unsimplifiedProxyValidators;
+
 @end
 
 
@@ -56,6 +93,16 @@
         _objectStack = [[NSMutableArray alloc] init];
         _referenceNodesToProxyValidators = [NSMapTable strongToStrongObjectsMapTable];
         _referentNodesToValidators = [NSMapTable strongToStrongObjectsMapTable];
+
+        // Validators are equal if they validate the same way, so these must compare keys by identity
+        _impliedTypeValidatorsToTypes = [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality
+                                                                  valueOptions:NSPointerFunctionsStrongMemory
+                                                                      capacity:0];
+        _simplifiedValidators = [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality
+                                                          valueOptions:NSPointerFunctionsStrongMemory
+                                                              capacity:0];
+        _unsimplifiedProxyValidators = [[NSMutableArray alloc] init];
+        _simplifiesValidators = YES;
     }
     return self;
 }
@@ -63,6 +110,8 @@
 
 - (TWTJSONObjectValidator *)validatorFromJSONSchema:(NSDictionary *)schema error:(NSError *__autoreleasing *)outError warnings:(NSArray *__autoreleasing *)outWarnings
 {
+    self.removedValidatorCount = 0;
+
     TWTJSONSchemaParser *parser = [[TWTJSONSchemaParser alloc] initWithJSONSchema:schema];
     TWTJSONSchemaTopLevelASTNode *topLevelNode = [parser parseWithError:outError warnings:outWarnings];
     if (!topLevelNode) {
@@ -98,11 +147,16 @@
     }
 
     TWTJSONObjectValidator *finalValidator = [self popCurrentObject];
+    if (self.simplifiesValidators) {
+        finalValidator = [self simplifiedTopLevelValidator:finalValidator];
+    }
 
     // Reset properties
     [self.objectStack removeAllObjects];
     [self.referenceNodesToProxyValidators removeAllObjects];
     [self.referentNodesToValidators removeAllObjects];
+    [self.impliedTypeValidatorsToTypes removeAllObjects];
+    [self.simplifiedValidators removeAllObjects];
 
     return finalValidator;
 }
@@ -124,7 +178,7 @@
     if ([genericNode.validTypes containsObject:TWTJSONSchemaTypeKeywordBoolean]) {
         typeValidator = [self booleanTypeValidator];
     } else if ([genericNode.validTypes containsObject:TWTJSONSchemaTypeKeywordNull]) {
-        typeValidator = [TWTValueValidator valueValidatorWithClass:[NSNull class] allowsNil:NO allowsNull:YES];
+        typeValidator = [[TWTJSONSchemaTypeValidator alloc] initWithTypes:TWTJSONTypeMaskNull];
     }
 
     [self pushJSONObjectValidatorWithCommonValidator:commonValidator typeValidator:typeValidator node:genericNode];
@@ -194,7 +248,14 @@
 
     NSArray *properties = [self validatorsFromNodeArray:objectNode.propertySchemas];
     NSArray *patterns = [self validatorsFromNodeArray:objectNode.patternPropertySchemas];
+
     TWTValidator *additionalPropertiesValidator = [self validatorFromNode:objectNode.additionalPropertiesNode];
+
+    // Additional properties that are always allowed don’t need to be validated, which lets the object validator skip them
+    TWTJSONSchemaASTNode *additionalPropertiesNode = objectNode.additionalPropertiesNode;
+    BOOL allowsAllAdditionalProperties = [additionalPropertiesNode isKindOfClass:[TWTJSONSchemaBooleanValueASTNode class]] &&
+        ((TWTJSONSchemaBooleanValueASTNode *)additionalPropertiesNode).booleanValue;
+
     NSDictionary *dependencies = [self dependencyDictionaryFromNodeArray:objectNode.propertyDependencies];
     TWTJSONSchemaObjectValidator *typeValidator = [[TWTJSONSchemaObjectValidator alloc] initWithMinimumPropertyCount:objectNode.minimumPropertyCount
                                                                                                 maximumPropertyCount:objectNode.maximumPropertyCount
@@ -202,6 +263,7 @@
                                                                                                   propertyValidators:properties
                                                                                            patternPropertyValidators:patterns
                                                                                        additionalPropertiesValidator:additionalPropertiesValidator
+                                                                                       allowsAllAdditionalProperties:allowsAllAdditionalProperties
                                                                                                 propertyDependencies:dependencies];
 
     [self pushJSONObjectValidatorWithCommonValidator:commonValidator typeValidator:typeValidator node:objectNode];
@@ -219,7 +281,7 @@
     }
 
     if (stringNode.regularExpression) {
-        [self addSubvalidator:[TWTStringValidator stringValidatorWithRegularExpression:stringNode.regularExpression options:0]];
+        [self addSubvalidator:TWTJSONSchemaStringValidatorForPattern(stringNode.regularExpression)];
     }
 
     TWTValidator *typeValidator = [self validatorFromSubvalidators];
@@ -234,13 +296,18 @@
 - (void)processAmbiguousNode:(TWTJSONSchemaAmbiguousASTNode *)ambiguousNode
 {
     TWTValidator *commonValidator = [self commonValidatorFromNode:ambiguousNode];
-    NSMutableArray *orValidators = [[NSMutableArray alloc] initWithCapacity:ambiguousNode.subNodes.count];
+    NSMutableArray *subvalidators = [[NSMutableArray alloc] initWithCapacity:ambiguousNode.subNodes.count];
+    NSMutableArray *subvalidatorTypes = [[NSMutableArray alloc] initWithCapacity:ambiguousNode.subNodes.count];
     for (TWTJSONSchemaASTNode *subNode in ambiguousNode.subNodes) {
         [subNode acceptProcessor:self];
-        [orValidators addObject:[self popCurrentObject]];
+        [subvalidators addObject:[self popCurrentObject]];
+        [subvalidatorTypes addObject:@(TWTJSONTypeMaskForSchemaTypes(subNode.validTypes))];
     }
 
-    TWTCompoundValidator *typeValidator = [TWTCompoundValidator orValidatorWithSubvalidators:orValidators];
+    // Each subnode’s type is explicit, so its validator fails values of other types. This lets the type validator
+    // go straight to the subvalidators for a value’s type instead of trying each one.
+    TWTJSONSchemaAmbiguousTypeValidator *typeValidator = [[TWTJSONSchemaAmbiguousTypeValidator alloc] initWithSubvalidators:subvalidators
+                                                                                                                       types:subvalidatorTypes];
     [self pushJSONObjectValidatorWithCommonValidator:commonValidator typeValidator:typeValidator node:ambiguousNode];
 }
 
@@ -255,7 +322,7 @@
             *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeAdditionalElementsNotAllowed
                                             failingValidator:nil
                                                        value:nil
-                                        localizedDescription:TWTLocalizedString(@"TWTJSONObjectValidator.validationError")];
+                                   localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTJSONObjectValidator.validationError"); }];
         }
         return validates;
     }]];
@@ -378,75 +445,208 @@
 {
     NSParameterAssert(types.count);
 
-    NSMutableArray *subvalidators = [[NSMutableArray alloc] initWithCapacity:types.count];
+    // The types should never include "integer," "any," "boolean," or "null," because this is only called when the type is not explicit.
+    // "Integer" cannot be implied, any keywords can only be interpreted as "number"
+    // "Boolean" and "null" will never be implied types because they have no type-specific keywords.
+    // If "any" is the implied type, then no type validator exists as the counterpoint to this "not."
+    TWTValidator *subvalidator = [[TWTJSONSchemaTypeValidator alloc] initWithTypes:TWTJSONTypeMaskForSchemaTypes(types)];
+    return [TWTCompoundValidator notValidatorWithSubvalidator:subvalidator];
+}
+
+
+- (TWTValidator *)numberTypeValidator
+{
+    // This enables the TWTJSONObjectValidator to differentiate between numbers and booleans
+    return [[TWTJSONSchemaTypeValidator alloc] initWithTypes:TWTJSONTypeMaskNumber];
+}
+
+
+- (TWTValidator *)booleanTypeValidator
+{
+    return [[TWTJSONSchemaTypeValidator alloc] initWithTypes:TWTJSONTypeMaskBoolean];
+}
+
+
+#pragma mark - Simplification
+
+- (TWTJSONObjectValidator *)simplifiedTopLevelValidator:(TWTJSONObjectValidator *)validator
+{
+    // The top-level validator is never collapsed, because callers expect a JSON object validator
+    TWTJSONObjectValidator *simplifiedValidator = [[TWTJSONObjectValidator alloc] initWithCommonValidator:[self simplifiedValidator:validator.commonValidator]
+                                                                                            typeValidator:[self simplifiedValidator:validator.typeValidator]];
+    [self.simplifiedValidators setObject:simplifiedValidator forKey:validator];
+
+    // Proxy validators are simplified last so that recursive references don’t recurse forever. Simplifying a proxy’s
+    // validator may find more proxies, so keep going until there are none left.
+    while (self.unsimplifiedProxyValidators.count) {
+        TWTProxyValidator *proxyValidator = self.unsimplifiedProxyValidators.lastObject;
+        [self.unsimplifiedProxyValidators removeLastObject];
+        proxyValidator.validator = [self simplifiedValidator:proxyValidator.validator];
+    }
+
+    return simplifiedValidator;
+}
+
+
+- (TWTValidator *)simplifiedValidator:(TWTValidator *)validator
+{
+    if (!validator) {
+        return nil;
+    }
 
-    if ([types containsObject:TWTJSONSchemaTypeKeywordArray]) {
-        [subvalidators addObject:[TWTValueValidator valueValidatorWithClass:[NSArray class] allowsNil:NO allowsNull:NO]];
+    TWTValidator *simplifiedValidator = [self.simplifiedValidators objectForKey:validator];
+    if (simplifiedValidator) {
+        return simplifiedValidator;
     }
-    if ([types containsObject:TWTJSONSchemaTypeKeywordNumber]) {
-        [subvalidators addObject:[self numberTypeValidator]];
+
+    if ([validator isKindOfClass:[TWTProxyValidator class]]) {
+        // Proxies are kept so that references still work
+        [self.unsimplifiedProxyValidators addObject:validator];
+        simplifiedValidator = validator;
+    } else if ([validator isKindOfClass:[TWTJSONObjectValidator class]]) {
+        simplifiedValidator = [self simplifiedJSONObjectValidator:(TWTJSONObjectValidator *)validator];
+    } else if ([validator isKindOfClass:[TWTCompoundValidator class]]) {
+        simplifiedValidator = [self simplifiedCompoundValidator:(TWTCompoundValidator *)validator];
+    } else if ([validator isKindOfClass:[TWTJSONSchemaAmbiguousTypeValidator class]]) {
+        TWTJSONSchemaAmbiguousTypeValidator *ambiguousTypeValidator = (TWTJSONSchemaAmbiguousTypeValidator *)validator;
+        simplifiedValidator = [[TWTJSONSchemaAmbiguousTypeValidator alloc] initWithSubvalidators:[self simplifiedValidatorsFromArray:ambiguousTypeValidator.subvalidators]
+                                                                                           types:ambiguousTypeValidator.subvalidatorTypes];
+    } else if ([validator isKindOfClass:[TWTJSONSchemaArrayValidator class]]) {
+        simplifiedValidator = [self simplifiedArrayValidator:(TWTJSONSchemaArrayValidator *)validator];
+    } else if ([validator isKindOfClass:[TWTJSONSchemaObjectValidator class]]) {
+        simplifiedValidator = [self simplifiedObjectValidator:(TWTJSONSchemaObjectValidator *)validator];
+    } else if ([validator isKindOfClass:[TWTKeyValuePairValidator class]]) {
+        TWTKeyValuePairValidator *keyValuePairValidator = (TWTKeyValuePairValidator *)validator;
+        simplifiedValidator = [[TWTKeyValuePairValidator alloc] initWithKey:keyValuePairValidator.key
+                                                             valueValidator:[self simplifiedValidator:keyValuePairValidator.valueValidator]];
+    } else {
+        simplifiedValidator = validator;
     }
-    if ([types containsObject:TWTJSONSchemaTypeKeywordObject]) {
-        [subvalidators addObject:[TWTValueValidator valueValidatorWithClass:[NSDictionary class] allowsNil:NO allowsNull:NO]];
+
+    [self.simplifiedValidators setObject:simplifiedValidator forKey:validator];
+    return simplifiedValidator;
+}
+
+
+- (NSArray *)simplifiedValidatorsFromArray:(NSArray *)validators
+{
+    if (!validators) {
+        return nil;
     }
-    if ([types containsObject:TWTJSONSchemaTypeKeywordString]) {
-        [subvalidators addObject:[TWTValueValidator valueValidatorWithClass:[NSString class] allowsNil:NO allowsNull:NO]];
+
+    NSMutableArray *simplifiedValidators = [[NSMutableArray alloc] initWithCapacity:validators.count];
+    for (TWTValidator *validator in validators) {
+        [simplifiedValidators addObject:[self simplifiedValidator:validator]];
     }
 
-    // Validators for "integer," "any," "boolean," and "null" should not be needed, because this is only called when the type is not explicit.
-    // "Integer" cannot be implied, any keywords can only be interpreted as "number"
-    // "Boolean" and "null" will never be implied types because they have no type-specific keywords.
-    // If "any" is the implied type, then no type validator exists as the counterpoint to this "not."
+    return simplifiedValidators;
+}
 
-    TWTValidator *subvalidator = subvalidators.count > 1 ? [TWTCompoundValidator orValidatorWithSubvalidators:subvalidators] : subvalidators.firstObject;
-    return [TWTCompoundValidator notValidatorWithSubvalidator:subvalidator];
+
+- (TWTValidator *)simplifiedJSONObjectValidator:(TWTJSONObjectValidator *)validator
+{
+    TWTValidator *commonValidator = [self simplifiedValidator:validator.commonValidator];
+    TWTValidator *typeValidator = [self simplifiedValidator:validator.typeValidator];
+
+    // A JSON object validator with only one subvalidator gets the same results as that subvalidator. One with no
+    // subvalidators passes everything, which no other validator here does, so we leave it alone.
+    if ((commonValidator == nil) != (typeValidator == nil)) {
+        self.removedValidatorCount++;
+        return commonValidator ?: typeValidator;
+    }
+
+    return [[TWTJSONObjectValidator alloc] initWithCommonValidator:commonValidator typeValidator:typeValidator];
 }
 
 
-- (TWTValidator *)numberTypeValidator
+- (TWTValidator *)simplifiedCompoundValidator:(TWTCompoundValidator *)validator
 {
-    return [[TWTBlockValidator alloc] initWithBlock:^BOOL(id value, NSError *__autoreleasing *outError) {
-        // Checks that a value is an NSNumber and is NOT encoded as a boolean
-        // The NOT is used because a valid value may be encoded as one of several number types (int, double, float, etc.)
-        // This enables the TWTJSONObjectValidator to differentiate between numbers and booleans
-        BOOL validated = [value isKindOfClass:[NSNumber class]] && strcmp([(NSNumber *)value objCType], @encode(BOOL)) != 0;
-        if (!validated && outError) {
-            NSString *descriptionFormat = TWTLocalizedString(@"TWTValueValidator.valueHasIncorrectClass.validationError.format");
-            NSString *description = nil;
-            if ([value isKindOfClass:[NSNumber class]]) {
-                description = [NSString stringWithFormat:descriptionFormat, @"boolean", @"number"];
-            } else {
-                description = [NSString stringWithFormat:descriptionFormat, [value class], [NSNumber class]];
-            }
+    NSSet *impliedTypes = [self.impliedTypeValidatorsToTypes objectForKey:validator];
+    if (impliedTypes) {
+        // The mutually exclusive type check and the not validator for the implied types are replaced by one validator
+        self.removedValidatorCount += [self countOfValidatorsInValidator:validator.subvalidators.lastObject];
+        return [[TWTJSONSchemaImpliedTypeValidator alloc] initWithImpliedTypes:TWTJSONTypeMaskForSchemaTypes(impliedTypes)
+                                                                 typeValidator:[self simplifiedValidator:validator.subvalidators.firstObject]];
+    }
 
-            // Failing validator and value are implemented in TWTBlockValidator
-            *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueHasIncorrectClass failingValidator:nil value:nil localizedDescription:description];
+    TWTCompoundValidatorType type = validator.compoundValidatorType;
+    BOOL flattens = type == TWTCompoundValidatorTypeAnd || type == TWTCompoundValidatorTypeOr;
+
+    NSMutableArray *subvalidators = [[NSMutableArray alloc] initWithCapacity:validator.subvalidators.count];
+    for (TWTValidator *subvalidator in validator.subvalidators) {
+        TWTValidator *simplifiedSubvalidator = [self simplifiedValidator:subvalidator];
+        if (flattens && [simplifiedSubvalidator isKindOfClass:[TWTCompoundValidator class]] &&
+            [(TWTCompoundValidator *)simplifiedSubvalidator compoundValidatorType] == type) {
+            [subvalidators addObjectsFromArray:[(TWTCompoundValidator *)simplifiedSubvalidator subvalidators]];
+            self.removedValidatorCount++;
+        } else {
+            [subvalidators addObject:simplifiedSubvalidator];
         }
-        return validated;
-    }];
+    }
+
+    if (type == TWTCompoundValidatorTypeNot) {
+        // Not validators with one subvalidator cancel each other out
+        TWTCompoundValidator *subvalidator = subvalidators.firstObject;
+        if (subvalidators.count == 1 && [subvalidator isKindOfClass:[TWTCompoundValidator class]] &&
+            subvalidator.compoundValidatorType == TWTCompoundValidatorTypeNot && subvalidator.subvalidators.count == 1) {
+            self.removedValidatorCount += 2;
+            return subvalidator.subvalidators.firstObject;
+        }
+    } else if (subvalidators.count == 1) {
+        // And, or, and mutual exclusion validators with one subvalidator get the same results as that subvalidator
+        self.removedValidatorCount++;
+        return subvalidators.firstObject;
+    }
+
+    return [[TWTCompoundValidator alloc] initWithType:type subvalidators:subvalidators];
 }
 
 
-- (TWTValidator *)booleanTypeValidator
+- (TWTValidator *)simplifiedArrayValidator:(TWTJSONSchemaArrayValidator *)validator
 {
-    return [[TWTBlockValidator alloc] initWithBlock:^BOOL(id value, NSError *__autoreleasing *outError) {
-        // Checks that a value is an NSNumber and is encoded as a boolean
-        // This enables the TWTJSONObjectValidator to differentiate between numbers and booleans
-        BOOL validated = [value isKindOfClass:[NSNumber class]] && strcmp([(NSNumber *)value objCType], @encode(BOOL)) == 0;
-        if (!validated && outError) {
-            NSString *descriptionFormat = TWTLocalizedString(@"TWTValueValidator.valueHasIncorrectClass.validationError.format");
-            NSString *description = nil;
-            if ([value isKindOfClass:[NSNumber class]]) {
-                description = [NSString stringWithFormat:descriptionFormat, @"number", @"boolean"];
-            } else {
-                description = [NSString stringWithFormat:descriptionFormat, [value class], [NSNumber class]];
-            }
+    return [[TWTJSONSchemaArrayValidator alloc] initWithMinimumItemCount:validator.minimumItemCount
+                                                        maximumItemCount:validator.maximumItemCount
+                                                     requiresUniqueItems:validator.requiresUniqueItems
+                                                           itemValidator:[self simplifiedValidator:validator.itemValidator]
+                                                   indexedItemValidators:[self simplifiedValidatorsFromArray:validator.indexedItemValidators]
+                                                additionalItemsValidator:[self simplifiedValidator:validator.additionalItemsValidator]];
+}
 
-            // Failing validator and value are implemented in TWTBlockValidator
-            *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueHasIncorrectClass failingValidator:nil value:nil localizedDescription:description];
-        }
-        return validated;
-    }];
+
+- (TWTValidator *)simplifiedObjectValidator:(TWTJSONSchemaObjectValidator *)validator
+{
+    NSMutableDictionary *dependencies = nil;
+    if (validator.propertyDependencies) {
+        // Dependencies are either validators or sets of property keys
+        dependencies = [[NSMutableDictionary alloc] initWithCapacity:validator.propertyDependencies.count];
+        [validator.propertyDependencies enumerateKeysAndObjectsUsingBlock:^(NSString *key, id dependency, BOOL *stop) {
+            dependencies[key] = [dependency isKindOfClass:[TWTValidator class]] ? [self simplifiedValidator:dependency] : dependency;
+        }];
+    }
+
+    return [[TWTJSONSchemaObjectValidator alloc] initWithMinimumPropertyCount:validator.minimumPropertyCount
+                                                         maximumPropertyCount:validator.maximumPropertyCount
+                                                         requiredPropertyKeys:validator.requiredPropertyKeys
+                                                           propertyValidators:[self simplifiedValidatorsFromArray:validator.propertyValidators]
+                                                    patternPropertyValidators:[self simplifiedValidatorsFromArray:validator.patternPropertyValidators]
+                                                additionalPropertiesValidator:[self simplifiedValidator:validator.additionalPropertiesValidator]
+                                                allowsAllAdditionalProperties:validator.allowsAllAdditionalProperties
+                                                         propertyDependencies:dependencies];
+}
+
+
+- (NSUInteger)countOfValidatorsInValidator:(TWTValidator *)validator
+{
+    if (![validator isKindOfClass:[TWTCompoundValidator class]]) {
+        return 1;
+    }
+
+    NSUInteger count = 1;
+    for (TWTValidator *subvalidator in [(TWTCompoundValidator *)validator subvalidators]) {
+        count += [self countOfValidatorsInValidator:subvalidator];
+    }
+
+    return count;
 }
 
 
@@ -470,6 +670,7 @@
         // This is equivalent to (!node.isTypeSpecified && ![node.validTypes containsObject:TWTJSONSchemaTypeKeywordAny])
         // because that should be the only scenario where a type validator does not exist
         expandedTypeValidator = [TWTCompoundValidator mutualExclusionValidatorWithSubvalidators:@[ typeValidator, [self notValidatorForTypes:node.validTypes]]];
+        [self.impliedTypeValidatorsToTypes setObject:node.validTypes forKey:expandedTypeValidator];
     }
 
     TWTJSONObjectValidator *validator = [[TWTJSONObjectValidator alloc] initWithCommonValidator:commonValidator typeValidator:expandedTypeValidator];
@@ -0,0 +1,150 @@
+//
+//  TWTJSONSchemaProgramCompiler.h
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+@import Foundation;
+
+#import <TWTValidation/TWTJSONSchemaASTProcessor.h>
+#import <TWTValidation/TWTJSONSchemaProgram.h>
+#import <TWTValidation/TWTJSONType.h>
+
+
+// Every schema in a program is compiled into a subroutine that validates a single value and returns whether it is
+// valid. Each instruction either checks the value, in which case the subroutine fails as soon as a check fails, or
+// controls which instructions are executed next. Subroutines are identified by their index in the program’s
+// subroutine table, not their offset, so that they can be compiled in any order.
+typedef NS_ENUM(uint8_t, TWTJSONSchemaOpcode) {
+    // Returns YES or NO
+    TWTJSONSchemaOpcodeSucceed,
+    TWTJSONSchemaOpcodeFail,
+
+    // Fails if the value’s type is not in operand.typeMask
+    TWTJSONSchemaOpcodeTestType,
+
+    // Skips the next target instructions if the value’s type is not in operand.typeMask
+    TWTJSONSchemaOpcodeSkipUnlessType,
+
+    // Fails if the TWTValidator at constants[operand.index] fails
+    TWTJSONSchemaOpcodeCheckValidator,
+
+    // Fails if the number value is not a multiple of operand.doubleValue
+    TWTJSONSchemaOpcodeCheckMultipleOf,
+
+    // Fail if the array or object value’s count is less than or greater than operand.count
+    TWTJSONSchemaOpcodeCheckMinimumCount,
+    TWTJSONSchemaOpcodeCheckMaximumCount,
+
+    // Fails if the array value has duplicate items
+    TWTJSONSchemaOpcodeCheckUniqueItems,
+
+    // Fails if the object value doesn’t contain every key in the array at constants[operand.index]
+    TWTJSONSchemaOpcodeCheckRequiredKeys,
+
+    // Fails if subroutine target fails
+    TWTJSONSchemaOpcodeCall,
+
+    // Each of these is followed by operand.count subroutine instructions. They fail unless all, any, exactly one, or
+    // none of the subroutines pass, respectively.
+    TWTJSONSchemaOpcodeCallAll,
+    TWTJSONSchemaOpcodeCallAny,
+    TWTJSONSchemaOpcodeCallOne,
+    TWTJSONSchemaOpcodeCallNone,
+
+    // Not executed. Names subroutine target for the preceding call or item instruction.
+    TWTJSONSchemaOpcodeSubroutine,
+
+    // Fails if any of the array value’s items fails subroutine target
+    TWTJSONSchemaOpcodeValidateItems,
+
+    // Followed by operand.count subroutine instructions, one for each leading item. Fails if any leading item fails
+    // its subroutine or any remaining item fails subroutine target.
+    TWTJSONSchemaOpcodeValidateIndexedItems,
+
+    // Fails if any of the object value’s properties fails the TWTJSONSchemaPropertyTable at constants[operand.index]
+    TWTJSONSchemaOpcodeValidateProperties
+};
+
+
+// Indicates the absence of a subroutine, e.g., when additional items or properties are always allowed
+static const uint32_t TWTJSONSchemaNoSubroutine = UINT32_MAX;
+
+
+typedef struct _TWTJSONSchemaInstruction {
+    TWTJSONSchemaOpcode opcode;
+    uint32_t target;
+    union {
+        uint32_t index;
+        TWTJSONTypeMask typeMask;
+        NSUInteger count;
+        double doubleValue;
+    } operand;
+} TWTJSONSchemaInstruction;
+
+
+// TWTJSONSchemaPropertyTables dispatch each property of an object to the subroutines that validate it. Named
+// properties are found with a single hash lookup.
+@interface TWTJSONSchemaPropertyTable : NSObject
+
+// Keys are property names; values are subroutine indexes
+@property (nonatomic, copy, readonly) NSDictionary *propertySubroutines;
+
+@property (nonatomic, copy, readonly) NSArray *patternRegularExpressions;
+@property (nonatomic, copy, readonly) NSArray *patternSubroutines;
+
+@property (nonatomic, assign, readonly) uint32_t additionalPropertiesSubroutine;
+
+// Keys are property names; values are either subroutine indexes that validate the whole object or arrays of keys
+// that the object must contain
+@property (nonatomic, copy, readonly) NSDictionary *dependencies;
+
+- (instancetype)initWithPropertySubroutines:(NSDictionary *)propertySubroutines
+                  patternRegularExpressions:(NSArray *)patternRegularExpressions
+                         patternSubroutines:(NSArray *)patternSubroutines
+             additionalPropertiesSubroutine:(uint32_t)additionalPropertiesSubroutine
+                               dependencies:(NSDictionary *)dependencies;
+
+@end
+
+
+@interface TWTJSONSchemaProgram ()
+
+- (instancetype)initWithSchema:(NSDictionary *)schema
+                  instructions:(NSData *)instructions
+            subroutineOffsets:(NSData *)subroutineOffsets
+                     constants:(NSArray *)constants;
+
+@end
+
+
+// TWTJSONSchemaProgramCompilers lower a parsed JSON schema into a TWTJSONSchemaProgram. Each node is compiled into the
+// same checks that TWTJSONObjectValidatorGenerator would create validators for, so a program and the object validator
+// for a schema always agree on which values are valid.
+@interface TWTJSONSchemaProgramCompiler : NSObject <TWTJSONSchemaASTProcessor>
+
+- (TWTJSONSchemaProgram *)programFromJSONSchema:(NSDictionary *)schema
+                                          error:(NSError *__autoreleasing *)outError
+                                       warnings:(NSArray *__autoreleasing *)outWarnings;
+
+@end
@@ -0,0 +1,487 @@
+//
+//  TWTJSONSchemaProgramCompiler.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTJSONSchemaProgramCompiler.h>
+
+#import <TWTValidation/TWTValidation.h>
+
+#import <TWTValidation/TWTJSONSchemaASTCommon.h>
+#import <TWTValidation/TWTJSONSchemaParser.h>
+
+
+static inline TWTJSONSchemaInstruction TWTJSONSchemaInstructionMake(TWTJSONSchemaOpcode opcode, uint32_t target)
+{
+    TWTJSONSchemaInstruction instruction;
+    memset(&instruction, 0, sizeof(instruction));
+    instruction.opcode = opcode;
+    instruction.target = target;
+    return instruction;
+}
+
+
+#pragma mark
+
+@implementation TWTJSONSchemaPropertyTable
+
+- (instancetype)init
+{
+    return [self initWithPropertySubroutines:nil
+                   patternRegularExpressions:nil
+                          patternSubroutines:nil
+              additionalPropertiesSubroutine:TWTJSONSchemaNoSubroutine
+                                dependencies:nil];
+}
+
+
+- (instancetype)initWithPropertySubroutines:(NSDictionary *)propertySubroutines
+                  patternRegularExpressions:(NSArray *)patternRegularExpressions
+                         patternSubroutines:(NSArray *)patternSubroutines
+             additionalPropertiesSubroutine:(uint32_t)additionalPropertiesSubroutine
+                               dependencies:(NSDictionary *)dependencies
+{
+    NSParameterAssert(patternRegularExpressions.count == patternSubroutines.count);
+
+    self = [super init];
+    if (self) {
+        _propertySubroutines = [propertySubroutines copy];
+        _patternRegularExpressions = [patternRegularExpressions copy];
+        _patternSubroutines = [patternSubroutines copy];
+        _additionalPropertiesSubroutine = additionalPropertiesSubroutine;
+        _dependencies = [dependencies copy];
+    }
+
+    return self;
+}
+
+@end
+
+
+#pragma mark
+
+@interface TWTJSONSchemaProgramCompiler ()
+
+// Each subroutine’s instructions are compiled into its own data object and concatenated once compilation is done
+@property (nonatomic, strong, readonly) NSMutableArray *subroutines;
+@property (nonatomic, strong, readonly) NSMutableArray *subroutineStack;
+@property (nonatomic, strong, readonly) NSMapTable *nodesToSubroutines;
+@property (nonatomic, strong, readonly) NSMutableArray *constants;
+
+@end
+
+
+@implementation TWTJSONSchemaProgramCompiler
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _subroutines = [[NSMutableArray alloc] init];
+        _subroutineStack = [[NSMutableArray alloc] init];
+        _nodesToSubroutines = [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality
+                                                        valueOptions:NSPointerFunctionsStrongMemory
+                                                            capacity:0];
+        _constants = [[NSMutableArray alloc] init];
+    }
+
+    return self;
+}
+
+
+- (TWTJSONSchemaProgram *)programFromJSONSchema:(NSDictionary *)schema error:(NSError *__autoreleasing *)outError warnings:(NSArray *__autoreleasing *)outWarnings
+{
+    TWTJSONSchemaParser *parser = [[TWTJSONSchemaParser alloc] initWithJSONSchema:schema];
+    TWTJSONSchemaTopLevelASTNode *topLevelNode = [parser parseWithError:outError warnings:outWarnings];
+    if (!topLevelNode) {
+        return nil;
+    }
+
+    // The top-level schema is always the first subroutine. Referenced schemas, including remote ones, are compiled
+    // the first time they’re referenced.
+    [self subroutineForNode:topLevelNode];
+
+    NSMutableData *instructions = [[NSMutableData alloc] init];
+    NSMutableData *subroutineOffsets = [[NSMutableData alloc] initWithLength:self.subroutines.count * sizeof(uint32_t)];
+    uint32_t *offsets = subroutineOffsets.mutableBytes;
+    [self.subroutines enumerateObjectsUsingBlock:^(NSData *subroutine, NSUInteger index, BOOL *stop) {
+        offsets[index] = (uint32_t)(instructions.length / sizeof(TWTJSONSchemaInstruction));
+        [instructions appendData:subroutine];
+    }];
+
+    TWTJSONSchemaProgram *program = [[TWTJSONSchemaProgram alloc] initWithSchema:schema
+                                                                    instructions:instructions
+                                                              subroutineOffsets:subroutineOffsets
+                                                                       constants:self.constants];
+
+    // Reset properties
+    [self.subroutines removeAllObjects];
+    [self.subroutineStack removeAllObjects];
+    [self.nodesToSubroutines removeAllObjects];
+    [self.constants removeAllObjects];
+
+    return program;
+}
+
+
+#pragma mark - ASTNodeProcessor protocol methods
+
+- (void)processTopLevelNode:(TWTJSONSchemaTopLevelASTNode *)topLevelNode
+{
+    [topLevelNode.schema acceptProcessor:self];
+}
+
+
+- (void)processGenericNode:(TWTJSONSchemaGenericASTNode *)genericNode
+{
+    [self emitCommonChecksForNode:genericNode];
+
+    // "any" has no type validator, so nothing about the value’s type is checked
+    if (![genericNode.validTypes containsObject:TWTJSONSchemaTypeKeywordAny]) {
+        [self emitTypeChecksForNode:genericNode usingBlock:nil];
+    }
+}
+
+
+- (void)processArrayNode:(TWTJSONSchemaArrayASTNode *)arrayNode
+{
+    [self emitCommonChecksForNode:arrayNode];
+    [self emitTypeChecksForNode:arrayNode usingBlock:^{
+        [self emitCountChecksWithMinimum:arrayNode.minimumItemCount maximum:arrayNode.maximumItemCount];
+
+        if (arrayNode.requiresUniqueItems) {
+            [self emitInstruction:TWTJSONSchemaInstructionMake(TWTJSONSchemaOpcodeCheckUniqueItems, 0)];
+        }
+
+        if (arrayNode.itemSchema) {
+            [self emitInstruction:TWTJSONSchemaInstructionMake(TWTJSONSchemaOpcodeValidateItems, [self subroutineForNode:arrayNode.itemSchema])];
+        } else if (arrayNode.indexedItemSchemas) {
+            uint32_t additionalItemsSubroutine = [self subroutineForAdditionalNode:arrayNode.additionalItemsNode];
+            [self emitOpcode:TWTJSONSchemaOpcodeValidateIndexedItems target:additionalItemsSubroutine forSubroutinesOfNodes:arrayNode.indexedItemSchemas];
+        }
+    }];
+}
+
+
+- (void)processNumberNode:(TWTJSONSchemaNumberASTNode *)numberNode
+{
+    [self emitCommonChecksForNode:numberNode];
+    [self emitTypeChecksForNode:numberNode usingBlock:^{
+        if (numberNode.minimum || numberNode.maximum || numberNode.requireIntegralValue) {
+            TWTNumberValidator *validator = [[TWTNumberValidator alloc] initWithMinimum:numberNode.minimum maximum:numberNode.maximum];
+            validator.maximumExclusive = numberNode.exclusiveMaximum;
+            validator.minimumExclusive = numberNode.exclusiveMinimum;
+            validator.requiresIntegralValue = numberNode.requireIntegralValue;
+            [self emitCheckValidator:validator];
+        }
+
+        if (numberNode.multipleOf) {
+            TWTJSONSchemaInstruction instruction = TWTJSONSchemaInstructionMake(TWTJSONSchemaOpcodeCheckMultipleOf, 0);
+            instruction.operand.doubleValue = numberNode.multipleOf.doubleValue;
+            [self emitInstruction:instruction];
+        }
+    }];
+}
+
+
+- (void)processObjectNode:(TWTJSONSchemaObjectASTNode *)objectNode
+{
+    [self emitCommonChecksForNode:objectNode];
+    [self emitTypeChecksForNode:objectNode usingBlock:^{
+        [self emitCountChecksWithMinimum:objectNode.minimumPropertyCount maximum:objectNode.maximumPropertyCount];
+
+        if (objectNode.requiredPropertyKeys) {
+            TWTJSONSchemaInstruction instruction = TWTJSONSchemaInstructionMake(TWTJSONSchemaOpcodeCheckRequiredKeys, 0);
+            instruction.operand.index = [self indexOfConstant:objectNode.requiredPropertyKeys.allObjects];
+            [self emitInstruction:instruction];
+        }
+
+        TWTJSONSchemaPropertyTable *propertyTable = [self propertyTableForObjectNode:objectNode];
+        if (propertyTable) {
+            TWTJSONSchemaInstruction instruction = TWTJSONSchemaInstructionMake(TWTJSONSchemaOpcodeValidateProperties, 0);
+            instruction.operand.index = [self indexOfConstant:propertyTable];
+            [self emitInstruction:instruction];
+        }
+    }];
+}
+
+
+- (void)processStringNode:(TWTJSONSchemaStringASTNode *)stringNode
+{
+    [self emitCommonChecksForNode:stringNode];
+    [self emitTypeChecksForNode:stringNode usingBlock:^{
+        if (stringNode.maximumLength || stringNode.minimumLength) {
+            [self emitCheckValidator:[TWTStringValidator stringValidatorWithComposedCharacterMinimumLength:stringNode.minimumLength.unsignedIntegerValue
+                                                                                             maximumLength:stringNode.maximumLength ? stringNode.maximumLength.unsignedIntegerValue : NSUIntegerMax]];
+        }
+
+        if (stringNode.regularExpression) {
+            [self emitCheckValidator:TWTJSONSchemaStringValidatorForPattern(stringNode.regularExpression)];
+        }
+    }];
+}
+
+
+- (void)processAmbiguousNode:(TWTJSONSchemaAmbiguousASTNode *)ambiguousNode
+{
+    [self emitCommonChecksForNode:ambiguousNode];
+    [self emitTypeChecksForNode:ambiguousNode usingBlock:^{
+        [self emitOpcode:TWTJSONSchemaOpcodeCallAny target:0 forSubroutinesOfNodes:ambiguousNode.subNodes];
+    }];
+}
+
+
+- (void)processReferenceNode:(TWTJSONSchemaReferenceASTNode *)referenceNode
+{
+    [self emitCommonChecksForNode:referenceNode];
+
+    // Unresolved references are connected to no validator, which fails every value
+    if (referenceNode.referentNode) {
+        [self emitInstruction:TWTJSONSchemaInstructionMake(TWTJSONSchemaOpcodeCall, [self subroutineForNode:referenceNode.referentNode])];
+    } else {
+        [self emitOpcode:TWTJSONSchemaOpcodeFail];
+    }
+}
+
+
+- (void)processBooleanValueNode:(TWTJSONSchemaBooleanValueASTNode *)booleanValueNode
+{
+    if (!booleanValueNode.booleanValue) {
+        [self emitOpcode:TWTJSONSchemaOpcodeFail];
+    }
+}
+
+
+- (void)processNamedPropertyNode:(TWTJSONSchemaNamedPropertyASTNode *)propertyNode
+{
+    [propertyNode.valueSchema acceptProcessor:self];
+}
+
+
+- (void)processPatternPropertyNode:(TWTJSONSchemaPatternPropertyASTNode *)patternPropertyNode
+{
+    [patternPropertyNode.valueSchema acceptProcessor:self];
+}
+
+
+- (void)processDependencyNode:(TWTJSONSchemaDependencyASTNode *)dependencyNode
+{
+    if (dependencyNode.valueSchema) {
+        [dependencyNode.valueSchema acceptProcessor:self];
+    } else {
+        TWTJSONSchemaInstruction instruction = TWTJSONSchemaInstructionMake(TWTJSONSchemaOpcodeCheckRequiredKeys, 0);
+        instruction.operand.index = [self indexOfConstant:dependencyNode.propertySet.allObjects];
+        [self emitInstruction:instruction];
+    }
+}
+
+
+#pragma mark - Node-to-instruction conversion methods
+
+- (uint32_t)subroutineForNode:(TWTJSONSchemaASTNode *)node
+{
+    NSNumber *subroutine = [self.nodesToSubroutines objectForKey:node];
+    if (subroutine) {
+        return subroutine.unsignedIntValue;
+    }
+
+    // Record the subroutine before compiling the node so that recursive references to it resolve to it
+    uint32_t index = (uint32_t)self.subroutines.count;
+    [self.nodesToSubroutines setObject:@(index) forKey:node];
+
+    NSMutableData *instructions = [[NSMutableData alloc] init];
+    [self.subroutines addObject:instructions];
+    [self.subroutineStack addObject:instructions];
+    [node acceptProcessor:self];
+    [self emitOpcode:TWTJSONSchemaOpcodeSucceed];
+    [self.subroutineStack removeLastObject];
+
+    return index;
+}
+
+
+- (uint32_t)subroutineForAdditionalNode:(TWTJSONSchemaASTNode *)node
+{
+    // Additional items and properties are allowed unless they’re explicitly constrained
+    if (!node || ([node isKindOfClass:[TWTJSONSchemaBooleanValueASTNode class]] && [(TWTJSONSchemaBooleanValueASTNode *)node booleanValue])) {
+        return TWTJSONSchemaNoSubroutine;
+    }
+
+    return [self subroutineForNode:node];
+}
+
+
+- (TWTJSONSchemaPropertyTable *)propertyTableForObjectNode:(TWTJSONSchemaObjectASTNode *)objectNode
+{
+    uint32_t additionalPropertiesSubroutine = [self subroutineForAdditionalNode:objectNode.additionalPropertiesNode];
+    if (!objectNode.propertySchemas && !objectNode.patternPropertySchemas && !objectNode.propertyDependencies &&
+        additionalPropertiesSubroutine == TWTJSONSchemaNoSubroutine) {
+        return nil;
+    }
+
+    NSMutableDictionary *propertySubroutines = [[NSMutableDictionary alloc] initWithCapacity:objectNode.propertySchemas.count];
+    for (TWTJSONSchemaNamedPropertyASTNode *propertyNode in objectNode.propertySchemas) {
+        propertySubroutines[propertyNode.key] = @([self subroutineForNode:propertyNode.valueSchema]);
+    }
+
+    NSMutableArray *patternRegularExpressions = [[NSMutableArray alloc] initWithCapacity:objectNode.patternPropertySchemas.count];
+    NSMutableArray *patternSubroutines = [[NSMutableArray alloc] initWithCapacity:objectNode.patternPropertySchemas.count];
+    for (TWTJSONSchemaPatternPropertyASTNode *patternPropertyNode in objectNode.patternPropertySchemas) {
+        // If the regular expression is invalid, no properties will match it, so we can drop it entirely
+        NSRegularExpression *regularExpression = [NSRegularExpression regularExpressionWithPattern:patternPropertyNode.key options:0 error:NULL];
+        if (regularExpression) {
+            [patternRegularExpressions addObject:regularExpression];
+            [patternSubroutines addObject:@([self subroutineForNode:patternPropertyNode.valueSchema])];
+        }
+    }
+
+    NSMutableDictionary *dependencies = [[NSMutableDictionary alloc] initWithCapacity:objectNode.propertyDependencies.count];
+    for (TWTJSONSchemaDependencyASTNode *dependencyNode in objectNode.propertyDependencies) {
+        if (dependencyNode.valueSchema) {
+            dependencies[dependencyNode.key] = @([self subroutineForNode:dependencyNode.valueSchema]);
+        } else {
+            dependencies[dependencyNode.key] = dependencyNode.propertySet.allObjects;
+        }
+    }
+
+    return [[TWTJSONSchemaPropertyTable alloc] initWithPropertySubroutines:propertySubroutines
+                                                 patternRegularExpressions:patternRegularExpressions
+                                                        patternSubroutines:patternSubroutines
+                                            additionalPropertiesSubroutine:additionalPropertiesSubroutine
+                                                              dependencies:dependencies];
+}
+
+
+#pragma mark - Emitting instructions
+
+- (void)emitCommonChecksForNode:(TWTJSONSchemaASTNode *)node
+{
+    if (node.validValues) {
+        [self emitCheckValidator:[[TWTValueSetValidator alloc] initWithValidValues:node.validValues]];
+    }
+
+    [self emitOpcode:TWTJSONSchemaOpcodeCallAll target:0 forSubroutinesOfNodes:node.andSchemas];
+    [self emitOpcode:TWTJSONSchemaOpcodeCallAny target:0 forSubroutinesOfNodes:node.orSchemas];
+    [self emitOpcode:TWTJSONSchemaOpcodeCallOne target:0 forSubroutinesOfNodes:node.exactlyOneOfSchemas];
+    if (node.notSchema) {
+        [self emitOpcode:TWTJSONSchemaOpcodeCallNone target:0 forSubroutinesOfNodes:@[ node.notSchema ]];
+    }
+}
+
+
+- (void)emitTypeChecksForNode:(TWTJSONSchemaASTNode *)node usingBlock:(void (^)(void))block
+{
+    TWTJSONSchemaInstruction instruction = TWTJSONSchemaInstructionMake(TWTJSONSchemaOpcodeTestType, 0);
+    instruction.operand.typeMask = TWTJSONTypeMaskForSchemaTypes(node.validTypes);
+
+    if (node.isTypeSpecified) {
+        [self emitInstruction:instruction];
+        if (block) {
+            block();
+        }
+
+        return;
+    }
+
+    // If the type is implied, values of other types pass the type-specific keywords. Type validators always fail values
+    // of other types, so this is equivalent to the mutually exclusive type check that TWTJSONObjectValidatorGenerator uses.
+    instruction.opcode = TWTJSONSchemaOpcodeSkipUnlessType;
+    NSUInteger skipIndex = [self emitInstruction:instruction];
+    if (block) {
+        block();
+    }
+
+    TWTJSONSchemaInstruction *instructions = [self.subroutineStack.lastObject mutableBytes];
+    instructions[skipIndex].target = (uint32_t)([self.subroutineStack.lastObject length] / sizeof(TWTJSONSchemaInstruction) - skipIndex - 1);
+}
+
+
+- (void)emitCountChecksWithMinimum:(NSNumber *)minimum maximum:(NSNumber *)maximum
+{
+    if (minimum) {
+        TWTJSONSchemaInstruction instruction = TWTJSONSchemaInstructionMake(TWTJSONSchemaOpcodeCheckMinimumCount, 0);
+        instruction.operand.count = minimum.unsignedIntegerValue;
+        [self emitInstruction:instruction];
+    }
+
+    if (maximum) {
+        TWTJSONSchemaInstruction instruction = TWTJSONSchemaInstructionMake(TWTJSONSchemaOpcodeCheckMaximumCount, 0);
+        instruction.operand.count = maximum.unsignedIntegerValue;
+        [self emitInstruction:instruction];
+    }
+}
+
+
+- (void)emitCheckValidator:(TWTValidator *)validator
+{
+    TWTJSONSchemaInstruction instruction = TWTJSONSchemaInstructionMake(TWTJSONSchemaOpcodeCheckValidator, 0);
+    instruction.operand.index = [self indexOfConstant:validator];
+    [self emitInstruction:instruction];
+}
+
+
+- (void)emitOpcode:(TWTJSONSchemaOpcode)opcode target:(uint32_t)target forSubroutinesOfNodes:(NSArray *)nodes
+{
+    if (!nodes) {
+        return;
+    }
+
+    // Compile the subroutines first so that their instructions aren’t interleaved with ours
+    NSMutableArray *subroutines = [[NSMutableArray alloc] initWithCapacity:nodes.count];
+    for (TWTJSONSchemaASTNode *node in nodes) {
+        [subroutines addObject:@([self subroutineForNode:node])];
+    }
+
+    TWTJSONSchemaInstruction instruction = TWTJSONSchemaInstructionMake(opcode, target);
+    instruction.operand.count = subroutines.count;
+    [self emitInstruction:instruction];
+
+    for (NSNumber *subroutine in subroutines) {
+        [self emitInstruction:TWTJSONSchemaInstructionMake(TWTJSONSchemaOpcodeSubroutine, subroutine.unsignedIntValue)];
+    }
+}
+
+
+- (void)emitOpcode:(TWTJSONSchemaOpcode)opcode
+{
+    [self emitInstruction:TWTJSONSchemaInstructionMake(opcode, 0)];
+}
+
+
+- (NSUInteger)emitInstruction:(TWTJSONSchemaInstruction)instruction
+{
+    NSMutableData *instructions = self.subroutineStack.lastObject;
+    NSUInteger index = instructions.length / sizeof(TWTJSONSchemaInstruction);
+    [instructions appendBytes:&instruction length:sizeof(TWTJSONSchemaInstruction)];
+    return index;
+}
+
+
+- (uint32_t)indexOfConstant:(id)constant
+{
+    [self.constants addObject:constant];
+    return (uint32_t)self.constants.count - 1;
+}
+
+@end
@@ -43,4 +43,25 @@
                    indexedItemValidators:(NSArray *)indexedItemValidators
                 additionalItemsValidator:(TWTValidator *)additionalItemsValidator;
 
+// Arrays with at least this many items are split into chunks that are validated using the validation context’s
+// executor, which may validate them concurrently. Errors are still reported in item order. The default is
+// NSUIntegerMax, i.e., items are always validated serially. Only lower it if every item validator is safe to use from
+// several threads at once. The threshold may be set from any thread.
++ (NSUInteger)concurrentItemValidationThreshold;
++ (void)setConcurrentItemValidationThreshold:(NSUInteger)threshold;
+
+// Streaming validation. TWTJSONStreamingValidator uses these to validate an array as its items are read instead of
+// materializing it. Arrays that must have unique items can’t be validated this way.
+- (BOOL)supportsStreamingValidation;
+
+// Returns nil if the item at the specified index is not validated
+- (TWTValidator *)validatorForItemAtIndex:(NSUInteger)index;
+
+// Validates the array-level keywords of a streamed array given the results of validating its items. Errors have no
+// validated value, since the array is not available.
+- (BOOL)validateStreamedArrayWithItemCount:(NSUInteger)itemCount
+                            itemsValidated:(BOOL)itemsValidated
+                                itemErrors:(NSArray *)itemErrors
+                                     error:(NSError *__autoreleasing *)outError;
+
 @end
@@ -26,11 +26,25 @@
 
 #import <TWTValidation/TWTJSONSchemaArrayValidator.h>
 
+#import <stdatomic.h>
+
+#import <TWTValidation/TWTJSONSchemaKeywordConstants.h>
+#import <TWTValidation/TWTJSONType.h>
+#import <TWTValidation/TWTJSONValueEquality.h>
 #import <TWTValidation/TWTNumberValidator.h>
 #import <TWTValidation/TWTValidationErrors.h>
+#import <TWTValidation/TWTValidationExecutor.h>
 #import <TWTValidation/TWTValidationLocalization.h>
 
 
+// Concurrent validation is opt-in, since item validators may not be safe to use from several threads at once
+static atomic_ulong TWTJSONSchemaArrayValidatorConcurrentItemValidationThreshold = ATOMIC_VAR_INIT(NSUIntegerMax);
+
+// The number of items validated by each piece of work given to the context’s executor. Each chunk validates its items
+// with its own copy of the context, so chunks should be large enough to make copying the context worthwhile.
+static const NSUInteger TWTJSONSchemaArrayValidatorItemsPerChunk = 256;
+
+
 @interface TWTJSONSchemaArrayValidator ()
 
 @property (nonatomic, strong, readonly) TWTNumberValidator *countValidator;
@@ -98,14 +112,29 @@
 
 - (BOOL)validateValue:(id)value error:(out NSError *__autoreleasing *)outError
 {
-    if (![super validateValue:value error:outError]) {
-        return NO;
-    } else if (![value isKindOfClass:[NSArray class]]) {
+    return [self validateValue:value context:nil error:outError];
+}
+
+
+- (BOOL)validateValue:(id)value context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
+    return [self validateJSONValue:value ofType:TWTJSONTypeOfValue(value) context:context error:outError];
+}
+
+
+- (BOOL)validateJSONValue:(id)value ofType:(TWTJSONType)type context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
+    if (type != TWTJSONTypeArray) {
+        // Let super report nil and null values
+        if (![super validateValue:value error:outError]) {
+            return NO;
+        }
+
         if (outError) {
             *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueHasIncorrectClass
                                             failingValidator:self
                                                        value:value
-                                        localizedDescription:TWTLocalizedString(@"TWTJSONSchemaArrayValidator.notArrayError")];
+                                   localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTJSONSchemaArrayValidator.notArrayError"); }];
         }
         return NO;
     }
@@ -117,62 +146,51 @@
 
     NSError *countError = nil;
     NSError *uniqueItemsError = nil;
-    NSError *error = nil;
     NSMutableArray *itemErrors = outError ? [[NSMutableArray alloc] init] : nil;
 
     if (self.countValidator) {
-        countValidated = [self.countValidator validateValue:@([value count]) error:&countError];
+        countValidated = TWTValidatorValidateCount(self.countValidator, [value count], outError ? &countError : NULL);
     }
 
-    if (self.requiresUniqueItems) {
-        NSCountedSet *itemSet = [[NSCountedSet alloc] initWithArray:value];
-        NSSet *repeats = [itemSet objectsPassingTest:^BOOL(id object, BOOL *stop) {
-            return [itemSet countForObject:object] > 1;
-        }];
-        if (repeats.count > 0) {
-            uniqueItemsValidated = NO;
+    // In fail-fast mode, stop validating as soon as any keyword fails
+    BOOL failsFast = TWTValidationContextIsFailFastModeEnabled(context);
+
+    if (self.requiresUniqueItems && (countValidated || !failsFast)) {
+        uniqueItemsValidated = TWTJSONArrayHasUniqueItems(value);
+        if (!uniqueItemsValidated && outError) {
             uniqueItemsError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeNotUniqueElements
                                                    failingValidator:self
                                                               value:value
-                                               localizedDescription:TWTLocalizedString(@"TWTJSONSchemaArrayValidator.nonUniqueItems.validationError")];
+                                          localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTJSONSchemaArrayValidator.nonUniqueItems.validationError"); }];
         }
     }
 
-    if (self.itemValidator) {
-        for (id item in value) {
-            error = nil;
-            if (![self.itemValidator validateValue:item error:outError ? &error : NULL]) {
-                itemsValidated = NO;
-                if (error) {
-                    [itemErrors addObject:error];
-                }
-            }
-        }
-    } else if (self.indexedItemValidators) {
-        NSUInteger index = 0;
-        for (id item in value) {
-            error = nil;
-
-            if (index < self.indexedItemValidators.count) {
-                if (![self.indexedItemValidators[index] validateValue:item error:outError ? &error : NULL]) {
-                    itemsValidated = NO;
-                    if (error) {
-                        [itemErrors addObject:error];
-                    }
-                }
-            } else {
-                if (![self.additionalItemsValidator validateValue:item error:outError ? &error : NULL]) {
-                    additionalItemsValidated = NO;
-                    if (error) {
-                        [itemErrors addObject:error];
-                    }
-                }
-            }
-            index++;
+    BOOL validatesItems = (countValidated && uniqueItemsValidated) || !failsFast;
+    if (validatesItems && (self.itemValidator || self.indexedItemValidators)) {
+        NSUInteger itemCount = [value count];
+        NSUInteger chunkCount = (itemCount + TWTJSONSchemaArrayValidatorItemsPerChunk - 1) / TWTJSONSchemaArrayValidatorItemsPerChunk;
+        TWTValidationExecutor *executor = TWTValidationContextExecutor(context);
+        if (!failsFast && itemCount >= [TWTJSONSchemaArrayValidator concurrentItemValidationThreshold] &&
+            [executor shouldExecuteConcurrentlyWithCount:chunkCount]) {
+            [self concurrentlyValidateItems:value
+                                 chunkCount:chunkCount
+                                   executor:executor
+                                    context:context
+                                     errors:itemErrors
+                             itemsValidated:&itemsValidated
+                   additionalItemsValidated:&additionalItemsValidated];
+        } else {
+            atomic_bool shouldStop = ATOMIC_VAR_INIT(false);
+            [self validateItems:value
+                        inRange:NSMakeRange(0, itemCount)
+                        context:context
+                         errors:itemErrors
+                 itemsValidated:&itemsValidated
+       additionalItemsValidated:&additionalItemsValidated
+                     shouldStop:&shouldStop];
         }
     }
 
-
     BOOL validated = countValidated && uniqueItemsValidated && itemsValidated && additionalItemsValidated;
     if (!validated && outError) {
         if (!countValidated) {
@@ -186,12 +204,198 @@
         *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeJSONSchemaArrayValidatorError
                                         failingValidator:self
                                                    value:value
-                                    localizedDescription:TWTLocalizedString(@"TWTJSONSchemaArrayValidator.validationError")
+                               localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTJSONSchemaArrayValidator.validationError"); }
                                         underlyingErrors:itemErrors];
+        *outError = TWTValidationContextErrorByMarkingTruncation(context, *outError);
     }
     
     return validated;
 }
 
 
+- (void)validateItems:(NSArray *)items
+                 inRange:(NSRange)range
+                 context:(TWTValidationContext *)context
+                  errors:(NSMutableArray *)errors
+          itemsValidated:(BOOL *)outItemsValidated
+additionalItemsValidated:(BOOL *)outAdditionalItemsValidated
+              shouldStop:(atomic_bool *)shouldStop
+{
+    // shouldStop is only set in fail-fast mode or when the deadline passes
+    BOOL failsFast = TWTValidationContextIsFailFastModeEnabled(context);
+    for (NSUInteger index = range.location; index < NSMaxRange(range); ++index) {
+        if (atomic_load_explicit(shouldStop, memory_order_relaxed)) {
+            break;
+        } else if ([context isPastDeadline]) {
+            *outItemsValidated = NO;
+            [errors addObject:[context deadlineExceededErrorWithFailingValidator:self value:items]];
+            atomic_store_explicit(shouldStop, true, memory_order_relaxed);
+            break;
+        }
+
+        BOOL isAdditionalItem = NO;
+        TWTValidator *validator = [self validatorForItemAtIndex:index isAdditionalItem:&isAdditionalItem];
+
+        TWTValidationPathFrame frame;
+        if (isAdditionalItem) {
+            frame = TWTValidationPathFrameMakeWithIndex(index, TWTJSONSchemaKeywordAdditionalItems, NSNotFound);
+        } else {
+            frame = TWTValidationPathFrameMakeWithIndex(index, TWTJSONSchemaKeywordItems, self.itemValidator ? NSNotFound : index);
+        }
+
+        [context pushPathFrame:&frame];
+
+        NSError *error = nil;
+        BOOL validated = TWTValidationContextValidateValue(context, validator, items[index], errors ? &error : NULL);
+        if (!validated && error) {
+            error = TWTValidationContextErrorByAddingCurrentPaths(context, error);
+        }
+
+        [context popPathFrame];
+
+        if (!validated) {
+            if (isAdditionalItem) {
+                *outAdditionalItemsValidated = NO;
+            } else {
+                *outItemsValidated = NO;
+            }
+
+            if (error) {
+                [errors addObject:error];
+            }
+
+            if (failsFast) {
+                atomic_store_explicit(shouldStop, true, memory_order_relaxed);
+                break;
+            }
+        }
+    }
+}
+
+
+- (void)concurrentlyValidateItems:(NSArray *)items
+                       chunkCount:(NSUInteger)chunkCount
+                         executor:(TWTValidationExecutor *)executor
+                          context:(TWTValidationContext *)context
+                           errors:(NSMutableArray *)errors
+                   itemsValidated:(BOOL *)outItemsValidated
+         additionalItemsValidated:(BOOL *)outAdditionalItemsValidated
+{
+    NSUInteger itemCount = items.count;
+
+    // Each chunk writes only to its own results and error array, so no locking is necessary. Merging the error arrays
+    // in chunk order afterward keeps errors in index order, just as if we’d validated the items serially.
+    BOOL *chunkItemsValidated = malloc(chunkCount * sizeof(BOOL));
+    BOOL *chunkAdditionalItemsValidated = malloc(chunkCount * sizeof(BOOL));
+    NSMutableArray *chunkErrors = errors ? [[NSMutableArray alloc] initWithCapacity:chunkCount] : nil;
+    for (NSUInteger chunk = 0; chunk < chunkCount; ++chunk) {
+        chunkItemsValidated[chunk] = YES;
+        chunkAdditionalItemsValidated[chunk] = YES;
+        [chunkErrors addObject:[[NSMutableArray alloc] init]];
+    }
+
+    // Items are only validated concurrently outside of fail-fast mode, so chunks only stop early when the deadline passes
+    atomic_bool shouldStop = ATOMIC_VAR_INIT(false);
+    atomic_bool *shouldStopPointer = &shouldStop;
+
+    [executor executeCount:chunkCount block:^(NSUInteger chunk) {
+        NSUInteger location = chunk * TWTJSONSchemaArrayValidatorItemsPerChunk;
+
+        // Contexts may only be used on one thread at a time, so each chunk gets its own
+        [self validateItems:items
+                    inRange:NSMakeRange(location, MIN(TWTJSONSchemaArrayValidatorItemsPerChunk, itemCount - location))
+                    context:[context copy]
+                     errors:chunkErrors[chunk]
+             itemsValidated:&chunkItemsValidated[chunk]
+   additionalItemsValidated:&chunkAdditionalItemsValidated[chunk]
+                 shouldStop:shouldStopPointer];
+    }];
+
+    for (NSUInteger chunk = 0; chunk < chunkCount; ++chunk) {
+        *outItemsValidated = *outItemsValidated && chunkItemsValidated[chunk];
+        *outAdditionalItemsValidated = *outAdditionalItemsValidated && chunkAdditionalItemsValidated[chunk];
+        [errors addObjectsFromArray:chunkErrors[chunk]];
+    }
+
+    free(chunkItemsValidated);
+    free(chunkAdditionalItemsValidated);
+}
+
+
+- (TWTValidator *)validatorForItemAtIndex:(NSUInteger)index isAdditionalItem:(BOOL *)outIsAdditionalItem
+{
+    if (!self.itemValidator && !self.indexedItemValidators) {
+        return nil;
+    }
+
+    // If there is an item validator, it validates all items. Otherwise, items without an indexed validator are additional
+    BOOL isAdditionalItem = !self.itemValidator && index >= self.indexedItemValidators.count;
+    if (outIsAdditionalItem) {
+        *outIsAdditionalItem = isAdditionalItem;
+    }
+
+    if (self.itemValidator) {
+        return self.itemValidator;
+    }
+
+    return isAdditionalItem ? self.additionalItemsValidator : self.indexedItemValidators[index];
+}
+
+
+#pragma mark - Streaming
+
+- (BOOL)supportsStreamingValidation
+{
+    return !self.requiresUniqueItems;
+}
+
+
+- (TWTValidator *)validatorForItemAtIndex:(NSUInteger)index
+{
+    return [self validatorForItemAtIndex:index isAdditionalItem:NULL];
+}
+
+
+- (BOOL)validateStreamedArrayWithItemCount:(NSUInteger)itemCount
+                            itemsValidated:(BOOL)itemsValidated
+                                itemErrors:(NSArray *)itemErrors
+                                     error:(NSError *__autoreleasing *)outError
+{
+    BOOL countValidated = YES;
+    NSError *countError = nil;
+    if (self.countValidator) {
+        countValidated = TWTValidatorValidateCount(self.countValidator, itemCount, outError ? &countError : NULL);
+    }
+
+    BOOL validated = countValidated && itemsValidated;
+    if (!validated && outError) {
+        NSMutableArray *errors = [[NSMutableArray alloc] initWithArray:itemErrors];
+        if (!countValidated) {
+            [errors addObject:countError];
+        }
+
+        *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeJSONSchemaArrayValidatorError
+                                        failingValidator:self
+                                                   value:nil
+                               localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTJSONSchemaArrayValidator.validationError"); }
+                                        underlyingErrors:errors];
+    }
+
+    return validated;
+}
+
+
+#pragma mark - Concurrency
+
++ (NSUInteger)concurrentItemValidationThreshold
+{
+    return atomic_load_explicit(&TWTJSONSchemaArrayValidatorConcurrentItemValidationThreshold, memory_order_relaxed);
+}
+
+
++ (void)setConcurrentItemValidationThreshold:(NSUInteger)threshold
+{
+    atomic_store_explicit(&TWTJSONSchemaArrayValidatorConcurrentItemValidationThreshold, threshold, memory_order_relaxed);
+}
+
 @end
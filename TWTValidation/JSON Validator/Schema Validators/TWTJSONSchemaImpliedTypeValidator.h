@@ -0,0 +1,46 @@
+//
+//  TWTJSONSchemaImpliedTypeValidator.h
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTJSONType.h>
+
+
+// Validates values of the implied types using a type validator and passes values of all other types. This is how a
+// schema whose type is implied by its keywords treats its type-specific keywords. TWTJSONObjectValidatorGenerator uses
+// it in place of the equivalent mutually exclusive type check when it simplifies validators.
+@interface TWTJSONSchemaImpliedTypeValidator : TWTValidator <NSCopying>
+
+@property (nonatomic, assign, readonly) TWTJSONTypeMask impliedTypes;
+
+// Must fail values that are not of the implied types
+@property (nonatomic, strong, readonly) TWTValidator *typeValidator;
+
+// There are no sensible default implied types or type validator, so one of each must be given
+- (instancetype)init NS_UNAVAILABLE;
+
+// impliedTypes may not be 0, and typeValidator may not be nil
+- (instancetype)initWithImpliedTypes:(TWTJSONTypeMask)impliedTypes typeValidator:(TWTValidator *)typeValidator;
+
+@end
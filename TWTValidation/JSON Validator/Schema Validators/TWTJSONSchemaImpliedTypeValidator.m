@@ -0,0 +1,88 @@
+//
+//  TWTJSONSchemaImpliedTypeValidator.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTJSONSchemaImpliedTypeValidator.h>
+
+
+@implementation TWTJSONSchemaImpliedTypeValidator
+
+- (instancetype)initWithImpliedTypes:(TWTJSONTypeMask)impliedTypes typeValidator:(TWTValidator *)typeValidator
+{
+    NSParameterAssert(impliedTypes);
+    NSParameterAssert(typeValidator);
+
+    self = [super init];
+    if (self) {
+        _impliedTypes = impliedTypes;
+        _typeValidator = typeValidator;
+    }
+    return self;
+}
+
+
+- (NSUInteger)hash
+{
+    return [super hash] ^ self.impliedTypes ^ self.typeValidator.hash;
+}
+
+
+- (BOOL)isEqual:(id)object
+{
+    if (![super isEqual:object]) {
+        return NO;
+    } else if (self == object) {
+        return YES;
+    }
+
+    typeof(self) other = object;
+    return other.impliedTypes == self.impliedTypes &&
+        (other.typeValidator == self.typeValidator || [other.typeValidator isEqual:self.typeValidator]);
+}
+
+
+- (BOOL)validateValue:(id)value error:(out NSError *__autoreleasing *)outError
+{
+    return [self validateValue:value context:nil error:outError];
+}
+
+
+- (BOOL)validateValue:(id)value context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
+    // Does not call super because values of other types, including NULL, are always valid
+    return [self validateJSONValue:value ofType:TWTJSONTypeOfValue(value) context:context error:outError];
+}
+
+
+- (BOOL)validateJSONValue:(id)value ofType:(TWTJSONType)type context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
+    if (!TWTJSONTypeMaskContainsType(self.impliedTypes, type)) {
+        return YES;
+    }
+
+    return [self.typeValidator validateJSONValue:value ofType:type context:context error:outError];
+}
+
+@end
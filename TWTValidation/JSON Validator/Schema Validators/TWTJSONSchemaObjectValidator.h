@@ -34,7 +34,7 @@
 @property (nonatomic, copy, readonly) NSSet *requiredPropertyKeys;
 @property (nonatomic, copy, readonly) NSArray *propertyValidators;
 @property (nonatomic, copy, readonly) NSArray *patternPropertyValidators;
-// either always passing, always failing, or a JSONObjectValidator
+// either always passing, always failing, or a JSONObjectValidator; if nil, additional properties are not allowed
 @property (nonatomic, strong, readonly) TWTValidator *additionalPropertiesValidator;
 @property (nonatomic, copy, readonly) NSDictionary *propertyDependencies;
 
@@ -47,4 +47,24 @@
                additionalPropertiesValidator:(TWTValidator *)additionalPropertiesValidator
                         propertyDependencies:(NSDictionary *)propertyDependencies;
 
+// Streaming validation. TWTJSONStreamingValidator uses these to validate an object as its properties are read instead
+// of materializing it. Objects with schema dependencies can’t be validated this way.
+- (BOOL)supportsStreamingValidation;
+
+// Returns the validators for the value of the property with the specified key in the order they are applied
+- (NSArray *)validatorsForPropertyWithKey:(NSString *)key;
+
+// Returns whether validating a streamed object depends on whether it contains the specified key. Streaming validators
+// need only count the object’s other keys.
+- (BOOL)presenceOfKeyAffectsStreamedObjectValidation:(NSString *)key;
+
+// Validates the object-level keywords of a streamed object given the number of keys it contains, the keys it contains
+// whose presence affects its validation, and the results of validating its property values. Errors have no validated
+// value, since the object is not available.
+- (BOOL)validateStreamedObjectWithKeyCount:(NSUInteger)keyCount
+                               presentKeys:(NSSet *)presentKeys
+                       propertiesValidated:(BOOL)propertiesValidated
+                            propertyErrors:(NSArray *)propertyErrors
+                                     error:(NSError *__autoreleasing *)outError;
+
 @end
@@ -26,16 +26,377 @@
 
 #import <TWTValidation/TWTJSONSchemaObjectValidator.h>
 
+#import <TWTValidation/TWTBlockValidator.h>
+#import <TWTValidation/TWTJSONSchemaKeywordConstants.h>
+#import <TWTValidation/TWTJSONType.h>
+#import <TWTValidation/TWTKeyIndexTable.h>
 #import <TWTValidation/TWTKeyedCollectionValidator.h>
 #import <TWTValidation/TWTNumberValidator.h>
 #import <TWTValidation/TWTValidationErrors.h>
 #import <TWTValidation/TWTValidationLocalization.h>
 
 
+/*!
+ The maximum number of keys whose pattern property matches are cached by a TWTJSONSchemaPatternPropertyMatcher.
+ */
+static const NSUInteger TWTJSONSchemaPatternPropertyMatcherCacheCountLimit = 1024;
+
+
+/*!
+ TWTJSONSchemaPatternPropertyMatchers determine which pattern property validators apply to a given key. Each pattern is
+ compiled once when the matcher is created. When there is more than one pattern, they are also combined into a single
+ alternation so that keys that match no pattern can be rejected with one regular expression search. The matching validators
+ for each key are cached, so repeated keys cost a single hash lookup.
+ */
+@interface TWTJSONSchemaPatternPropertyMatcher : NSObject
+
+/*!
+ @abstract Initializes a newly created matcher with the specified pattern property validators.
+ @discussion Validators whose keys are not valid regular expressions are ignored, as no key can match them.
+ @param patternPropertyValidators The TWTKeyValuePairValidators whose keys are regular expression patterns.
+ @result An initialized pattern property matcher.
+ */
+- (instancetype)initWithPatternPropertyValidators:(NSArray *)patternPropertyValidators;
+
+/*!
+ @abstract Returns the pattern property validators whose patterns match the specified key.
+ @param key The property key.
+ @result The matching validators in the order in which they were given to the matcher. Returns an empty array if no
+     patterns match.
+ */
+- (NSArray *)validatorsMatchingKey:(NSString *)key;
+
+@end
+
+
+#pragma mark
+
+@interface TWTJSONSchemaPatternPropertyMatcher ()
+
+@property (nonatomic, copy, readonly) NSArray *patternPropertyValidators;
+@property (nonatomic, copy, readonly) NSArray *regularExpressions;
+@property (nonatomic, strong, readonly) NSRegularExpression *combinedRegularExpression;
+@property (nonatomic, strong, readonly) NSCache *matchingValidatorsByKey;
+
+@end
+
+
+@implementation TWTJSONSchemaPatternPropertyMatcher
+
+- (instancetype)init
+{
+    return [self initWithPatternPropertyValidators:nil];
+}
+
+
+- (instancetype)initWithPatternPropertyValidators:(NSArray *)patternPropertyValidators
+{
+    self = [super init];
+    if (self) {
+        NSMutableArray *validators = [[NSMutableArray alloc] initWithCapacity:patternPropertyValidators.count];
+        NSMutableArray *regularExpressions = [[NSMutableArray alloc] initWithCapacity:patternPropertyValidators.count];
+        NSMutableArray *patterns = [[NSMutableArray alloc] initWithCapacity:patternPropertyValidators.count];
+        BOOL canCombinePatterns = YES;
+
+        for (TWTKeyValuePairValidator *patternValidator in patternPropertyValidators) {
+            // If the regular expression is invalid, no properties will match it, so we can drop it entirely
+            NSRegularExpression *regularExpression = [NSRegularExpression regularExpressionWithPattern:patternValidator.key options:0 error:NULL];
+            if (!regularExpression) {
+                continue;
+            }
+
+            [validators addObject:patternValidator];
+            [regularExpressions addObject:regularExpression];
+            [patterns addObject:[NSString stringWithFormat:@"(?:%@)", patternValidator.key]];
+
+            // Back references are numbered across the whole expression, so patterns that use them can’t be combined
+            if (regularExpression.numberOfCaptureGroups > 0 && [patternValidator.key rangeOfString:@"\\\\[1-9k]" options:NSRegularExpressionSearch].location != NSNotFound) {
+                canCombinePatterns = NO;
+            }
+        }
+
+        _patternPropertyValidators = [validators copy];
+        _regularExpressions = [regularExpressions copy];
+
+        if (canCombinePatterns && patterns.count > 1) {
+            _combinedRegularExpression = [NSRegularExpression regularExpressionWithPattern:[patterns componentsJoinedByString:@"|"] options:0 error:NULL];
+        }
+
+        _matchingValidatorsByKey = [[NSCache alloc] init];
+        _matchingValidatorsByKey.countLimit = TWTJSONSchemaPatternPropertyMatcherCacheCountLimit;
+    }
+
+    return self;
+}
+
+
+- (NSArray *)validatorsMatchingKey:(NSString *)key
+{
+    if (!self.regularExpressions.count) {
+        return @[ ];
+    }
+
+    NSArray *matchingValidators = [self.matchingValidatorsByKey objectForKey:key];
+    if (matchingValidators) {
+        return matchingValidators;
+    }
+
+    NSRange keyRange = NSMakeRange(0, key.length);
+    if (self.combinedRegularExpression && [self.combinedRegularExpression rangeOfFirstMatchInString:key options:0 range:keyRange].location == NSNotFound) {
+        matchingValidators = @[ ];
+    } else {
+        NSMutableArray *validators = [[NSMutableArray alloc] initWithCapacity:self.regularExpressions.count];
+        [self.regularExpressions enumerateObjectsUsingBlock:^(NSRegularExpression *regularExpression, NSUInteger index, BOOL *stop) {
+            if ([regularExpression rangeOfFirstMatchInString:key options:0 range:keyRange].location != NSNotFound) {
+                [validators addObject:self.patternPropertyValidators[index]];
+            }
+        }];
+
+        matchingValidators = [validators copy];
+    }
+
+    [self.matchingValidatorsByKey setObject:matchingValidators forKey:[key copy]];
+    return matchingValidators;
+}
+
+@end
+
+
+#pragma mark
+
+/*!
+ TWTJSONSchemaObjectPropertySlots describe how a TWTJSONSchemaObjectValidator validates a key named by its schema.
+ Their objects are retained by the property table that contains them.
+ */
+typedef struct _TWTJSONSchemaObjectPropertySlot {
+    __unsafe_unretained NSString *key;
+
+    // The validator for the key’s property, or nil if the key isn’t in properties
+    __unsafe_unretained TWTKeyValuePairValidator *propertyValidator;
+
+    // The pattern property validators whose patterns match the key
+    __unsafe_unretained NSArray *patternValidators;
+
+    // Either a set of keys that must be present or a validator for the entire object, or nil if the key has no dependency
+    __unsafe_unretained id dependency;
+    BOOL dependencyIsKeySet;
+
+    BOOL isRequired;
+
+    // Whether the additional properties validator applies to the key, i.e., whether no property or pattern property does
+    BOOL isAdditionalProperty;
+} TWTJSONSchemaObjectPropertySlot;
+
+
+/*!
+ TWTJSONSchemaObjectPropertyTables map every key named by an object schema’s properties, required, and dependencies
+ keywords to a slot that describes how to validate it, so that each of an object’s properties can be validated with
+ a single lookup in a key index table. Lookups usually take one or two probes.
+ */
+@interface TWTJSONSchemaObjectPropertyTable : NSObject {
+@public
+    TWTJSONSchemaObjectPropertySlot *_slots;
+    NSUInteger _slotCount;
+    NSUInteger _requiredKeyCount;
+
+    // Maps each key to the index of its slot
+    TWTKeyIndexTable *_keyIndexTable;
+}
+
+/*!
+ @abstract Initializes a newly allocated property table with the specified object schema keywords.
+ @param propertyValidators The TWTKeyValuePairValidators for the schema’s named properties.
+ @param requiredPropertyKeys The keys that objects must contain.
+ @param propertyDependencies The schema’s dependencies.
+ @param patternPropertyMatcher The matcher for the schema’s pattern properties. May be nil.
+ @result An initialized property table.
+ */
+- (instancetype)initWithPropertyValidators:(NSArray *)propertyValidators
+                      requiredPropertyKeys:(NSSet *)requiredPropertyKeys
+                      propertyDependencies:(NSDictionary *)propertyDependencies
+                    patternPropertyMatcher:(TWTJSONSchemaPatternPropertyMatcher *)patternPropertyMatcher;
+
+@end
+
+
+/*!
+ @abstract Returns the slot for the specified key in a property table.
+ @param table The property table.
+ @param key The key.
+ @result The key’s slot, or NULL if the table has no slot for the key.
+ */
+static inline const TWTJSONSchemaObjectPropertySlot *TWTJSONSchemaObjectPropertyTableSlotForKey(__unsafe_unretained TWTJSONSchemaObjectPropertyTable *table, NSString *key)
+{
+    NSUInteger slotIndex = TWTKeyIndexTableIndexOfKey(table->_keyIndexTable, key);
+    return slotIndex != NSNotFound ? &table->_slots[slotIndex] : NULL;
+}
+
+
+@interface TWTJSONSchemaObjectPropertyTable ()
+
+// The objects that slots refer to
+@property (nonatomic, copy, readonly) NSArray *slotObjects;
+
+@end
+
+
+@implementation TWTJSONSchemaObjectPropertyTable
+
+- (instancetype)init
+{
+    return [self initWithPropertyValidators:nil requiredPropertyKeys:nil propertyDependencies:nil patternPropertyMatcher:nil];
+}
+
+
+- (instancetype)initWithPropertyValidators:(NSArray *)propertyValidators
+                      requiredPropertyKeys:(NSSet *)requiredPropertyKeys
+                      propertyDependencies:(NSDictionary *)propertyDependencies
+                    patternPropertyMatcher:(TWTJSONSchemaPatternPropertyMatcher *)patternPropertyMatcher
+{
+    self = [super init];
+    if (self) {
+        NSMutableOrderedSet *keys = [[NSMutableOrderedSet alloc] init];
+        NSMutableDictionary *propertyValidatorsByKey = [[NSMutableDictionary alloc] initWithCapacity:propertyValidators.count];
+        for (TWTKeyValuePairValidator *propertyValidator in propertyValidators) {
+            [keys addObject:propertyValidator.key];
+            propertyValidatorsByKey[propertyValidator.key] = propertyValidator;
+        }
+
+        [keys addObjectsFromArray:requiredPropertyKeys.allObjects];
+        [keys addObjectsFromArray:propertyDependencies.allKeys];
+
+        NSMutableArray *slotObjects = [[NSMutableArray alloc] initWithCapacity:keys.count * 4];
+        _slotCount = keys.count;
+        _slots = calloc(MAX(_slotCount, 1), sizeof(TWTJSONSchemaObjectPropertySlot));
+
+        NSUInteger slotIndex = 0;
+        for (NSString *key in keys) {
+            TWTKeyValuePairValidator *propertyValidator = propertyValidatorsByKey[key];
+            NSArray *patternValidators = [patternPropertyMatcher validatorsMatchingKey:key] ?: @[ ];
+            id dependency = propertyDependencies[key];
+
+            [slotObjects addObject:key];
+            [slotObjects addObject:patternValidators];
+            if (propertyValidator) {
+                [slotObjects addObject:propertyValidator];
+            }
+
+            if (dependency) {
+                [slotObjects addObject:dependency];
+            }
+
+            TWTJSONSchemaObjectPropertySlot *slot = &_slots[slotIndex++];
+            slot->key = key;
+            slot->propertyValidator = propertyValidator;
+            slot->patternValidators = patternValidators;
+            slot->dependency = dependency;
+            slot->dependencyIsKeySet = [dependency isKindOfClass:[NSSet class]];
+            slot->isRequired = [requiredPropertyKeys containsObject:key];
+            slot->isAdditionalProperty = !propertyValidator && patternValidators.count == 0;
+
+            if (slot->isRequired) {
+                ++_requiredKeyCount;
+            }
+        }
+
+        _slotObjects = [slotObjects copy];
+        _keyIndexTable = [[TWTKeyIndexTable alloc] initWithKeys:keys.array];
+    }
+
+    return self;
+}
+
+
+- (void)dealloc
+{
+    free(_slots);
+}
+
+@end
+
+
+#pragma mark
+
+/*!
+ TWTJSONSchemaObjectPropertyValidationResults accumulate the results of validating the properties of a JSON object.
+ They are only created when errors are being collected or properties are validated concurrently, so validating a
+ valid object without an error pointer doesn’t allocate any. When properties are validated concurrently, each
+ property’s results are accumulated separately and then added to the results for the entire object in key order.
+ */
+@interface TWTJSONSchemaObjectPropertyValidationResults : NSObject
+
+// Whether every property keyword and dependency validated
+@property (nonatomic, assign) BOOL propertiesValidated;
+
+// These are nil if errors are not being collected
+@property (nonatomic, strong, readonly) NSMutableArray *propertiesErrors;
+@property (nonatomic, strong, readonly) NSMutableArray *dependenciesErrors;
+
+/*!
+ @abstract Initializes a newly allocated results object in which every property has validated.
+ @param collectsErrors Whether the results object should collect errors.
+ @result An initialized results object.
+ */
+- (instancetype)initWithCollectsErrors:(BOOL)collectsErrors;
+
+/*!
+ @abstract Adds the specified results to the receiver’s.
+ @param results The results to add.
+ */
+- (void)addResults:(TWTJSONSchemaObjectPropertyValidationResults *)results;
+
+@end
+
+
+@implementation TWTJSONSchemaObjectPropertyValidationResults
+
+- (instancetype)init
+{
+    return [self initWithCollectsErrors:NO];
+}
+
+
+- (instancetype)initWithCollectsErrors:(BOOL)collectsErrors
+{
+    self = [super init];
+    if (self) {
+        _propertiesValidated = YES;
+
+        if (collectsErrors) {
+            _propertiesErrors = [[NSMutableArray alloc] init];
+            _dependenciesErrors = [[NSMutableArray alloc] init];
+        }
+    }
+
+    return self;
+}
+
+
+- (void)addResults:(TWTJSONSchemaObjectPropertyValidationResults *)results
+{
+    self.propertiesValidated &= results.propertiesValidated;
+    [self.propertiesErrors addObjectsFromArray:results.propertiesErrors];
+    [self.dependenciesErrors addObjectsFromArray:results.dependenciesErrors];
+}
+
+@end
+
+
+#pragma mark
+
 @interface TWTJSONSchemaObjectValidator ()
 
 @property (nonatomic, strong, readonly) TWTNumberValidator *countValidator;
-@property (nonatomic, strong, readonly) NSDictionary *propertyAndValidators;
+@property (nonatomic, strong, readonly) TWTJSONSchemaPatternPropertyMatcher *patternPropertyMatcher;
+@property (nonatomic, strong, readonly) TWTJSONSchemaObjectPropertyTable *propertyTable;
+
+// Whether additional properties are always allowed, in which case they aren’t validated at all. The validator
+// generator sets this for schemas whose additionalProperties is true.
+@property (nonatomic, assign, readonly) BOOL allowsAllAdditionalProperties;
+
+// The keys whose presence affects the validation of a streamed object: the required keys and the keys named by
+// dependencies
+@property (nonatomic, copy, readonly) NSSet *streamedObjectPresenceKeys;
 
 @end
 
@@ -49,6 +410,26 @@
                    patternPropertyValidators:(NSArray *)patternPropertyValidators
                additionalPropertiesValidator:(TWTValidator *)additionalPropertiesValidator
                         propertyDependencies:(NSDictionary *)propertyDependencies
+{
+    return [self initWithMinimumPropertyCount:minimumPropertyCount
+                         maximumPropertyCount:maximumPropertyCount
+                         requiredPropertyKeys:requiredPropertyKeys
+                           propertyValidators:propertyValidators
+                    patternPropertyValidators:patternPropertyValidators
+                additionalPropertiesValidator:additionalPropertiesValidator
+                allowsAllAdditionalProperties:NO
+                         propertyDependencies:propertyDependencies];
+}
+
+
+- (instancetype)initWithMinimumPropertyCount:(NSNumber *)minimumPropertyCount
+                        maximumPropertyCount:(NSNumber *)maximumPropertyCount
+                        requiredPropertyKeys:(NSSet *)requiredPropertyKeys
+                          propertyValidators:(NSArray *)propertyValidators
+                   patternPropertyValidators:(NSArray *)patternPropertyValidators
+               additionalPropertiesValidator:(TWTValidator *)additionalPropertiesValidator
+               allowsAllAdditionalProperties:(BOOL)allowsAllAdditionalProperties
+                        propertyDependencies:(NSDictionary *)propertyDependencies
 {
     self = [super init];
     if (self) {
@@ -58,14 +439,29 @@
         _propertyValidators = [propertyValidators copy];
         _patternPropertyValidators = [patternPropertyValidators copy];
         _additionalPropertiesValidator = [additionalPropertiesValidator copy];
+        _allowsAllAdditionalProperties = allowsAllAdditionalProperties;
         _propertyDependencies = [propertyDependencies copy];
 
-        //  Make property validators accessible by their key
-        NSMutableDictionary *propertyValidatorsByKey = [[NSMutableDictionary alloc] init];
-        for (TWTKeyValuePairValidator *pairValidator in propertyValidators) {
-            [propertyValidatorsByKey setObject:pairValidator forKey:pairValidator.key];
+        // Compile the pattern property regular expressions once instead of on every validation
+        if (patternPropertyValidators.count) {
+            _patternPropertyMatcher = [[TWTJSONSchemaPatternPropertyMatcher alloc] initWithPatternPropertyValidators:patternPropertyValidators];
         }
-        _propertyAndValidators = [propertyValidatorsByKey copy];
+
+        // Compile everything we know about each key named by the schema into a single table
+        _propertyTable = [[TWTJSONSchemaObjectPropertyTable alloc] initWithPropertyValidators:_propertyValidators
+                                                                         requiredPropertyKeys:_requiredPropertyKeys
+                                                                         propertyDependencies:_propertyDependencies
+                                                                       patternPropertyMatcher:_patternPropertyMatcher];
+
+        NSMutableSet *streamedObjectPresenceKeys = [[NSMutableSet alloc] initWithSet:_requiredPropertyKeys ?: [NSSet set]];
+        [_propertyDependencies enumerateKeysAndObjectsUsingBlock:^(NSString *key, id dependency, BOOL *stop) {
+            [streamedObjectPresenceKeys addObject:key];
+            if ([dependency isKindOfClass:[NSSet class]]) {
+                [streamedObjectPresenceKeys unionSet:dependency];
+            }
+        }];
+
+        _streamedObjectPresenceKeys = [streamedObjectPresenceKeys copy];
 
         if (minimumPropertyCount || maximumPropertyCount) {
             _countValidator = [[TWTNumberValidator alloc] initWithMinimum:minimumPropertyCount maximum:maximumPropertyCount];
@@ -86,7 +482,7 @@
 - (NSUInteger)hash
 {
     return [super hash] ^ self.minimumPropertyCount.hash ^ self.maximumPropertyCount.hash ^ self.requiredPropertyKeys.hash ^ self.propertyValidators.hash ^
-        self.patternPropertyValidators.hash ^ self.additionalPropertiesValidator.hash ^ self.propertyDependencies.hash;
+        self.patternPropertyValidators.hash ^ self.additionalPropertiesValidator.hash ^ self.allowsAllAdditionalProperties ^ self.propertyDependencies.hash;
 }
 
 
@@ -105,110 +501,144 @@
         (other.propertyValidators == self.propertyValidators || [other.propertyValidators isEqualToArray:self.propertyValidators]) &&
         (other.patternPropertyValidators == self.patternPropertyValidators || [other.patternPropertyValidators isEqualToArray:self.patternPropertyValidators]) &&
         (other.additionalPropertiesValidator == self.additionalPropertiesValidator || [other.additionalPropertiesValidator isEqual:self.additionalPropertiesValidator]) &&
+        other.allowsAllAdditionalProperties == self.allowsAllAdditionalProperties &&
         (other.propertyDependencies == self.propertyDependencies || [other.propertyDependencies isEqualToDictionary:self.propertyDependencies]);
 }
 
 
 - (BOOL)validateValue:(id)value error:(out NSError *__autoreleasing *)outError
 {
-    if (![super validateValue:value error:outError]) {
-        return NO;
-    } else if (![value isKindOfClass:[NSDictionary class]]) {
+    return [self validateValue:value context:nil error:outError];
+}
+
+
+- (BOOL)validateValue:(id)value context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
+    return [self validateJSONValue:value ofType:TWTJSONTypeOfValue(value) context:context error:outError];
+}
+
+
+- (BOOL)validateJSONValue:(id)value ofType:(TWTJSONType)type context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
+    if (type != TWTJSONTypeObject) {
+        // Let super report nil and null values
+        if (![super validateValue:value error:outError]) {
+            return NO;
+        }
+
         if (outError) {
             *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueHasIncorrectClass
                                             failingValidator:self
                                                        value:value
-                                        localizedDescription:TWTLocalizedString(@"TWTJSONSchemaObjectValidator.notJSONObjectError")];
+                                   localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTJSONSchemaObjectValidator.notJSONObjectError"); }];
         }
         return NO;
     }
 
+    BOOL collectsErrors = outError != NULL;
     BOOL countValidated = YES;
     BOOL requiredPropertiesValidated = YES;
     BOOL propertiesValidated = YES;
-    BOOL patternPropertiesValidated = YES;
-    BOOL additionalPropertiesValidated = YES;
-    BOOL dependenciesValidated = YES;
 
     NSError *countError = nil;
     NSError *requiredPropertiesError = nil;
-    NSError *error = nil;
-    NSMutableArray *propertiesErrors = outError ? [[NSMutableArray alloc] init] : nil;
-    NSMutableArray *dependenciesErrors = outError ? [[NSMutableArray alloc] init] : nil;
-
-    NSSet *keySet = [NSSet setWithArray:[value allKeys]];
 
     if (self.countValidator) {
-        countValidated = [self.countValidator validateValue:@([value count]) error:&countError];
+        countValidated = TWTValidatorValidateCount(self.countValidator, [value count], collectsErrors ? &countError : NULL);
     }
 
-    if (self.requiredPropertyKeys) {
-        requiredPropertiesValidated = [self checkRequiredKeys:self.requiredPropertyKeys arePresentInValueKeys:keySet error:&requiredPropertiesError];
-    }
+    // In fail-fast mode, stop validating as soon as any keyword fails
+    BOOL failsFast = TWTValidationContextIsFailFastModeEnabled(context);
+    TWTValidationExecutor *executor = TWTValidationContextExecutor(context);
 
-    for (NSString *key in value) {
-        error = nil;
-        BOOL propertyIsDefined = NO;
-        id objectForKey = [value objectForKey:key];
-
-        TWTKeyValuePairValidator *propertyValidator = [self.propertyAndValidators objectForKey:key];
-        if (propertyValidator) {
-            propertyIsDefined = YES;
-            if (![propertyValidator validateValue:objectForKey error:outError ? &error : NULL]) {
-                propertiesValidated = NO;
-                if (error) {
-                    [propertiesErrors addObject:error];
-                }
-            }
+    // Results are only needed to collect errors, so valid objects can be validated without allocating anything
+    TWTJSONSchemaObjectPropertyValidationResults *results = collectsErrors ? [[TWTJSONSchemaObjectPropertyValidationResults alloc] initWithCollectsErrors:YES] : nil;
+    NSUInteger presentRequiredKeyCount = NSNotFound;
+    if (!failsFast && [executor shouldExecuteConcurrentlyWithCount:[value count]]) {
+        // Properties are validated independently of one another, so required keys are checked separately
+        if (self.requiredPropertyKeys) {
+            requiredPropertiesValidated = [self checkRequiredKeys:self.requiredPropertyKeys
+                                               arePresentInObject:value
+                                                            error:collectsErrors ? &requiredPropertiesError : NULL];
         }
 
-        for (TWTKeyValuePairValidator *patternValidator in self.patternPropertyValidators) {
-            NSError *regularExpressionError = nil;
-            error = nil;
-            NSRegularExpression *regularExpression = [NSRegularExpression regularExpressionWithPattern:patternValidator.key options:0 error:&regularExpressionError];
-
-            if (!regularExpressionError) {
-                if ([regularExpression numberOfMatchesInString:key options:0 range:NSMakeRange(0, [key length])] > 0) {
-                    propertyIsDefined = YES;
-
-                    if (![patternValidator validateValue:objectForKey error:outError ? &error : NULL]) {
-                        patternPropertiesValidated = NO;
-                        if (error) {
-                            [propertiesErrors addObject:error];
-                        }
-                    };
-                }
-            } // If regular expression is invalid, no properties will match and thus all instances are valid
+        NSArray *keys = [value allKeys];
+        TWTJSONSchemaObjectPropertyTable *propertyTable = self.propertyTable;
+        BOOL deadlineExceeded = NO;
+        NSArray *propertyResults = [context resultsOfExecutingCount:keys.count
+                                                   deadlineExceeded:&deadlineExceeded
+                                                              block:^id(TWTValidationContext *chunkContext, NSUInteger index) {
+            TWTJSONSchemaObjectPropertyValidationResults *keyResults = [[TWTJSONSchemaObjectPropertyValidationResults alloc] initWithCollectsErrors:collectsErrors];
+            NSString *key = keys[index];
+            keyResults.propertiesValidated = [self validatePropertyWithKey:key
+                                                                     value:[value objectForKey:key]
+                                                                      slot:TWTJSONSchemaObjectPropertyTableSlotForKey(propertyTable, key)
+                                                                    object:value
+                                                                   context:chunkContext
+                                                                   results:keyResults
+                                                                 failsFast:NO];
+            return keyResults;
+        }];
+
+        if (deadlineExceeded) {
+            propertiesValidated = NO;
+            [results.propertiesErrors addObject:[context deadlineExceededErrorWithFailingValidator:self value:value]];
         }
 
-        error = nil;
-        if (!propertyIsDefined) {
-            if (![self.additionalPropertiesValidator validateValue:objectForKey error:outError ? &error : NULL]) {
-                additionalPropertiesValidated = NO;
-                if (error) {
-                    [propertiesErrors addObject:error];
-                }
+        // Results are NSNull for properties that were skipped because the deadline passed
+        for (TWTJSONSchemaObjectPropertyValidationResults *keyResults in propertyResults) {
+            if ((id)keyResults == [NSNull null]) {
+                continue;
             }
+
+            propertiesValidated = propertiesValidated && keyResults.propertiesValidated;
+            [results addResults:keyResults];
         }
+    } else if (countValidated || !failsFast) {
+        propertiesValidated = [self validatePropertiesOfObject:value
+                                                       context:context
+                                                       results:results
+                                                     failsFast:failsFast
+                                       presentRequiredKeyCount:&presentRequiredKeyCount];
+    }
 
-        error = nil;
-        id dependency = self.propertyDependencies[key];
-        if (dependency) {
-            if ([dependency isKindOfClass:[NSSet class]]) {
-                dependenciesValidated = [self checkRequiredKeys:dependency arePresentInValueKeys:keySet error:outError ? &error : NULL];
-            } else {
-                // dependencyValue is a schema validator
-                if (![dependency validateValue:value error:outError ? &error : NULL]) {
-                    dependenciesValidated = NO;
-                    if (error) {
-                        [dependenciesErrors addObject:error];
-                    }
-                }
-            }
+    // If the pass over the properties stopped early, validation has already failed and required keys weren’t counted
+    if (presentRequiredKeyCount != NSNotFound && presentRequiredKeyCount < self.propertyTable->_requiredKeyCount) {
+        requiredPropertiesValidated = NO;
+        if (collectsErrors) {
+            [self checkRequiredKeys:self.requiredPropertyKeys arePresentInObject:value error:&requiredPropertiesError];
         }
     }
 
-    BOOL validated = countValidated & requiredPropertiesValidated & propertiesValidated & patternPropertiesValidated & additionalPropertiesValidated & dependenciesValidated;
+    return [self finishValidatingValue:value
+                        countValidated:countValidated
+                            countError:countError
+           requiredPropertiesValidated:requiredPropertiesValidated
+               requiredPropertiesError:requiredPropertiesError
+                   propertiesValidated:propertiesValidated
+                               results:results
+                               context:context
+                                 error:outError];
+}
+
+
+/*!
+ @abstract Combines the results of validating a JSON object’s keywords into a single result and error.
+ @discussion This is shared by -validateJSONValue:ofType:context:error: and
+     -validateStreamedObjectWithKeyCount:presentKeys:propertiesValidated:propertyErrors:error:.
+     value may be nil if the object is being streamed. results may be nil if errors are not being collected.
+ */
+- (BOOL)finishValidatingValue:(id)value
+               countValidated:(BOOL)countValidated
+                   countError:(NSError *)countError
+  requiredPropertiesValidated:(BOOL)requiredPropertiesValidated
+      requiredPropertiesError:(NSError *)requiredPropertiesError
+          propertiesValidated:(BOOL)propertiesValidated
+                      results:(TWTJSONSchemaObjectPropertyValidationResults *)results
+                      context:(TWTValidationContext *)context
+                        error:(NSError *__autoreleasing *)outError
+{
+    BOOL validated = countValidated && requiredPropertiesValidated && propertiesValidated;
     if (!validated && outError) {
         NSMutableArray *underlyingErrors = [[NSMutableArray alloc] init];
 
@@ -220,40 +650,396 @@
             [underlyingErrors addObject:requiredPropertiesError];
         }
 
-        if (!dependenciesValidated) {
-            [underlyingErrors addObjectsFromArray:dependenciesErrors];
-        }
-
-        if (propertiesErrors.count) {
-            [underlyingErrors addObjectsFromArray:propertiesErrors];
-        }
+        [underlyingErrors addObjectsFromArray:results.dependenciesErrors];
+        [underlyingErrors addObjectsFromArray:results.propertiesErrors];
 
         *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeJSONSchemaObjectValidatorError
                                         failingValidator:self
                                                    value:value
-                                    localizedDescription:TWTLocalizedString(@"TWTJSONSchemaObjectValidator.validationError")
+                               localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTJSONSchemaObjectValidator.validationError"); }
                                         underlyingErrors:underlyingErrors];
+        *outError = TWTValidationContextErrorByMarkingTruncation(context, *outError);
     }
 
     return validated;
 }
 
 
-- (BOOL)checkRequiredKeys:(NSSet *)requiredKeys arePresentInValueKeys:(NSSet *)valueKeys error:(NSError **)outError
+/*!
+ @abstract Validates every property of a JSON object in a single pass, counting the required keys the object contains.
+ @discussion The pass normally walks the object’s keys, looking each one up in the property table. If only keys in
+     the table can fail—i.e., there are no pattern properties and additional properties are allowed—and the table
+     has fewer keys than the object, it instead walks the table and looks each of its keys up in the object.
+ @param object The JSON object being validated.
+ @param context The validation context.
+ @param results The results object to which errors should be added. May be nil if errors are not being collected.
+ @param failsFast Whether validation should stop as soon as a property fails validation.
+ @param outPresentRequiredKeyCount On return, the number of required keys that the object contains, or NSNotFound
+     if the pass stopped before every property was validated.
+ @result Whether every property is valid.
+ */
+- (BOOL)validatePropertiesOfObject:(NSDictionary *)object
+                           context:(TWTValidationContext *)context
+                           results:(TWTJSONSchemaObjectPropertyValidationResults *)results
+                         failsFast:(BOOL)failsFast
+           presentRequiredKeyCount:(NSUInteger *)outPresentRequiredKeyCount
+{
+    TWTJSONSchemaObjectPropertyTable *propertyTable = self.propertyTable;
+    NSUInteger presentRequiredKeyCount = 0;
+    BOOL propertiesValidated = YES;
+
+    if (!self.patternPropertyMatcher && self.allowsAllAdditionalProperties && propertyTable->_slotCount < [object count]) {
+        for (NSUInteger slotIndex = 0; slotIndex < propertyTable->_slotCount; ++slotIndex) {
+            const TWTJSONSchemaObjectPropertySlot *slot = &propertyTable->_slots[slotIndex];
+            id propertyValue = [object objectForKey:slot->key];
+            if (!propertyValue) {
+                continue;
+            } else if ([context isPastDeadline]) {
+                [results.propertiesErrors addObject:[context deadlineExceededErrorWithFailingValidator:self value:object]];
+                *outPresentRequiredKeyCount = NSNotFound;
+                return NO;
+            }
+
+            presentRequiredKeyCount += slot->isRequired;
+            if (![self validatePropertyWithKey:slot->key value:propertyValue slot:slot object:object context:context results:results failsFast:failsFast]) {
+                propertiesValidated = NO;
+                if (failsFast) {
+                    *outPresentRequiredKeyCount = NSNotFound;
+                    return NO;
+                }
+            }
+        }
+    } else {
+        for (NSString *key in object) {
+            if ([context isPastDeadline]) {
+                [results.propertiesErrors addObject:[context deadlineExceededErrorWithFailingValidator:self value:object]];
+                *outPresentRequiredKeyCount = NSNotFound;
+                return NO;
+            }
+
+            const TWTJSONSchemaObjectPropertySlot *slot = TWTJSONSchemaObjectPropertyTableSlotForKey(propertyTable, key);
+            if (slot && slot->isRequired) {
+                ++presentRequiredKeyCount;
+            }
+
+            if (![self validatePropertyWithKey:key value:[object objectForKey:key] slot:slot object:object context:context results:results failsFast:failsFast]) {
+                propertiesValidated = NO;
+                if (failsFast) {
+                    *outPresentRequiredKeyCount = NSNotFound;
+                    return NO;
+                }
+            }
+        }
+    }
+
+    *outPresentRequiredKeyCount = presentRequiredKeyCount;
+    return propertiesValidated;
+}
+
+
+/*!
+ @abstract Validates a property of a JSON object, adding any errors to the specified results object.
+ @param key The property’s key.
+ @param propertyValue The property’s value.
+ @param slot The key’s slot in the property table, or NULL if the table has no slot for the key.
+ @param object The JSON object being validated.
+ @param context The validation context.
+ @param results The results object to which errors should be added. May be nil if errors are not being collected.
+ @param failsFast Whether validation should stop as soon as the property fails validation.
+ @result Whether the property and its dependency are valid.
+ */
+- (BOOL)validatePropertyWithKey:(NSString *)key
+                          value:(id)propertyValue
+                           slot:(const TWTJSONSchemaObjectPropertySlot *)slot
+                         object:(NSDictionary *)object
+                        context:(TWTValidationContext *)context
+                        results:(TWTJSONSchemaObjectPropertyValidationResults *)results
+                      failsFast:(BOOL)failsFast
 {
-    if ([requiredKeys isSubsetOfSet:valueKeys]) {
+    BOOL collectsErrors = results.propertiesErrors != nil;
+    NSError *error = nil;
+    BOOL validated = YES;
+
+    TWTKeyValuePairValidator *propertyValidator = slot ? slot->propertyValidator : nil;
+    if (propertyValidator) {
+        TWTValidationPathFrame frame = TWTValidationPathFrameMakeWithKey(key, TWTJSONSchemaKeywordProperties, key);
+        if (![self validatePropertyValue:propertyValue
+                           withValidator:propertyValidator
+                                   frame:frame
+                                 context:context
+                                   error:collectsErrors ? &error : NULL]) {
+            validated = NO;
+            if (error) {
+                [results.propertiesErrors addObject:error];
+            }
+
+            if (failsFast) {
+                return NO;
+            }
+        }
+    }
+
+    // Keys without a slot aren’t named by the schema, but may still match its patterns
+    NSArray *patternValidators = slot ? slot->patternValidators : [self.patternPropertyMatcher validatorsMatchingKey:key];
+    for (TWTKeyValuePairValidator *patternValidator in patternValidators) {
+        error = nil;
+
+        TWTValidationPathFrame frame = TWTValidationPathFrameMakeWithKey(key, TWTJSONSchemaKeywordPatternProperties, patternValidator.key);
+        if (![self validatePropertyValue:propertyValue
+                           withValidator:patternValidator
+                                   frame:frame
+                                 context:context
+                                   error:collectsErrors ? &error : NULL]) {
+            validated = NO;
+            if (error) {
+                [results.propertiesErrors addObject:error];
+            }
+
+            if (failsFast) {
+                return NO;
+            }
+        }
+    }
+
+    error = nil;
+    BOOL isAdditionalProperty = slot ? slot->isAdditionalProperty : patternValidators.count == 0;
+    if (isAdditionalProperty && !self.allowsAllAdditionalProperties) {
+        TWTValidationPathFrame frame = TWTValidationPathFrameMakeWithKey(key, TWTJSONSchemaKeywordAdditionalProperties, nil);
+        BOOL additionalPropertyValidated = NO;
+        if (self.additionalPropertiesValidator) {
+            additionalPropertyValidated = [self validatePropertyValue:propertyValue
+                                                        withValidator:self.additionalPropertiesValidator
+                                                                frame:frame
+                                                              context:context
+                                                                error:collectsErrors ? &error : NULL];
+        } else if (collectsErrors) {
+            // Without a validator, additional properties aren’t allowed at all
+            [context pushPathFrame:&frame];
+            error = TWTValidationContextErrorByAddingCurrentPaths(context, [self additionalPropertyNotAllowedErrorWithKey:key value:propertyValue]);
+            [context popPathFrame];
+        }
+
+        if (!additionalPropertyValidated) {
+            validated = NO;
+            if (error) {
+                [results.propertiesErrors addObject:error];
+            }
+
+            if (failsFast) {
+                return NO;
+            }
+        }
+    }
+
+    BOOL dependencyValidated = !slot || !slot->dependency || [self validateDependencyInSlot:slot object:object context:context results:results];
+    return validated && dependencyValidated;
+}
+
+
+/*!
+ @abstract Validates a property’s value with the specified path frame pushed onto the validation context.
+ @discussion Errors are given the frame’s paths before the frame is popped.
+ @param value The property’s value.
+ @param validator The validator to validate the value with.
+ @param frame The path frame for the property.
+ @param context The validation context.
+ @param outError A pointer to an error object to return indirectly. If NULL, no error is returned.
+ @result Whether the value is valid.
+ */
+- (BOOL)validatePropertyValue:(id)value
+                withValidator:(TWTValidator *)validator
+                        frame:(TWTValidationPathFrame)frame
+                      context:(TWTValidationContext *)context
+                        error:(NSError *__autoreleasing *)outError
+{
+    [context pushPathFrame:&frame];
+
+    BOOL validated = TWTValidationContextValidateValue(context, validator, value, outError);
+    if (!validated && outError) {
+        *outError = TWTValidationContextErrorByAddingCurrentPaths(context, *outError);
+    }
+
+    [context popPathFrame];
+    return validated;
+}
+
+
+/*!
+ @abstract Validates the dependency in the specified property table slot, adding any errors to the specified results
+     object.
+ @param slot The slot of the key whose dependency is being validated. Its dependency may not be nil.
+ @param object The JSON object being validated.
+ @param context The validation context.
+ @param results The results object to which errors should be added. May be nil if errors are not being collected.
+ @result Whether the dependency is satisfied.
+ */
+- (BOOL)validateDependencyInSlot:(const TWTJSONSchemaObjectPropertySlot *)slot
+                          object:(NSDictionary *)object
+                         context:(TWTValidationContext *)context
+                         results:(TWTJSONSchemaObjectPropertyValidationResults *)results
+{
+    // Dependencies apply to the object itself, so only the schema path changes
+    TWTValidationPathFrame frame = TWTValidationPathFrameMakeWithKey(nil, TWTJSONSchemaKeywordDependencies, slot->key);
+    [context pushPathFrame:&frame];
+
+    NSError *error = nil;
+    BOOL collectsErrors = results.dependenciesErrors != nil;
+    BOOL dependencyValidated = NO;
+    if (slot->dependencyIsKeySet) {
+        dependencyValidated = [self checkRequiredKeys:slot->dependency arePresentInObject:object error:collectsErrors ? &error : NULL];
+    } else {
+        dependencyValidated = TWTValidationContextValidateValue(context, slot->dependency, object, collectsErrors ? &error : NULL);
+    }
+
+    if (!dependencyValidated && error) {
+        [results.dependenciesErrors addObject:TWTValidationContextErrorByAddingCurrentPaths(context, error)];
+    }
+
+    [context popPathFrame];
+    return dependencyValidated;
+}
+
+
+#pragma mark - Streaming
+
+- (BOOL)supportsStreamingValidation
+{
+    for (id dependency in [self.propertyDependencies objectEnumerator]) {
+        if (![dependency isKindOfClass:[NSSet class]]) {
+            return NO;
+        }
+    }
+
+    return YES;
+}
+
+
+- (NSArray *)validatorsForPropertyWithKey:(NSString *)key
+{
+    NSMutableArray *validators = [[NSMutableArray alloc] init];
+    const TWTJSONSchemaObjectPropertySlot *slot = TWTJSONSchemaObjectPropertyTableSlotForKey(self.propertyTable, key);
+
+    if (slot && slot->propertyValidator) {
+        [validators addObject:slot->propertyValidator];
+    }
+
+    [validators addObjectsFromArray:slot ? slot->patternValidators : [self.patternPropertyMatcher validatorsMatchingKey:key]];
+
+    if (validators.count == 0 && !self.allowsAllAdditionalProperties) {
+        if (self.additionalPropertiesValidator) {
+            [validators addObject:self.additionalPropertiesValidator];
+        } else {
+            [validators addObject:[[TWTBlockValidator alloc] initWithBlock:^BOOL(id value, NSError *__autoreleasing *outError) {
+                if (outError) {
+                    *outError = [self additionalPropertyNotAllowedErrorWithKey:key value:value];
+                }
+
+                return NO;
+            }]];
+        }
+    }
+
+    return validators;
+}
+
+
+- (BOOL)presenceOfKeyAffectsStreamedObjectValidation:(NSString *)key
+{
+    return [self.streamedObjectPresenceKeys containsObject:key];
+}
+
+
+- (BOOL)validateStreamedObjectWithKeyCount:(NSUInteger)keyCount
+                               presentKeys:(NSSet *)presentKeys
+                       propertiesValidated:(BOOL)propertiesValidated
+                            propertyErrors:(NSArray *)propertyErrors
+                                     error:(NSError *__autoreleasing *)outError
+{
+    // Only some of the keys are known here, so a dictionary that maps each of them to itself stands in for the object
+    NSArray *keys = [presentKeys allObjects];
+    NSDictionary *keyObject = [[NSDictionary alloc] initWithObjects:keys forKeys:keys];
+
+    BOOL countValidated = YES;
+    NSError *countError = nil;
+    if (self.countValidator) {
+        countValidated = TWTValidatorValidateCount(self.countValidator, keyCount, outError ? &countError : NULL);
+    }
+
+    BOOL requiredPropertiesValidated = YES;
+    NSError *requiredPropertiesError = nil;
+    if (self.requiredPropertyKeys) {
+        requiredPropertiesValidated = [self checkRequiredKeys:self.requiredPropertyKeys
+                                           arePresentInObject:keyObject
+                                                        error:outError ? &requiredPropertiesError : NULL];
+    }
+
+    TWTJSONSchemaObjectPropertyValidationResults *results = outError ? [[TWTJSONSchemaObjectPropertyValidationResults alloc] initWithCollectsErrors:YES] : nil;
+    [results.propertiesErrors addObjectsFromArray:propertyErrors];
+
+    // Only key dependencies are possible here, and the stand-in object contains every key they name
+    for (NSString *key in keyObject) {
+        const TWTJSONSchemaObjectPropertySlot *slot = TWTJSONSchemaObjectPropertyTableSlotForKey(self.propertyTable, key);
+        if (slot && slot->dependency && ![self validateDependencyInSlot:slot object:keyObject context:nil results:results]) {
+            propertiesValidated = NO;
+        }
+    }
+
+    return [self finishValidatingValue:nil
+                        countValidated:countValidated
+                            countError:countError
+           requiredPropertiesValidated:requiredPropertiesValidated
+               requiredPropertiesError:requiredPropertiesError
+                   propertiesValidated:propertiesValidated
+                               results:results
+                               context:nil
+                                 error:outError];
+}
+
+
+/*!
+ @abstract Returns an error for an additional property when additional properties are not allowed.
+ @param key The property’s key.
+ @param value The property’s value.
+ @result An error whose failing validator is the receiver.
+ */
+- (NSError *)additionalPropertyNotAllowedErrorWithKey:(NSString *)key value:(id)value
+{
+    return [NSError twt_validationErrorWithCode:TWTValidationErrorCodeAdditionalElementsNotAllowed
+                               failingValidator:self
+                                          value:value
+                      localizedDescriptionBlock:^{
+                          NSString *formatDescription = TWTLocalizedString(@"TWTJSONSchemaObjectValidator.additionalPropertyNotAllowed.validationError.format");
+                          return [NSString stringWithFormat:formatDescription, key];
+                      }];
+}
+
+
+- (BOOL)checkRequiredKeys:(NSSet *)requiredKeys arePresentInObject:(NSDictionary *)object error:(NSError **)outError
+{
+    // Looking up each key individually avoids creating a set of the object’s keys when every key is present
+    BOOL keysArePresent = YES;
+    for (NSString *key in requiredKeys) {
+        if (![object objectForKey:key]) {
+            keysArePresent = NO;
+            break;
+        }
+    }
+
+    if (keysArePresent) {
         return YES;
     }
 
     if (outError) {
-        NSMutableSet *missingKeys = [requiredKeys mutableCopy];
-        [missingKeys minusSet:valueKeys];
-        NSString *formatDescription = TWTLocalizedString(@"TWTJSONSchemaObjectValidator.requiredPropertyMissing.validationError.format");
-        NSString *description = [NSString stringWithFormat:formatDescription, missingKeys];
+        NSSet *valueKeys = [[NSSet alloc] initWithArray:[object allKeys]];
         *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeRequiredPropertyMissing
                                         failingValidator:self
                                                    value:valueKeys
-                                    localizedDescription:description];
+                               localizedDescriptionBlock:^{
+                                   NSMutableSet *missingKeys = [requiredKeys mutableCopy];
+                                   [missingKeys minusSet:valueKeys];
+                                   NSString *formatDescription = TWTLocalizedString(@"TWTJSONSchemaObjectValidator.requiredPropertyMissing.validationError.format");
+                                   return [NSString stringWithFormat:formatDescription, missingKeys];
+                               }];
     }
     
     return NO;
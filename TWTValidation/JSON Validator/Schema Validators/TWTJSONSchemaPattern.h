@@ -0,0 +1,44 @@
+//
+//  TWTJSONSchemaPattern.h
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+@import Foundation;
+
+@class TWTStringValidator;
+
+
+// Most schema patterns are really literal or character class checks, e.g., ^abc, \.json$, or ^[0-9a-f]{32}$. Those
+// are validated with a string kernel instead of a regular expression: literals are found with a code unit by code unit
+// search, and fully anchored character class repetitions are checked with character set validators. Literals and
+// classes must consist of printable ASCII characters, and classes may not be negated. Every other pattern is validated
+// with its regular expression.
+//
+// Kernels accept exactly the strings that the regular expression matches. In particular, $ matches at the end of the
+// string and before a line terminator that ends it, as it does in NSRegularExpression and TWTRegularExpressionMatcher.
+
+// Returns a string validator that validates that strings contain a match for the schema pattern. The validator uses
+// one of the kernels described above if the pattern can be matched with one, and is a regular expression string
+// validator otherwise. Either way, its errors are those of a regular expression string validator.
+extern TWTStringValidator *TWTJSONSchemaStringValidatorForPattern(NSRegularExpression *regularExpression);
@@ -0,0 +1,528 @@
+//
+//  TWTJSONSchemaPattern.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTJSONSchemaPattern.h>
+
+#import <TWTValidation/TWTStringValidator.h>
+#import <TWTValidation/TWTValidationErrors.h>
+#import <TWTValidation/TWTValidationLocalization.h>
+
+
+// Counted repetitions with more digits than this are left to the regular expression, so that counts can’t overflow
+static const NSUInteger TWTJSONSchemaPatternCountMaximumDigitCount = 9;
+
+
+typedef struct _TWTJSONSchemaPatternScanner {
+    const unichar *characters;
+    NSUInteger location;
+
+    // The location at which the pattern ends, excluding any trailing $
+    NSUInteger endLocation;
+} TWTJSONSchemaPatternScanner;
+
+
+#pragma mark - Characters
+
+static inline BOOL TWTJSONSchemaPatternCharacterIsPrintableASCII(unichar character)
+{
+    return character >= ' ' && character <= '~';
+}
+
+
+static inline BOOL TWTJSONSchemaPatternCharacterIsAlphanumeric(unichar character)
+{
+    return (character >= '0' && character <= '9') || (character >= 'A' && character <= 'Z') || (character >= 'a' && character <= 'z');
+}
+
+
+static inline BOOL TWTJSONSchemaPatternCharacterIsDigit(unichar character)
+{
+    return character >= '0' && character <= '9';
+}
+
+
+// Returns whether the character stands for itself outside of a character class
+static inline BOOL TWTJSONSchemaPatternCharacterIsLiteral(unichar character)
+{
+    return TWTJSONSchemaPatternCharacterIsPrintableASCII(character) && !strchr("\\^$.|?*+()[]{}", (char)character);
+}
+
+
+// Returns whether the character stands for itself inside of a character class. This excludes characters that ICU uses
+// for set operations, nested sets, and string literals, even where ICU would treat them literally.
+static inline BOOL TWTJSONSchemaPatternCharacterIsClassLiteral(unichar character)
+{
+    return TWTJSONSchemaPatternCharacterIsPrintableASCII(character) && !strchr("\\^$[]{}-&", (char)character);
+}
+
+
+#pragma mark - Scanning
+
+// Scans a backslash followed by printable ASCII punctuation, which matches the punctuation character. Escapes of
+// letters and digits are character classes, anchors, or back references, and aren’t scanned.
+static BOOL TWTJSONSchemaPatternScanEscapedCharacter(TWTJSONSchemaPatternScanner *scanner, unichar *outCharacter)
+{
+    NSUInteger location = scanner->location;
+    if (location + 1 >= scanner->endLocation || scanner->characters[location] != '\\') {
+        return NO;
+    }
+
+    unichar character = scanner->characters[location + 1];
+    if (!TWTJSONSchemaPatternCharacterIsPrintableASCII(character) || TWTJSONSchemaPatternCharacterIsAlphanumeric(character)) {
+        return NO;
+    }
+
+    scanner->location += 2;
+    *outCharacter = character;
+    return YES;
+}
+
+
+// Scans the remainder of the pattern as a literal string. Returns nil if any of it isn’t literal.
+static NSString *TWTJSONSchemaPatternScanLiteral(TWTJSONSchemaPatternScanner *scanner)
+{
+    NSMutableString *literal = [[NSMutableString alloc] initWithCapacity:scanner->endLocation - scanner->location];
+    while (scanner->location < scanner->endLocation) {
+        unichar character = scanner->characters[scanner->location];
+        if (TWTJSONSchemaPatternCharacterIsLiteral(character)) {
+            ++scanner->location;
+        } else if (!TWTJSONSchemaPatternScanEscapedCharacter(scanner, &character)) {
+            return nil;
+        }
+
+        [literal appendFormat:@"%C", character];
+    }
+
+    return literal;
+}
+
+
+static BOOL TWTJSONSchemaPatternScanClassCharacter(TWTJSONSchemaPatternScanner *scanner, unichar *outCharacter)
+{
+    if (scanner->location >= scanner->endLocation) {
+        return NO;
+    }
+
+    unichar character = scanner->characters[scanner->location];
+    if (TWTJSONSchemaPatternCharacterIsClassLiteral(character)) {
+        ++scanner->location;
+        *outCharacter = character;
+        return YES;
+    }
+
+    return TWTJSONSchemaPatternScanEscapedCharacter(scanner, outCharacter);
+}
+
+
+// Scans a non-negated character class of literal characters and ranges, e.g., [A-Za-z0-9_]
+static NSCharacterSet *TWTJSONSchemaPatternScanClass(TWTJSONSchemaPatternScanner *scanner)
+{
+    if (scanner->location >= scanner->endLocation || scanner->characters[scanner->location] != '[') {
+        return nil;
+    }
+
+    ++scanner->location;
+    NSMutableCharacterSet *characterSet = [[NSMutableCharacterSet alloc] init];
+    BOOL isEmpty = YES;
+
+    while (scanner->location < scanner->endLocation && scanner->characters[scanner->location] != ']') {
+        unichar first = 0;
+        if (!TWTJSONSchemaPatternScanClassCharacter(scanner, &first)) {
+            return nil;
+        }
+
+        unichar last = first;
+        if (scanner->location < scanner->endLocation && scanner->characters[scanner->location] == '-') {
+            ++scanner->location;
+            if (!TWTJSONSchemaPatternScanClassCharacter(scanner, &last) || last < first) {
+                return nil;
+            }
+        }
+
+        [characterSet addCharactersInRange:NSMakeRange(first, last - first + 1)];
+        isEmpty = NO;
+    }
+
+    if (isEmpty || scanner->location >= scanner->endLocation) {
+        return nil;
+    }
+
+    ++scanner->location;
+    return [characterSet copy];
+}
+
+
+static BOOL TWTJSONSchemaPatternScanCount(TWTJSONSchemaPatternScanner *scanner, NSUInteger *outCount)
+{
+    NSUInteger count = 0;
+    NSUInteger digitCount = 0;
+    while (scanner->location < scanner->endLocation && TWTJSONSchemaPatternCharacterIsDigit(scanner->characters[scanner->location])) {
+        if (++digitCount > TWTJSONSchemaPatternCountMaximumDigitCount) {
+            return NO;
+        }
+
+        count = count * 10 + (scanner->characters[scanner->location] - '0');
+        ++scanner->location;
+    }
+
+    *outCount = count;
+    return digitCount > 0;
+}
+
+
+// Scans an optional quantifier: *, +, ?, {n}, {n,}, or {n,m}, optionally followed by ? to make it lazy. Laziness
+// doesn’t affect whether a fully anchored pattern matches, so it’s ignored.
+static BOOL TWTJSONSchemaPatternScanQuantifier(TWTJSONSchemaPatternScanner *scanner, NSUInteger *outMinimum, NSUInteger *outMaximum)
+{
+    NSUInteger minimum = 1;
+    NSUInteger maximum = 1;
+
+    if (scanner->location < scanner->endLocation) {
+        switch (scanner->characters[scanner->location++]) {
+            case '*':
+                minimum = 0;
+                maximum = NSUIntegerMax;
+                break;
+            case '+':
+                maximum = NSUIntegerMax;
+                break;
+            case '?':
+                minimum = 0;
+                break;
+            case '{':
+                if (!TWTJSONSchemaPatternScanCount(scanner, &minimum) || scanner->location >= scanner->endLocation) {
+                    return NO;
+                }
+
+                maximum = minimum;
+                if (scanner->characters[scanner->location] == ',') {
+                    ++scanner->location;
+                    maximum = NSUIntegerMax;
+                    if (scanner->location < scanner->endLocation && scanner->characters[scanner->location] != '}' &&
+                        (!TWTJSONSchemaPatternScanCount(scanner, &maximum) || maximum < minimum)) {
+                        return NO;
+                    }
+                }
+
+                if (scanner->location >= scanner->endLocation || scanner->characters[scanner->location++] != '}') {
+                    return NO;
+                }
+
+                break;
+            default:
+                return NO;
+        }
+
+        if (scanner->location < scanner->endLocation && scanner->characters[scanner->location] == '?') {
+            ++scanner->location;
+        }
+    }
+
+    *outMinimum = minimum;
+    *outMaximum = maximum;
+    return YES;
+}
+
+
+#pragma mark - Kernels
+
+/*!
+ TWTJSONSchemaPatternKernels indicate how a TWTJSONSchemaPatternStringValidator matches strings.
+ */
+typedef NS_ENUM(uint8_t, TWTJSONSchemaPatternKernel) {
+    // abc: the string contains the literal
+    TWTJSONSchemaPatternKernelSubstring,
+
+    // ^abc: the string starts with the literal
+    TWTJSONSchemaPatternKernelPrefix,
+
+    // abc$: the string ends with the literal
+    TWTJSONSchemaPatternKernelSuffix,
+
+    // ^abc$: the string is the literal
+    TWTJSONSchemaPatternKernelEquality,
+
+    // ^[abc]{m,n}$: the string is valid according to a character set validator
+    TWTJSONSchemaPatternKernelCharacterSet
+};
+
+
+static inline BOOL TWTJSONSchemaPatternCharacterIsLineTerminator(unichar character)
+{
+    return (character >= '\n' && character <= '\r') || character == 0x85 || character == 0x2028 || character == 0x2029;
+}
+
+
+/*!
+ @abstract Returns the length of a string up to the position at which $ must match when the preceding part of the
+     pattern can’t match a line terminator.
+ @discussion NSRegularExpression’s $ matches at the end of the string and before a line terminator or CRLF that ends
+     the string, but not between the CR and LF.
+ */
+static NSUInteger TWTJSONSchemaPatternLengthBeforeFinalLineTerminator(NSString *string)
+{
+    NSUInteger length = string.length;
+    if (!length) {
+        return 0;
+    }
+
+    unichar character = [string characterAtIndex:length - 1];
+    if (character == '\n' && length > 1 && [string characterAtIndex:length - 2] == '\r') {
+        return length - 2;
+    }
+
+    return TWTJSONSchemaPatternCharacterIsLineTerminator(character) ? length - 1 : length;
+}
+
+
+/*!
+ TWTJSONSchemaPatternStringValidators validate that strings contain a match for a schema pattern that can be matched
+ with a string kernel. Literals are compared code unit by code unit, and $ matches where it does in
+ NSRegularExpression, so validators accept exactly the strings that the regular expression matches. Errors are the
+ same as those of a regular expression string validator for the pattern.
+ */
+@interface TWTJSONSchemaPatternStringValidator : TWTStringValidator
+
+@property (nonatomic, strong, readonly) NSRegularExpression *regularExpression;
+@property (nonatomic, assign, readonly) TWTJSONSchemaPatternKernel kernel;
+
+// The literal for every kernel but TWTJSONSchemaPatternKernelCharacterSet. nil otherwise
+@property (nonatomic, copy, readonly) NSString *literal;
+
+// The character set validator for TWTJSONSchemaPatternKernelCharacterSet. nil otherwise
+@property (nonatomic, strong, readonly) TWTCharacterSetStringValidator *characterSetValidator;
+
+- (instancetype)initWithRegularExpression:(NSRegularExpression *)regularExpression
+                                   kernel:(TWTJSONSchemaPatternKernel)kernel
+                                  literal:(NSString *)literal
+                    characterSetValidator:(TWTCharacterSetStringValidator *)characterSetValidator;
+
+@end
+
+
+@interface TWTJSONSchemaPatternStringValidator ()
+
+@property (nonatomic, strong, readwrite) NSRegularExpression *regularExpression;
+@property (nonatomic, assign, readwrite) TWTJSONSchemaPatternKernel kernel;
+@property (nonatomic, copy, readwrite) NSString *literal;
+@property (nonatomic, strong, readwrite) TWTCharacterSetStringValidator *characterSetValidator;
+
+@end
+
+
+@implementation TWTJSONSchemaPatternStringValidator
+
+- (instancetype)init
+{
+    return [self initWithRegularExpression:nil kernel:TWTJSONSchemaPatternKernelSubstring literal:nil characterSetValidator:nil];
+}
+
+
+- (instancetype)initWithRegularExpression:(NSRegularExpression *)regularExpression
+                                   kernel:(TWTJSONSchemaPatternKernel)kernel
+                                  literal:(NSString *)literal
+                    characterSetValidator:(TWTCharacterSetStringValidator *)characterSetValidator
+{
+    self = [super init];
+    if (self) {
+        _regularExpression = regularExpression;
+        _kernel = kernel;
+        _literal = [literal copy];
+        _characterSetValidator = characterSetValidator;
+    }
+
+    return self;
+}
+
+
+- (instancetype)copyWithZone:(NSZone *)zone
+{
+    typeof(self) copy = [super copyWithZone:zone];
+    copy.regularExpression = self.regularExpression;
+    copy.kernel = self.kernel;
+    copy.literal = self.literal;
+    copy.characterSetValidator = self.characterSetValidator;
+    return copy;
+}
+
+
+- (NSUInteger)hash
+{
+    return [super hash] ^ self.regularExpression.hash;
+}
+
+
+- (BOOL)isEqual:(id)object
+{
+    if (![super isEqual:object]) {
+        return NO;
+    } else if (self == object) {
+        return YES;
+    }
+
+    // The kernel is derived from the regular expression, so it need not be compared
+    typeof(self) other = object;
+    return other.regularExpression == self.regularExpression || [other.regularExpression isEqual:self.regularExpression];
+}
+
+
+- (BOOL)matchesString:(NSString *)string
+{
+    NSString *literal = self.literal;
+    NSUInteger length = string.length;
+
+    switch (self.kernel) {
+        case TWTJSONSchemaPatternKernelSubstring:
+            return [string rangeOfString:literal options:NSLiteralSearch].location != NSNotFound;
+        case TWTJSONSchemaPatternKernelPrefix:
+            return [string rangeOfString:literal options:NSLiteralSearch | NSAnchoredSearch].location != NSNotFound;
+        case TWTJSONSchemaPatternKernelSuffix:
+            length = TWTJSONSchemaPatternLengthBeforeFinalLineTerminator(string);
+            return [string rangeOfString:literal options:NSLiteralSearch | NSAnchoredSearch | NSBackwardsSearch range:NSMakeRange(0, length)].location != NSNotFound;
+        case TWTJSONSchemaPatternKernelEquality:
+            length = TWTJSONSchemaPatternLengthBeforeFinalLineTerminator(string);
+            return length == literal.length && [string rangeOfString:literal options:NSLiteralSearch | NSAnchoredSearch range:NSMakeRange(0, length)].location != NSNotFound;
+        case TWTJSONSchemaPatternKernelCharacterSet:
+            // Strings only need to be copied if they end with a line terminator, which is rare
+            length = TWTJSONSchemaPatternLengthBeforeFinalLineTerminator(string);
+            return [self.characterSetValidator validateValue:(length == string.length ? string : [string substringToIndex:length]) error:NULL];
+    }
+
+    return NO;
+}
+
+
+- (BOOL)validateValue:(id)value error:(out NSError *__autoreleasing *)outError
+{
+    if (![super validateValue:value error:outError]) {
+        return NO;
+    } else if (TWTValidatorValueIsNilOrNull(value) || !self.regularExpression || [self matchesString:value]) {
+        // If nil/null weren't allowed, super’s -validateValue:error: would have failed
+        return YES;
+    }
+
+    if (outError) {
+        NSString *pattern = [self.regularExpression pattern];
+        *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueDoesNotMatchFormat
+                                        failingValidator:self
+                                                   value:value
+                               localizedDescriptionBlock:^{
+                                   NSString *descriptionFormat = TWTLocalizedString(@"TWTRegularExpressionStringValidator.validationError.format");
+                                   return [NSString stringWithFormat:descriptionFormat, pattern];
+                               }];
+    }
+
+    return NO;
+}
+
+@end
+
+
+#pragma mark - Classification
+
+static TWTStringValidator *TWTJSONSchemaKernelValidatorForPattern(NSRegularExpression *regularExpression)
+{
+    NSString *pattern = regularExpression.pattern;
+    NSUInteger length = pattern.length;
+    if (!length) {
+        return nil;
+    }
+
+    unichar *characters = malloc(length * sizeof(unichar));
+    [pattern getCharacters:characters range:NSMakeRange(0, length)];
+
+    TWTJSONSchemaPatternScanner scanner = { characters, 0, length };
+
+    BOOL isAnchoredAtStart = characters[0] == '^';
+    if (isAnchoredAtStart) {
+        scanner.location = 1;
+    }
+
+    // A trailing $ is an anchor unless it’s escaped by an odd number of backslashes
+    BOOL isAnchoredAtEnd = NO;
+    if (scanner.endLocation > scanner.location && characters[scanner.endLocation - 1] == '$') {
+        NSUInteger backslashCount = 0;
+        for (NSUInteger i = scanner.endLocation - 1; i > scanner.location && characters[i - 1] == '\\'; --i) {
+            ++backslashCount;
+        }
+
+        if (backslashCount % 2 == 0) {
+            isAnchoredAtEnd = YES;
+            --scanner.endLocation;
+        }
+    }
+
+    TWTStringValidator *validator = nil;
+    NSUInteger bodyLocation = scanner.location;
+
+    NSString *literal = TWTJSONSchemaPatternScanLiteral(&scanner);
+    if (literal.length) {
+        TWTJSONSchemaPatternKernel kernel = TWTJSONSchemaPatternKernelSubstring;
+        if (isAnchoredAtStart && isAnchoredAtEnd) {
+            kernel = TWTJSONSchemaPatternKernelEquality;
+        } else if (isAnchoredAtStart) {
+            kernel = TWTJSONSchemaPatternKernelPrefix;
+        } else if (isAnchoredAtEnd) {
+            kernel = TWTJSONSchemaPatternKernelSuffix;
+        }
+
+        validator = [[TWTJSONSchemaPatternStringValidator alloc] initWithRegularExpression:regularExpression kernel:kernel literal:literal characterSetValidator:nil];
+    } else if (isAnchoredAtStart && isAnchoredAtEnd) {
+        scanner.location = bodyLocation;
+
+        NSCharacterSet *characterSet = TWTJSONSchemaPatternScanClass(&scanner);
+        NSUInteger minimumLength = 0;
+        NSUInteger maximumLength = 0;
+        if (characterSet && TWTJSONSchemaPatternScanQuantifier(&scanner, &minimumLength, &maximumLength) && scanner.location == scanner.endLocation) {
+            // Every valid string is ASCII, so its UTF-16 length is also the number of characters matched by the class
+            TWTCharacterSetStringValidator *characterSetValidator = nil;
+            if (minimumLength == 0 && maximumLength == NSUIntegerMax) {
+                characterSetValidator = [TWTStringValidator stringValidatorWithCharacterSet:characterSet];
+            } else {
+                characterSetValidator = [TWTStringValidator stringValidatorWithCharacterSet:characterSet minimumLength:minimumLength maximumLength:maximumLength];
+            }
+
+            validator = [[TWTJSONSchemaPatternStringValidator alloc] initWithRegularExpression:regularExpression
+                                                                                       kernel:TWTJSONSchemaPatternKernelCharacterSet
+                                                                                      literal:nil
+                                                                        characterSetValidator:characterSetValidator];
+        }
+    }
+
+    free(characters);
+    return validator;
+}
+
+
+TWTStringValidator *TWTJSONSchemaStringValidatorForPattern(NSRegularExpression *regularExpression)
+{
+    TWTStringValidator *validator = nil;
+    if (regularExpression.options == 0) {
+        validator = TWTJSONSchemaKernelValidatorForPattern(regularExpression);
+    }
+
+    return validator ?: [TWTStringValidator stringValidatorWithRegularExpression:regularExpression options:0];
+}
@@ -0,0 +1,51 @@
+//
+//  TWTJSONSchemaTypeValidator.h
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTJSONType.h>
+
+
+// Validates that values have one of a set of JSON types
+@interface TWTJSONSchemaTypeValidator : TWTValidator <NSCopying>
+
+@property (nonatomic, assign, readonly) TWTJSONTypeMask types;
+
+- (instancetype)initWithTypes:(TWTJSONTypeMask)types;
+
+@end
+
+
+// Validates values using the subvalidators for their JSON type. This gets the same results as an or validator whose
+// subvalidators each fail values that are not of their types, but only runs the subvalidators that could pass.
+@interface TWTJSONSchemaAmbiguousTypeValidator : TWTValidator <NSCopying>
+
+@property (nonatomic, copy, readonly) NSArray *subvalidators;
+
+// NSNumbers containing the TWTJSONTypeMask of each subvalidator
+@property (nonatomic, copy, readonly) NSArray *subvalidatorTypes;
+
+- (instancetype)initWithSubvalidators:(NSArray *)subvalidators types:(NSArray *)subvalidatorTypes;
+
+@end
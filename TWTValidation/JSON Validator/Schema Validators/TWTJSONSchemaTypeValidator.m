@@ -0,0 +1,214 @@
+//
+//  TWTJSONSchemaTypeValidator.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTJSONSchemaTypeValidator.h>
+
+#import <TWTValidation/TWTValidationErrors.h>
+#import <TWTValidation/TWTValidationLocalization.h>
+
+
+static NSError *TWTJSONSchemaTypeValidationError(TWTValidator *validator, id value, TWTJSONType type, TWTJSONTypeMask validTypes)
+{
+    return [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueHasIncorrectClass
+                               failingValidator:validator
+                                          value:value
+                      localizedDescriptionBlock:^NSString *{
+                          NSString *valueType = type != TWTJSONTypeNone ? TWTJSONTypeMaskDescription(1 << type) : NSStringFromClass([value class]);
+                          return [NSString stringWithFormat:TWTLocalizedString(@"TWTJSONSchemaTypeValidator.validationError.format"),
+                                  valueType, TWTJSONTypeMaskDescription(validTypes)];
+                      }];
+}
+
+
+#pragma mark
+
+@implementation TWTJSONSchemaTypeValidator
+
+- (instancetype)initWithTypes:(TWTJSONTypeMask)types
+{
+    self = [super init];
+    if (self) {
+        _types = types;
+    }
+    return self;
+}
+
+
+- (instancetype)init
+{
+    return [self initWithTypes:TWTJSONTypeMaskAll];
+}
+
+
+- (NSUInteger)hash
+{
+    return [super hash] ^ self.types;
+}
+
+
+- (BOOL)isEqual:(id)object
+{
+    if (![super isEqual:object]) {
+        return NO;
+    } else if (self == object) {
+        return YES;
+    }
+
+    typeof(self) other = object;
+    return other.types == self.types;
+}
+
+
+- (BOOL)validateValue:(id)value error:(out NSError *__autoreleasing *)outError
+{
+    return [self validateValue:value context:nil error:outError];
+}
+
+
+- (BOOL)validateValue:(id)value context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
+    return [self validateJSONValue:value ofType:TWTJSONTypeOfValue(value) context:context error:outError];
+}
+
+
+- (BOOL)validateJSONValue:(id)value ofType:(TWTJSONType)type context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
+    if (TWTJSONTypeMaskContainsType(self.types, type)) {
+        return YES;
+    }
+
+    if (outError) {
+        *outError = TWTJSONSchemaTypeValidationError(self, value, type, self.types);
+    }
+
+    return NO;
+}
+
+@end
+
+
+#pragma mark
+
+@implementation TWTJSONSchemaAmbiguousTypeValidator {
+    TWTJSONTypeMask _allSubvalidatorTypes;
+}
+
+- (instancetype)initWithSubvalidators:(NSArray *)subvalidators types:(NSArray *)subvalidatorTypes
+{
+    NSParameterAssert(subvalidators.count == subvalidatorTypes.count);
+
+    self = [super init];
+    if (self) {
+        _subvalidators = [subvalidators copy];
+        _subvalidatorTypes = [subvalidatorTypes copy];
+
+        for (NSNumber *types in _subvalidatorTypes) {
+            _allSubvalidatorTypes |= types.unsignedShortValue;
+        }
+    }
+    return self;
+}
+
+
+- (instancetype)init
+{
+    return [self initWithSubvalidators:nil types:nil];
+}
+
+
+- (NSUInteger)hash
+{
+    return [super hash] ^ self.subvalidators.hash ^ self.subvalidatorTypes.hash;
+}
+
+
+- (BOOL)isEqual:(id)object
+{
+    if (![super isEqual:object]) {
+        return NO;
+    } else if (self == object) {
+        return YES;
+    }
+
+    typeof(self) other = object;
+    return [other.subvalidatorTypes isEqualToArray:self.subvalidatorTypes] && [other.subvalidators isEqualToArray:self.subvalidators];
+}
+
+
+- (BOOL)validateValue:(id)value error:(out NSError *__autoreleasing *)outError
+{
+    return [self validateValue:value context:nil error:outError];
+}
+
+
+- (BOOL)validateValue:(id)value context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
+    return [self validateJSONValue:value ofType:TWTJSONTypeOfValue(value) context:context error:outError];
+}
+
+
+- (BOOL)validateJSONValue:(id)value ofType:(TWTJSONType)type context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
+    if (!TWTJSONTypeMaskContainsType(_allSubvalidatorTypes, type)) {
+        if (outError) {
+            *outError = TWTJSONSchemaTypeValidationError(self, value, type, _allSubvalidatorTypes);
+        }
+
+        return NO;
+    }
+
+    // Usually only one subvalidator can pass, but an integer may be validated by both integer and number subvalidators
+    NSMutableArray *errors = outError ? [[NSMutableArray alloc] init] : nil;
+    NSUInteger subvalidatorCount = self.subvalidators.count;
+    for (NSUInteger i = 0; i < subvalidatorCount; ++i) {
+        if (!TWTJSONTypeMaskContainsType([self.subvalidatorTypes[i] unsignedShortValue], type)) {
+            continue;
+        }
+
+        NSError *error = nil;
+        if ([self.subvalidators[i] validateJSONValue:value ofType:type context:context error:outError ? &error : NULL]) {
+            return YES;
+        } else if (error) {
+            [errors addObject:error];
+        }
+    }
+
+    if (outError) {
+        if (errors.count == 1) {
+            *outError = errors.firstObject;
+        } else {
+            *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeCompoundValidatorError
+                                            failingValidator:self
+                                                       value:value
+                                   localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTCompoundValidator.or.validationError"); }
+                                            underlyingErrors:errors];
+        }
+    }
+
+    return NO;
+}
+
+@end
@@ -0,0 +1,92 @@
+//
+//  TWTJSONType.h
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+@import Foundation;
+
+#import <TWTValidation/TWTValidationContext.h>
+#import <TWTValidation/TWTValidator.h>
+
+
+// The JSON type of a value. Numbers with integral values are integers, even if they are stored as floating-point
+// numbers, so equal numbers always have the same type.
+typedef NS_ENUM(uint8_t, TWTJSONType) {
+    // The value is not a JSON value
+    TWTJSONTypeNone,
+    TWTJSONTypeNull,
+    TWTJSONTypeBoolean,
+    TWTJSONTypeInteger,
+    TWTJSONTypeNumber,
+    TWTJSONTypeString,
+    TWTJSONTypeArray,
+    TWTJSONTypeObject
+};
+
+
+// Sets of JSON types. Numbers include integers, since every integer is also a number.
+typedef NS_OPTIONS(uint16_t, TWTJSONTypeMask) {
+    TWTJSONTypeMaskNull = 1 << TWTJSONTypeNull,
+    TWTJSONTypeMaskBoolean = 1 << TWTJSONTypeBoolean,
+    TWTJSONTypeMaskInteger = 1 << TWTJSONTypeInteger,
+    TWTJSONTypeMaskNumber = 1 << TWTJSONTypeNumber | TWTJSONTypeMaskInteger,
+    TWTJSONTypeMaskString = 1 << TWTJSONTypeString,
+    TWTJSONTypeMaskArray = 1 << TWTJSONTypeArray,
+    TWTJSONTypeMaskObject = 1 << TWTJSONTypeObject,
+    TWTJSONTypeMaskAll = TWTJSONTypeMaskNull | TWTJSONTypeMaskBoolean | TWTJSONTypeMaskNumber | TWTJSONTypeMaskString |
+        TWTJSONTypeMaskArray | TWTJSONTypeMaskObject
+};
+
+
+// Returns the JSON type of the value. Booleans are the NSNumber singletons @YES and @NO, which is how
+// NSJSONSerialization represents them.
+extern TWTJSONType TWTJSONTypeOfValue(id value);
+
+// Returns whether the mask includes the type
+static inline BOOL TWTJSONTypeMaskContainsType(TWTJSONTypeMask mask, TWTJSONType type)
+{
+    return type != TWTJSONTypeNone && (mask & (1 << type)) != 0;
+}
+
+// Returns the mask for a set of JSON schema type keywords, e.g., "string" or "integer". "any" includes every type.
+extern TWTJSONTypeMask TWTJSONTypeMaskForSchemaTypes(NSSet *types);
+
+// Returns a description of the types in the mask, e.g., "number, string", for use in error messages
+extern NSString *TWTJSONTypeMaskDescription(TWTJSONTypeMask mask);
+
+
+@interface TWTValidator (TWTJSONType)
+
+// Validates a value whose JSON type is already known using a nil validation context.
+- (BOOL)validateJSONValue:(id)value ofType:(TWTJSONType)type error:(out NSError *__autoreleasing *)outError;
+
+// Validates a value whose JSON type is already known. JSON schema validators override this so that a value is
+// classified once and its type is passed down to the validators that need it along with the validation context. The
+// default implementation ignores the type and invokes -validateValue:context:error:.
+- (BOOL)validateJSONValue:(id)value
+                   ofType:(TWTJSONType)type
+                  context:(TWTValidationContext *)context
+                    error:(out NSError *__autoreleasing *)outError;
+
+@end
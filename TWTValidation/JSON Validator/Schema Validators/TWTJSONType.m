@@ -0,0 +1,131 @@
+//
+//  TWTJSONType.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTJSONType.h>
+
+#import <TWTValidation/TWTJSONSchemaKeywordConstants.h>
+
+
+TWTJSONType TWTJSONTypeOfValue(id value)
+{
+    if ([value isKindOfClass:[NSString class]]) {
+        return TWTJSONTypeString;
+    } else if ([value isKindOfClass:[NSNumber class]]) {
+        if (CFGetTypeID((__bridge CFTypeRef)value) == CFBooleanGetTypeID()) {
+            return TWTJSONTypeBoolean;
+        }
+
+        switch ([(NSNumber *)value objCType][0]) {
+            case 'c': case 's': case 'i': case 'l': case 'q':
+            case 'C': case 'S': case 'I': case 'L': case 'Q':
+                return TWTJSONTypeInteger;
+            default: {
+                // Floating-point numbers and decimals are integers if their value is integral
+                double doubleValue = [(NSNumber *)value doubleValue];
+                return isfinite(doubleValue) && doubleValue == trunc(doubleValue) ? TWTJSONTypeInteger : TWTJSONTypeNumber;
+            }
+        }
+    } else if ([value isKindOfClass:[NSDictionary class]]) {
+        return TWTJSONTypeObject;
+    } else if ([value isKindOfClass:[NSArray class]]) {
+        return TWTJSONTypeArray;
+    } else if (value == [NSNull null]) {
+        return TWTJSONTypeNull;
+    }
+
+    return TWTJSONTypeNone;
+}
+
+
+TWTJSONTypeMask TWTJSONTypeMaskForSchemaTypes(NSSet *types)
+{
+    TWTJSONTypeMask mask = 0;
+    for (NSString *type in types) {
+        if ([type isEqualToString:TWTJSONSchemaTypeKeywordAny]) {
+            return TWTJSONTypeMaskAll;
+        } else if ([type isEqualToString:TWTJSONSchemaTypeKeywordArray]) {
+            mask |= TWTJSONTypeMaskArray;
+        } else if ([type isEqualToString:TWTJSONSchemaTypeKeywordBoolean]) {
+            mask |= TWTJSONTypeMaskBoolean;
+        } else if ([type isEqualToString:TWTJSONSchemaTypeKeywordInteger]) {
+            mask |= TWTJSONTypeMaskInteger;
+        } else if ([type isEqualToString:TWTJSONSchemaTypeKeywordNull]) {
+            mask |= TWTJSONTypeMaskNull;
+        } else if ([type isEqualToString:TWTJSONSchemaTypeKeywordNumber]) {
+            mask |= TWTJSONTypeMaskNumber;
+        } else if ([type isEqualToString:TWTJSONSchemaTypeKeywordObject]) {
+            mask |= TWTJSONTypeMaskObject;
+        } else if ([type isEqualToString:TWTJSONSchemaTypeKeywordString]) {
+            mask |= TWTJSONTypeMaskString;
+        }
+    }
+
+    return mask;
+}
+
+
+NSString *TWTJSONTypeMaskDescription(TWTJSONTypeMask mask)
+{
+    NSMutableArray *types = [[NSMutableArray alloc] init];
+    if (mask & TWTJSONTypeMaskArray) {
+        [types addObject:TWTJSONSchemaTypeKeywordArray];
+    }
+    if (mask & TWTJSONTypeMaskBoolean) {
+        [types addObject:TWTJSONSchemaTypeKeywordBoolean];
+    }
+    if (mask & (1 << TWTJSONTypeNumber)) {
+        [types addObject:TWTJSONSchemaTypeKeywordNumber];
+    } else if (mask & TWTJSONTypeMaskInteger) {
+        [types addObject:TWTJSONSchemaTypeKeywordInteger];
+    }
+    if (mask & TWTJSONTypeMaskNull) {
+        [types addObject:TWTJSONSchemaTypeKeywordNull];
+    }
+    if (mask & TWTJSONTypeMaskObject) {
+        [types addObject:TWTJSONSchemaTypeKeywordObject];
+    }
+    if (mask & TWTJSONTypeMaskString) {
+        [types addObject:TWTJSONSchemaTypeKeywordString];
+    }
+
+    return [types componentsJoinedByString:@", "];
+}
+
+
+@implementation TWTValidator (TWTJSONType)
+
+- (BOOL)validateJSONValue:(id)value ofType:(TWTJSONType)type error:(out NSError *__autoreleasing *)outError
+{
+    return [self validateJSONValue:value ofType:type context:nil error:outError];
+}
+
+
+- (BOOL)validateJSONValue:(id)value ofType:(TWTJSONType)type context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
+    return [self validateValue:value context:context error:outError];
+}
+
+@end
@@ -0,0 +1,44 @@
+//
+//  TWTJSONValueEquality.h
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+@import Foundation;
+
+
+// JSON equality differs from Foundation equality in a few important ways. Booleans are never equal to numbers, even
+// though @YES is equal to @1 as an NSNumber, and numbers are compared by mathematical value, so 1 and 1.0 are equal.
+// Arrays are equal if their items are pairwise equal, and objects are equal if they have the same keys and their
+// values for each key are equal.
+
+// Returns whether the two JSON values are equal
+extern BOOL TWTJSONValuesAreEqual(id value1, id value2);
+
+// Returns a hash for the JSON value that is consistent with TWTJSONValuesAreEqual()
+extern NSUInteger TWTJSONValueHash(id value);
+
+// Returns whether no two items in the array are equal according to TWTJSONValuesAreEqual(). This stops at the first
+// duplicate it finds. Arrays containing only strings or only numbers are checked without any recursive hashing, and
+// small arrays are checked without allocating any memory.
+extern BOOL TWTJSONArrayHasUniqueItems(NSArray *items);
@@ -0,0 +1,356 @@
+//
+//  TWTJSONValueEquality.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTJSONValueEquality.h>
+
+#import <TWTValidation/TWTJSONType.h>
+
+
+// Numbers are reduced to 64-bit keys so that equal numbers have equal keys regardless of how they’re stored. Integral
+// values that fit in a long long use the integer itself; everything else uses the bits of its double value.
+typedef NS_ENUM(uint8_t, TWTJSONNumberKeyKind) {
+    TWTJSONNumberKeyKindNone,
+    TWTJSONNumberKeyKindInteger,
+    TWTJSONNumberKeyKindDouble
+};
+
+
+typedef struct _TWTJSONNumberKey {
+    uint64_t bits;
+    TWTJSONNumberKeyKind kind;
+} TWTJSONNumberKey;
+
+
+static const NSUInteger TWTJSONValueHashNull = 0x9e3779b9;
+static const NSUInteger TWTJSONValueHashTrue = 0x85ebca6b;
+static const NSUInteger TWTJSONValueHashFalse = 0xc2b2ae35;
+
+
+#pragma mark - Classification
+
+static inline uint64_t TWTJSONMixBits(uint64_t bits)
+{
+    // The splitmix64 finalizer, which spreads every input bit across the whole result
+    bits ^= bits >> 30;
+    bits *= 0xbf58476d1ce4e5b9ULL;
+    bits ^= bits >> 27;
+    bits *= 0x94d049bb133111ebULL;
+    return bits ^ (bits >> 31);
+}
+
+
+static TWTJSONNumberKey TWTJSONNumberKeyForNumber(NSNumber *number)
+{
+    TWTJSONNumberKey key;
+    const char type = number.objCType[0];
+
+    switch (type) {
+        case 'c': case 's': case 'i': case 'l': case 'q':
+            key.bits = (uint64_t)number.longLongValue;
+            key.kind = TWTJSONNumberKeyKindInteger;
+            return key;
+        case 'C': case 'S': case 'I': case 'L': case 'Q':
+            if (number.unsignedLongLongValue <= LLONG_MAX) {
+                key.bits = number.unsignedLongLongValue;
+                key.kind = TWTJSONNumberKeyKindInteger;
+                return key;
+            }
+            break;
+    }
+
+    double doubleValue = number.doubleValue;
+    if (doubleValue == trunc(doubleValue) && doubleValue >= -9223372036854775808.0 && doubleValue < 9223372036854775808.0) {
+        key.bits = (uint64_t)(long long)doubleValue;
+        key.kind = TWTJSONNumberKeyKindInteger;
+    } else {
+        memcpy(&key.bits, &doubleValue, sizeof(key.bits));
+        key.kind = TWTJSONNumberKeyKindDouble;
+    }
+
+    return key;
+}
+
+
+static inline NSUInteger TWTJSONNumberKeyHash(TWTJSONNumberKey key)
+{
+    return (NSUInteger)TWTJSONMixBits(key.bits ^ key.kind);
+}
+
+
+#pragma mark - Equality and Hashing
+
+static BOOL TWTJSONValuesOfTypeAreEqual(id value1, id value2, TWTJSONType type)
+{
+    switch (type) {
+        case TWTJSONTypeNull:
+            return YES;
+        case TWTJSONTypeBoolean:
+            return [value1 boolValue] == [value2 boolValue];
+        case TWTJSONTypeInteger:
+        case TWTJSONTypeNumber: {
+            TWTJSONNumberKey key1 = TWTJSONNumberKeyForNumber(value1);
+            TWTJSONNumberKey key2 = TWTJSONNumberKeyForNumber(value2);
+            return key1.kind == key2.kind && key1.bits == key2.bits;
+        }
+        case TWTJSONTypeString:
+            return [value1 isEqualToString:value2];
+        case TWTJSONTypeArray: {
+            NSUInteger count = [value1 count];
+            if ([value2 count] != count) {
+                return NO;
+            }
+
+            for (NSUInteger i = 0; i < count; ++i) {
+                if (!TWTJSONValuesAreEqual([value1 objectAtIndex:i], [value2 objectAtIndex:i])) {
+                    return NO;
+                }
+            }
+
+            return YES;
+        }
+        case TWTJSONTypeObject: {
+            if ([value1 count] != [value2 count]) {
+                return NO;
+            }
+
+            for (id key in value1) {
+                id otherValue = [value2 objectForKey:key];
+                if (!otherValue || !TWTJSONValuesAreEqual([value1 objectForKey:key], otherValue)) {
+                    return NO;
+                }
+            }
+
+            return YES;
+        }
+        case TWTJSONTypeNone:
+            return [value1 isEqual:value2];
+    }
+}
+
+
+BOOL TWTJSONValuesAreEqual(id value1, id value2)
+{
+    if (value1 == value2) {
+        return YES;
+    }
+
+    // Equal numbers always have the same type, since integers are numbers with integral values
+    TWTJSONType type = TWTJSONTypeOfValue(value1);
+    return type == TWTJSONTypeOfValue(value2) && TWTJSONValuesOfTypeAreEqual(value1, value2, type);
+}
+
+
+NSUInteger TWTJSONValueHash(id value)
+{
+    switch (TWTJSONTypeOfValue(value)) {
+        case TWTJSONTypeNull:
+            return TWTJSONValueHashNull;
+        case TWTJSONTypeBoolean:
+            return [value boolValue] ? TWTJSONValueHashTrue : TWTJSONValueHashFalse;
+        case TWTJSONTypeInteger:
+        case TWTJSONTypeNumber:
+            return TWTJSONNumberKeyHash(TWTJSONNumberKeyForNumber(value));
+        case TWTJSONTypeString:
+            return [value hash];
+        case TWTJSONTypeArray: {
+            uint64_t hash = [value count];
+            for (id item in value) {
+                hash = hash * 31 + TWTJSONValueHash(item);
+            }
+
+            return (NSUInteger)TWTJSONMixBits(hash);
+        }
+        case TWTJSONTypeObject: {
+            // Objects are unordered, so their entries’ hashes are combined with a commutative operation
+            uint64_t hash = [value count];
+            for (id key in value) {
+                hash += TWTJSONMixBits([key hash] ^ TWTJSONMixBits(TWTJSONValueHash([value objectForKey:key])));
+            }
+
+            return (NSUInteger)TWTJSONMixBits(hash);
+        }
+        case TWTJSONTypeNone:
+            return [value hash];
+    }
+}
+
+
+#pragma mark - Uniqueness
+
+/*!
+ The largest number of items whose uniqueness is checked by comparing every pair of items. Below this, pairwise
+ comparison is about as fast as hashing and doesn’t need any scratch storage.
+ */
+static const NSUInteger TWTJSONPairwiseUniquenessCountLimit = 16;
+
+
+static inline NSUInteger TWTJSONHashTableCapacityForCount(NSUInteger count)
+{
+    // Keep the table at most half full so that probe sequences stay short
+    NSUInteger capacity = 16;
+    while (capacity < count * 2) {
+        capacity <<= 1;
+    }
+
+    return capacity;
+}
+
+
+static BOOL TWTJSONValuesArePairwiseUnique(NSArray *values, NSUInteger count)
+{
+    __unsafe_unretained id items[TWTJSONPairwiseUniquenessCountLimit];
+    [values getObjects:items range:NSMakeRange(0, count)];
+
+    for (NSUInteger i = 1; i < count; ++i) {
+        for (NSUInteger j = 0; j < i; ++j) {
+            if (TWTJSONValuesAreEqual(items[i], items[j])) {
+                return NO;
+            }
+        }
+    }
+
+    return YES;
+}
+
+
+static BOOL TWTJSONStringsAreUnique(NSArray *strings, NSUInteger count)
+{
+    CFMutableSetRef set = CFSetCreateMutable(kCFAllocatorDefault, count, &kCFTypeSetCallBacks);
+
+    BOOL unique = YES;
+    CFIndex expectedCount = 0;
+    for (NSString *string in strings) {
+        CFSetAddValue(set, (__bridge const void *)string);
+        if (CFSetGetCount(set) == expectedCount) {
+            unique = NO;
+            break;
+        }
+
+        ++expectedCount;
+    }
+
+    CFRelease(set);
+    return unique;
+}
+
+
+static BOOL TWTJSONNumbersAreUnique(NSArray *numbers, NSUInteger count)
+{
+    NSUInteger capacity = TWTJSONHashTableCapacityForCount(count);
+    NSUInteger mask = capacity - 1;
+    TWTJSONNumberKey *table = calloc(capacity, sizeof(TWTJSONNumberKey));
+
+    BOOL unique = YES;
+    for (NSNumber *number in numbers) {
+        TWTJSONNumberKey key = TWTJSONNumberKeyForNumber(number);
+        NSUInteger slot = TWTJSONNumberKeyHash(key) & mask;
+        while (table[slot].kind != TWTJSONNumberKeyKindNone) {
+            if (table[slot].kind == key.kind && table[slot].bits == key.bits) {
+                unique = NO;
+                break;
+            }
+
+            slot = (slot + 1) & mask;
+        }
+
+        if (!unique) {
+            break;
+        }
+
+        table[slot] = key;
+    }
+
+    free(table);
+    return unique;
+}
+
+
+static BOOL TWTJSONValuesAreUnique(NSArray *values, NSUInteger count)
+{
+    NSUInteger capacity = TWTJSONHashTableCapacityForCount(count);
+    NSUInteger mask = capacity - 1;
+
+    // Each slot holds the index of a value plus one, so that zero can mean empty
+    NSUInteger *table = calloc(capacity, sizeof(NSUInteger));
+    NSUInteger *hashes = malloc(count * sizeof(NSUInteger));
+
+    BOOL unique = YES;
+    for (NSUInteger i = 0; i < count && unique; ++i) {
+        id value = [values objectAtIndex:i];
+        NSUInteger hash = TWTJSONValueHash(value);
+        hashes[i] = hash;
+
+        NSUInteger slot = hash & mask;
+        while (table[slot]) {
+            NSUInteger otherIndex = table[slot] - 1;
+            if (hashes[otherIndex] == hash && TWTJSONValuesAreEqual([values objectAtIndex:otherIndex], value)) {
+                unique = NO;
+                break;
+            }
+
+            slot = (slot + 1) & mask;
+        }
+
+        if (unique) {
+            table[slot] = i + 1;
+        }
+    }
+
+    free(hashes);
+    free(table);
+    return unique;
+}
+
+
+BOOL TWTJSONArrayHasUniqueItems(NSArray *items)
+{
+    NSUInteger count = items.count;
+    if (count < 2) {
+        return YES;
+    } else if (count <= TWTJSONPairwiseUniquenessCountLimit) {
+        return TWTJSONValuesArePairwiseUnique(items, count);
+    }
+
+    // Arrays of only strings or only numbers are common (e.g., arrays of IDs) and can be checked more cheaply
+    BOOL allStrings = YES;
+    BOOL allNumbers = YES;
+    for (id item in items) {
+        TWTJSONType type = TWTJSONTypeOfValue(item);
+        allStrings = allStrings && type == TWTJSONTypeString;
+        allNumbers = allNumbers && (type == TWTJSONTypeInteger || type == TWTJSONTypeNumber);
+        if (!allStrings && !allNumbers) {
+            break;
+        }
+    }
+
+    if (allStrings) {
+        return TWTJSONStringsAreUnique(items, count);
+    } else if (allNumbers) {
+        return TWTJSONNumbersAreUnique(items, count);
+    }
+
+    return TWTJSONValuesAreUnique(items, count);
+}
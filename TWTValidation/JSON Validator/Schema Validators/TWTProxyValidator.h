@@ -25,6 +25,7 @@
 //
 
 #import <TWTValidation/TWTValidation.h>
+#import <TWTValidation/TWTJSONType.h>
 
 
 @interface TWTProxyValidator : TWTValidator
@@ -34,4 +34,16 @@
     return [self.validator validateValue:value error:outError];
 }
 
+
+- (BOOL)validateValue:(id)value context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
+    return [self.validator validateValue:value context:context error:outError];
+}
+
+
+- (BOOL)validateJSONValue:(id)value ofType:(TWTJSONType)type context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
+    return [self.validator validateJSONValue:value ofType:type context:context error:outError];
+}
+
 @end
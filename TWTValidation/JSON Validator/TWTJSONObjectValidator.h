@@ -24,9 +24,13 @@
 //  THE SOFTWARE.
 //
 
-#import <TWTValidation/TWTValidator.h>
+#import <TWTValidation/TWTJSONType.h>
 
 
+// Validating a valid value without an error pointer doesn’t allocate any memory, as errors and the bookkeeping needed to
+// build them are only created when they’re requested. The exceptions are pattern keywords that TWTRegularExpressionMatcher
+// doesn’t support, the first match of each key against patternProperties, uniqueItems checks on arrays with more than
+// 16 items, and validation that uses a concurrent executor.
 @interface TWTJSONObjectValidator : TWTValidator
 
 @property (nonatomic, copy, readonly) NSDictionary *schema;
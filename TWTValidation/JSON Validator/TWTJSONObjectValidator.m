@@ -92,8 +92,20 @@
 
 
 - (BOOL)validateValue:(id)value error:(out NSError *__autoreleasing *)outError
+{
+    return [self validateValue:value context:nil error:outError];
+}
+
+
+- (BOOL)validateValue:(id)value context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
 {
     // Does not call super because NULL can be valid
+    return [self validateJSONValue:value ofType:TWTJSONTypeOfValue(value) context:context error:outError];
+}
+
+
+- (BOOL)validateJSONValue:(id)value ofType:(TWTJSONType)type context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
     if (!self.commonValidator && !self.typeValidator) {
         return YES;
     }
@@ -105,11 +117,11 @@
     NSError *typeError = nil;
 
     if (self.commonValidator) {
-        commonKeywordsValidated = [self.commonValidator validateValue:value error:outError ? &commonError : NULL];
+        commonKeywordsValidated = [self.commonValidator validateJSONValue:value ofType:type context:context error:outError ? &commonError : NULL];
     }
 
     if (self.typeValidator) {
-        typeKeywordsValidated = [self.typeValidator validateValue:value error:outError ? &typeError : NULL];
+        typeKeywordsValidated = [self.typeValidator validateJSONValue:value ofType:type context:context error:outError ? &typeError : NULL];
     }
 
     BOOL validated = commonKeywordsValidated && typeKeywordsValidated;
@@ -128,8 +140,13 @@
         *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeJSONObjectValidatorError
                                         failingValidator:self
                                                    value:value
-                                    localizedDescription:TWTLocalizedString(@"TWTJSONObjectValidator.validationError")
+                               localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTJSONObjectValidator.validationError"); }
                                         underlyingErrors:underlyingErrors];
+
+        *outError = TWTValidationContextErrorByMarkingTruncation(context, *outError);
+
+        // Validators for properties and items add paths to their errors, so this only adds paths to errors for this value
+        *outError = TWTValidationContextErrorByAddingCurrentPaths(context, *outError);
     }
 
     return validated;
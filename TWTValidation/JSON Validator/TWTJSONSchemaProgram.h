@@ -0,0 +1,53 @@
+//
+//  TWTJSONSchemaProgram.h
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTValidator.h>
+
+
+// TWTJSONSchemaPrograms are JSON schemas compiled into a flat array of instructions, which a single interpreter loop
+// executes. Where a TWTJSONObjectValidator evaluates a graph of compound, proxy, block, and key-value pair validators,
+// a program performs the same type tests, range checks, and property dispatch without sending a message for each
+// node of the graph. Programs and object validators created from the same schema always agree on which values are
+// valid.
+//
+// Compiling a program is optional and separate from creating an object validator. Programs only determine whether a
+// value is valid; when a value is invalid and an error is requested, the error is created by the object validator
+// for the program’s schema, so it has the same underlying errors as the object validator would have returned.
+// Programs are immutable and may be used from multiple threads at once.
+@interface TWTJSONSchemaProgram : TWTValidator
+
+@property (nonatomic, copy, readonly) NSDictionary *schema;
+
+@property (nonatomic, assign, readonly) NSUInteger instructionCount;
+
+// The number of schemas compiled into the program, including referenced schemas
+@property (nonatomic, assign, readonly) NSUInteger subroutineCount;
+
++ (TWTJSONSchemaProgram *)programWithJSONSchema:(NSDictionary *)schema
+                                          error:(NSError *__autoreleasing *)outError
+                                       warnings:(NSArray *__autoreleasing *)outWarnings;
+
+@end
@@ -0,0 +1,387 @@
+//
+//  TWTJSONSchemaProgram.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTJSONSchemaProgram.h>
+
+#import <TWTValidation/TWTJSONObjectValidator.h>
+#import <TWTValidation/TWTJSONSchemaProgramCompiler.h>
+#import <TWTValidation/TWTJSONValueEquality.h>
+#import <TWTValidation/TWTValidationErrors.h>
+#import <TWTValidation/TWTValidationLocalization.h>
+
+
+@interface TWTJSONSchemaProgram ()
+
+@property (nonatomic, copy, readwrite) NSDictionary *schema;
+
+@end
+
+
+@implementation TWTJSONSchemaProgram {
+    NSData *_instructionData;
+    NSData *_subroutineOffsetData;
+    NSArray *_constants;
+
+    // Unretained views of the data and constants above, which the interpreter reads directly
+    const TWTJSONSchemaInstruction *_instructions;
+    const uint32_t *_subroutineOffsets;
+    __unsafe_unretained id *_constantObjects;
+
+    // The object validator that creates the program’s errors, which is compiled the first time one is needed
+    TWTJSONObjectValidator *_errorValidator;
+}
+
++ (TWTJSONSchemaProgram *)programWithJSONSchema:(NSDictionary *)schema error:(NSError *__autoreleasing *)outError warnings:(NSArray *__autoreleasing *)outWarnings
+{
+    NSParameterAssert(schema);
+    return [[[TWTJSONSchemaProgramCompiler alloc] init] programFromJSONSchema:schema error:outError warnings:outWarnings];
+}
+
+
+- (instancetype)init
+{
+    TWTJSONSchemaInstruction instruction;
+    memset(&instruction, 0, sizeof(instruction));
+    instruction.opcode = TWTJSONSchemaOpcodeSucceed;
+
+    uint32_t offset = 0;
+    return [self initWithSchema:@{ }
+                   instructions:[NSData dataWithBytes:&instruction length:sizeof(instruction)]
+             subroutineOffsets:[NSData dataWithBytes:&offset length:sizeof(offset)]
+                      constants:nil];
+}
+
+
+- (instancetype)initWithSchema:(NSDictionary *)schema instructions:(NSData *)instructions subroutineOffsets:(NSData *)subroutineOffsets constants:(NSArray *)constants
+{
+    NSParameterAssert(instructions.length >= sizeof(TWTJSONSchemaInstruction));
+    NSParameterAssert(subroutineOffsets.length >= sizeof(uint32_t));
+
+    self = [super init];
+    if (self) {
+        _schema = [schema copy];
+        _instructionData = [instructions copy];
+        _subroutineOffsetData = [subroutineOffsets copy];
+        _constants = [constants copy];
+
+        _instructions = _instructionData.bytes;
+        _subroutineOffsets = _subroutineOffsetData.bytes;
+        _constantObjects = (__unsafe_unretained id *)calloc(MAX(_constants.count, 1), sizeof(id));
+        [_constants getObjects:_constantObjects range:NSMakeRange(0, _constants.count)];
+    }
+
+    return self;
+}
+
+
+- (void)dealloc
+{
+    free(_constantObjects);
+}
+
+
+- (NSUInteger)instructionCount
+{
+    return _instructionData.length / sizeof(TWTJSONSchemaInstruction);
+}
+
+
+- (NSUInteger)subroutineCount
+{
+    return _subroutineOffsetData.length / sizeof(uint32_t);
+}
+
+
+- (NSUInteger)hash
+{
+    return [super hash] ^ self.schema.hash;
+}
+
+
+- (BOOL)isEqual:(id)object
+{
+    if (![super isEqual:object]) {
+        return NO;
+    } else if (self == object) {
+        return YES;
+    }
+
+    typeof(self) other = object;
+    return [other.schema isEqualToDictionary:self.schema];
+}
+
+
+#pragma mark - Interpreter
+
+/*!
+ @abstract Executes the specified subroutine of a program on a value.
+ @param program The program.
+ @param subroutine The index of the subroutine.
+ @param value The value being validated.
+ @result Whether the value is valid.
+ */
+static BOOL TWTJSONSchemaProgramExecute(__unsafe_unretained TWTJSONSchemaProgram *program, uint32_t subroutine, id value);
+
+
+/*!
+ @abstract Validates the properties of an object using the specified property table.
+ @param program The program.
+ @param propertyTable The property table.
+ @param object The object whose properties are being validated.
+ @result Whether every property is valid.
+ */
+static BOOL TWTJSONSchemaProgramValidateProperties(__unsafe_unretained TWTJSONSchemaProgram *program, TWTJSONSchemaPropertyTable *propertyTable, NSDictionary *object)
+{
+    NSDictionary *propertySubroutines = propertyTable.propertySubroutines;
+    NSArray *patternRegularExpressions = propertyTable.patternRegularExpressions;
+    NSArray *patternSubroutines = propertyTable.patternSubroutines;
+    NSUInteger patternCount = patternRegularExpressions.count;
+    uint32_t additionalPropertiesSubroutine = propertyTable.additionalPropertiesSubroutine;
+    NSDictionary *dependencies = propertyTable.dependencies;
+
+    for (NSString *key in object) {
+        id propertyValue = [object objectForKey:key];
+        BOOL propertyIsDefined = NO;
+
+        NSNumber *propertySubroutine = [propertySubroutines objectForKey:key];
+        if (propertySubroutine) {
+            propertyIsDefined = YES;
+            if (!TWTJSONSchemaProgramExecute(program, propertySubroutine.unsignedIntValue, propertyValue)) {
+                return NO;
+            }
+        }
+
+        if (patternCount) {
+            NSRange keyRange = NSMakeRange(0, key.length);
+            for (NSUInteger i = 0; i < patternCount; ++i) {
+                if ([patternRegularExpressions[i] rangeOfFirstMatchInString:key options:0 range:keyRange].location != NSNotFound) {
+                    propertyIsDefined = YES;
+                    if (!TWTJSONSchemaProgramExecute(program, [patternSubroutines[i] unsignedIntValue], propertyValue)) {
+                        return NO;
+                    }
+                }
+            }
+        }
+
+        if (!propertyIsDefined && additionalPropertiesSubroutine != TWTJSONSchemaNoSubroutine &&
+            !TWTJSONSchemaProgramExecute(program, additionalPropertiesSubroutine, propertyValue)) {
+            return NO;
+        }
+
+        id dependency = [dependencies objectForKey:key];
+        if ([dependency isKindOfClass:[NSNumber class]]) {
+            if (!TWTJSONSchemaProgramExecute(program, [dependency unsignedIntValue], object)) {
+                return NO;
+            }
+        } else if (dependency) {
+            for (NSString *requiredKey in dependency) {
+                if (![object objectForKey:requiredKey]) {
+                    return NO;
+                }
+            }
+        }
+    }
+
+    return YES;
+}
+
+
+static BOOL TWTJSONSchemaProgramExecute(__unsafe_unretained TWTJSONSchemaProgram *program, uint32_t subroutine, id value)
+{
+    const TWTJSONSchemaInstruction *instruction = program->_instructions + program->_subroutineOffsets[subroutine];
+    __unsafe_unretained id *constants = program->_constantObjects;
+
+    // The value’s type is only determined if an instruction needs it, and then only once
+    TWTJSONType type = TWTJSONTypeNone;
+    BOOL typeIsKnown = NO;
+
+    for (;; ++instruction) {
+        switch (instruction->opcode) {
+            case TWTJSONSchemaOpcodeSucceed:
+                return YES;
+            case TWTJSONSchemaOpcodeFail:
+                return NO;
+            case TWTJSONSchemaOpcodeTestType:
+            case TWTJSONSchemaOpcodeSkipUnlessType:
+                if (!typeIsKnown) {
+                    type = TWTJSONTypeOfValue(value);
+                    typeIsKnown = YES;
+                }
+
+                if (!TWTJSONTypeMaskContainsType(instruction->operand.typeMask, type)) {
+                    if (instruction->opcode == TWTJSONSchemaOpcodeTestType) {
+                        return NO;
+                    }
+
+                    instruction += instruction->target;
+                }
+                break;
+            case TWTJSONSchemaOpcodeCheckValidator:
+                if (![(TWTValidator *)constants[instruction->operand.index] validateValue:value error:NULL]) {
+                    return NO;
+                }
+                break;
+            case TWTJSONSchemaOpcodeCheckMultipleOf: {
+                double result = [(NSNumber *)value doubleValue] / instruction->operand.doubleValue;
+                if (result != trunc(result)) {
+                    return NO;
+                }
+                break;
+            }
+            case TWTJSONSchemaOpcodeCheckMinimumCount:
+                if ([value count] < instruction->operand.count) {
+                    return NO;
+                }
+                break;
+            case TWTJSONSchemaOpcodeCheckMaximumCount:
+                if ([value count] > instruction->operand.count) {
+                    return NO;
+                }
+                break;
+            case TWTJSONSchemaOpcodeCheckUniqueItems:
+                if (!TWTJSONArrayHasUniqueItems(value)) {
+                    return NO;
+                }
+                break;
+            case TWTJSONSchemaOpcodeCheckRequiredKeys:
+                for (NSString *key in (NSArray *)constants[instruction->operand.index]) {
+                    if (![value objectForKey:key]) {
+                        return NO;
+                    }
+                }
+                break;
+            case TWTJSONSchemaOpcodeCall:
+                if (!TWTJSONSchemaProgramExecute(program, instruction->target, value)) {
+                    return NO;
+                }
+                break;
+            case TWTJSONSchemaOpcodeCallAll:
+            case TWTJSONSchemaOpcodeCallAny:
+            case TWTJSONSchemaOpcodeCallOne:
+            case TWTJSONSchemaOpcodeCallNone: {
+                TWTJSONSchemaOpcode opcode = instruction->opcode;
+                const TWTJSONSchemaInstruction *subroutines = instruction + 1;
+                NSUInteger subroutineCount = instruction->operand.count;
+                instruction += subroutineCount;
+
+                NSUInteger passCount = 0;
+                for (NSUInteger i = 0; i < subroutineCount; ++i) {
+                    if (TWTJSONSchemaProgramExecute(program, subroutines[i].target, value)) {
+                        ++passCount;
+                        if (opcode == TWTJSONSchemaOpcodeCallAny || opcode == TWTJSONSchemaOpcodeCallNone || (opcode == TWTJSONSchemaOpcodeCallOne && passCount > 1)) {
+                            break;
+                        }
+                    } else if (opcode == TWTJSONSchemaOpcodeCallAll) {
+                        return NO;
+                    }
+                }
+
+                if ((opcode == TWTJSONSchemaOpcodeCallAny && passCount == 0) || (opcode == TWTJSONSchemaOpcodeCallOne && passCount != 1) ||
+                    (opcode == TWTJSONSchemaOpcodeCallNone && passCount != 0)) {
+                    return NO;
+                }
+                break;
+            }
+            case TWTJSONSchemaOpcodeSubroutine:
+                // Subroutine instructions are skipped by the instructions that precede them
+                NSCAssert(NO, @"subroutine instruction executed");
+                break;
+            case TWTJSONSchemaOpcodeValidateItems:
+                for (id item in (NSArray *)value) {
+                    if (!TWTJSONSchemaProgramExecute(program, instruction->target, item)) {
+                        return NO;
+                    }
+                }
+                break;
+            case TWTJSONSchemaOpcodeValidateIndexedItems: {
+                const TWTJSONSchemaInstruction *subroutines = instruction + 1;
+                NSUInteger subroutineCount = instruction->operand.count;
+                uint32_t additionalItemsSubroutine = instruction->target;
+                instruction += subroutineCount;
+
+                NSUInteger index = 0;
+                for (id item in (NSArray *)value) {
+                    uint32_t itemSubroutine = index < subroutineCount ? subroutines[index].target : additionalItemsSubroutine;
+                    if (itemSubroutine == TWTJSONSchemaNoSubroutine) {
+                        break;
+                    } else if (!TWTJSONSchemaProgramExecute(program, itemSubroutine, item)) {
+                        return NO;
+                    }
+
+                    ++index;
+                }
+                break;
+            }
+            case TWTJSONSchemaOpcodeValidateProperties:
+                if (!TWTJSONSchemaProgramValidateProperties(program, constants[instruction->operand.index], value)) {
+                    return NO;
+                }
+                break;
+        }
+    }
+}
+
+
+#pragma mark - Validation
+
+- (BOOL)validateValue:(id)value error:(out NSError *__autoreleasing *)outError
+{
+    if (TWTJSONSchemaProgramExecute(self, 0, value)) {
+        return YES;
+    }
+
+    if (outError) {
+        *outError = [self validationErrorForInvalidValue:value];
+    }
+
+    return NO;
+}
+
+
+- (NSError *)validationErrorForInvalidValue:(id)value
+{
+    // Programs only know that a value is invalid, so we use the schema’s object validator to describe why
+    NSError *error = nil;
+    TWTJSONObjectValidator *validator = nil;
+    @synchronized(self) {
+        if (!_errorValidator) {
+            _errorValidator = [TWTJSONObjectValidator validatorWithJSONSchema:self.schema error:NULL warnings:NULL];
+        }
+
+        validator = _errorValidator;
+    }
+
+    if (validator && ![validator validateValue:value error:&error] && error) {
+        return error;
+    }
+
+    return [NSError twt_validationErrorWithCode:TWTValidationErrorCodeJSONObjectValidatorError
+                               failingValidator:self
+                                          value:value
+                      localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTJSONObjectValidator.validationError"); }];
+}
+
+@end
@@ -0,0 +1,113 @@
+//
+//  TWTJSONSchemaValidatorCache.h
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+@import Foundation;
+
+@class TWTJSONObjectValidator;
+
+
+/*!
+ TWTJSONSchemaValidatorCaches store the JSON object validators compiled from JSON schemas so that each schema is only
+ parsed and compiled once. Validators are keyed by a digest of a canonical representation of their schemas, so two
+ schema dictionaries that are equal produce the same key regardless of how they were created.
+
+ Caching is opt-in: +[TWTJSONObjectValidator validatorWithJSONSchema:error:warnings:] always compiles a new validator,
+ so only code that looks validators up in a cache gets cached ones. Because a cached validator reflects any remote
+ schemas its schema referenced when it was compiled, schemas whose remote references may change should not be cached,
+ or the cache should be cleared when they do.
+
+ The cache has a total cost limit, measured in bytes of canonical schema representation, which is a rough proxy for
+ the memory used by the compiled validators. When adding a validator causes the total cost to exceed the limit, the
+ least recently used validators are evicted until the cost is once again below the limit.
+
+ TWTJSONSchemaValidatorCaches are safe to use from multiple threads.
+ */
+@interface TWTJSONSchemaValidatorCache : NSObject
+
+/*!
+ @abstract The total cost of validators the cache can hold before it starts evicting them.
+ @discussion The cost of a validator is the size in bytes of its schema’s canonical representation. A value of 0 means
+     there is no limit. The default is 4 MB.
+ */
+@property (nonatomic, assign) NSUInteger totalCostLimit;
+
+/*! The total cost of the validators currently in the cache. */
+@property (nonatomic, assign, readonly) NSUInteger totalCost;
+
+/*! The number of validators currently in the cache. */
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/*! The number of times a validator was found in the cache. */
+@property (nonatomic, assign, readonly) NSUInteger hitCount;
+
+/*! The number of times a validator was not found in the cache and had to be compiled. */
+@property (nonatomic, assign, readonly) NSUInteger missCount;
+
+/*!
+ @abstract Returns a process-wide validator cache.
+ @discussion Nothing in TWTValidation adds validators to this cache; it is only a convenient cache for clients to
+     share.
+ @result The shared validator cache.
+ */
++ (instancetype)sharedCache;
+
+/*!
+ @abstract Returns a validator for the specified JSON schema, compiling and caching it if necessary.
+ @discussion Schemas that fail to compile are not cached. Warnings generated while compiling a schema are cached with
+     its validator and returned on every subsequent lookup.
+
+     Note that schemas that reference other files are cached by the contents of the referencing schema only. If a
+     referenced file changes, the cache should be cleared using -removeAllValidators.
+ @param schema The JSON schema. May not be nil.
+ @param outError On return, contains an error if the schema could not be compiled.
+ @param outWarnings On return, contains the warnings generated while compiling the schema.
+ @result The validator for the schema, or nil if the schema could not be compiled.
+ */
+- (TWTJSONObjectValidator *)validatorForJSONSchema:(NSDictionary *)schema
+                                             error:(NSError *__autoreleasing *)outError
+                                          warnings:(NSArray *__autoreleasing *)outWarnings;
+
+/*!
+ @abstract Removes all validators from the cache.
+ @discussion This does not reset the hit and miss counts.
+ */
+- (void)removeAllValidators;
+
+/*!
+ @abstract Resets the cache’s hit and miss counts to zero.
+ */
+- (void)resetStatistics;
+
+/*!
+ @abstract Returns a digest that uniquely identifies the specified JSON schema.
+ @discussion The digest is a SHA-256 hash of a canonical representation of the schema in which dictionary keys are
+     sorted. Equal schemas always have the same digest.
+ @param schema The JSON schema. May not be nil.
+ @result A hexadecimal digest string.
+ */
++ (NSString *)digestForJSONSchema:(NSDictionary *)schema;
+
+@end
@@ -0,0 +1,411 @@
+//
+//  TWTJSONSchemaValidatorCache.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTJSONSchemaValidatorCache.h>
+
+#import <CommonCrypto/CommonDigest.h>
+
+#import <TWTValidation/TWTJSONObjectValidator.h>
+#import <TWTValidation/TWTJSONObjectValidatorGenerator.h>
+
+
+static const NSUInteger TWTJSONSchemaValidatorCacheDefaultTotalCostLimit = 4 * 1024 * 1024;
+
+
+#pragma mark - Canonical Representation
+
+static void TWTAppendCanonicalJSONRepresentation(NSMutableData *data, id object);
+
+
+static void TWTAppendCanonicalString(NSMutableData *data, NSString *string)
+{
+    // Strings are length-prefixed so that no string can be confused with the structure around it
+    NSData *stringData = [string dataUsingEncoding:NSUTF8StringEncoding];
+    NSString *prefix = [NSString stringWithFormat:@"s%lu:", (unsigned long)stringData.length];
+    [data appendData:[prefix dataUsingEncoding:NSUTF8StringEncoding]];
+    [data appendData:stringData];
+}
+
+
+static void TWTAppendCanonicalJSONRepresentation(NSMutableData *data, id object)
+{
+    if ([object isKindOfClass:[NSDictionary class]]) {
+        [data appendBytes:"{" length:1];
+        for (id key in [[object allKeys] sortedArrayUsingSelector:@selector(compare:)]) {
+            TWTAppendCanonicalJSONRepresentation(data, key);
+            TWTAppendCanonicalJSONRepresentation(data, [object objectForKey:key]);
+        }
+        [data appendBytes:"}" length:1];
+    } else if ([object isKindOfClass:[NSArray class]]) {
+        [data appendBytes:"[" length:1];
+        for (id element in object) {
+            TWTAppendCanonicalJSONRepresentation(data, element);
+        }
+        [data appendBytes:"]" length:1];
+    } else if ([object isKindOfClass:[NSString class]]) {
+        TWTAppendCanonicalString(data, object);
+    } else if ([object isKindOfClass:[NSNumber class]]) {
+        // Booleans and numbers are distinct in JSON, even though both are NSNumbers
+        if (CFGetTypeID((__bridge CFTypeRef)object) == CFBooleanGetTypeID()) {
+            [data appendBytes:([object boolValue] ? "t" : "f") length:1];
+        } else {
+            [data appendBytes:"n" length:1];
+            TWTAppendCanonicalString(data, [object stringValue]);
+        }
+    } else if (object == [NSNull null]) {
+        [data appendBytes:"z" length:1];
+    } else {
+        [data appendBytes:"o" length:1];
+        TWTAppendCanonicalString(data, [object description]);
+    }
+}
+
+
+#pragma mark - Cache Entries
+
+/*!
+ TWTJSONSchemaValidatorCacheEntries are the nodes of the cache’s least-recently-used list.
+ */
+@interface TWTJSONSchemaValidatorCacheEntry : NSObject
+
+@property (nonatomic, copy) NSString *digest;
+@property (nonatomic, strong) TWTJSONObjectValidator *validator;
+@property (nonatomic, copy) NSArray *warnings;
+@property (nonatomic, assign) NSUInteger cost;
+
+// The cache’s entry dictionary owns all entries, so the list links need not retain them
+@property (nonatomic, unsafe_unretained) TWTJSONSchemaValidatorCacheEntry *previousEntry;
+@property (nonatomic, unsafe_unretained) TWTJSONSchemaValidatorCacheEntry *nextEntry;
+
+@end
+
+
+@implementation TWTJSONSchemaValidatorCacheEntry
+
+@end
+
+
+#pragma mark - Cache
+
+@interface TWTJSONObjectValidator (TWTJSONSchemaValidatorCache)
+
+- (void)setSchema:(NSDictionary *)schema;
+
+@end
+
+
+@interface TWTJSONSchemaValidatorCache ()
+
+@property (nonatomic, strong, readonly) dispatch_queue_t queue;
+@property (nonatomic, strong, readonly) NSMutableDictionary *entriesByDigest;
+
+// The most and least recently used entries, respectively
+@property (nonatomic, unsafe_unretained) TWTJSONSchemaValidatorCacheEntry *headEntry;
+@property (nonatomic, unsafe_unretained) TWTJSONSchemaValidatorCacheEntry *tailEntry;
+
+@property (nonatomic, assign, readwrite) NSUInteger totalCost;
+@property (nonatomic, assign, readwrite) NSUInteger hitCount;
+@property (nonatomic, assign, readwrite) NSUInteger missCount;
+
+@end
+
+
+@implementation TWTJSONSchemaValidatorCache
+
+@synthesize totalCostLimit = _totalCostLimit;
+
++ (instancetype)sharedCache
+{
+    static TWTJSONSchemaValidatorCache *sharedCache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedCache = [[self alloc] init];
+    });
+
+    return sharedCache;
+}
+
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _queue = dispatch_queue_create("com.ticketmaster.TWTValidation.TWTJSONSchemaValidatorCache", DISPATCH_QUEUE_SERIAL);
+        _entriesByDigest = [[NSMutableDictionary alloc] init];
+        _totalCostLimit = TWTJSONSchemaValidatorCacheDefaultTotalCostLimit;
+    }
+
+    return self;
+}
+
+
+#pragma mark - Properties
+
+- (NSUInteger)totalCostLimit
+{
+    __block NSUInteger totalCostLimit = 0;
+    dispatch_sync(self.queue, ^{
+        totalCostLimit = _totalCostLimit;
+    });
+
+    return totalCostLimit;
+}
+
+
+- (void)setTotalCostLimit:(NSUInteger)totalCostLimit
+{
+    dispatch_sync(self.queue, ^{
+        _totalCostLimit = totalCostLimit;
+        [self evictEntriesExceedingTotalCostLimit];
+    });
+}
+
+
+- (NSUInteger)count
+{
+    __block NSUInteger count = 0;
+    dispatch_sync(self.queue, ^{
+        count = self.entriesByDigest.count;
+    });
+
+    return count;
+}
+
+
+- (NSUInteger)totalCost
+{
+    __block NSUInteger totalCost = 0;
+    dispatch_sync(self.queue, ^{
+        totalCost = _totalCost;
+    });
+
+    return totalCost;
+}
+
+
+- (NSUInteger)hitCount
+{
+    __block NSUInteger hitCount = 0;
+    dispatch_sync(self.queue, ^{
+        hitCount = _hitCount;
+    });
+
+    return hitCount;
+}
+
+
+- (NSUInteger)missCount
+{
+    __block NSUInteger missCount = 0;
+    dispatch_sync(self.queue, ^{
+        missCount = _missCount;
+    });
+
+    return missCount;
+}
+
+
+#pragma mark - Lookup
+
+- (TWTJSONObjectValidator *)validatorForJSONSchema:(NSDictionary *)schema
+                                             error:(NSError *__autoreleasing *)outError
+                                          warnings:(NSArray *__autoreleasing *)outWarnings
+{
+    NSParameterAssert(schema);
+
+    NSData *canonicalData = [[self class] canonicalDataForJSONSchema:schema];
+    NSString *digest = [[self class] digestForCanonicalData:canonicalData];
+
+    __block TWTJSONSchemaValidatorCacheEntry *entry = nil;
+    dispatch_sync(self.queue, ^{
+        entry = self.entriesByDigest[digest];
+        if (entry) {
+            _hitCount++;
+            [self moveEntryToHead:entry];
+        } else {
+            _missCount++;
+        }
+    });
+
+    if (!entry) {
+        // Compile outside of the queue so that other lookups aren’t blocked. If two threads race to compile the same
+        // schema, the first one to finish wins and the other’s validator is discarded.
+        NSArray *warnings = nil;
+        TWTJSONObjectValidatorGenerator *generator = [[TWTJSONObjectValidatorGenerator alloc] init];
+        TWTJSONObjectValidator *validator = [generator validatorFromJSONSchema:schema error:outError warnings:&warnings];
+        if (!validator) {
+            if (outWarnings) {
+                *outWarnings = warnings;
+            }
+
+            return nil;
+        }
+
+        validator.schema = schema;
+
+        TWTJSONSchemaValidatorCacheEntry *newEntry = [[TWTJSONSchemaValidatorCacheEntry alloc] init];
+        newEntry.digest = digest;
+        newEntry.validator = validator;
+        newEntry.warnings = warnings;
+        newEntry.cost = canonicalData.length;
+
+        dispatch_sync(self.queue, ^{
+            entry = self.entriesByDigest[digest];
+            if (entry) {
+                [self moveEntryToHead:entry];
+            } else {
+                entry = newEntry;
+                [self insertEntry:entry];
+            }
+        });
+    }
+
+    if (outWarnings) {
+        *outWarnings = entry.warnings;
+    }
+
+    return entry.validator;
+}
+
+
+- (void)removeAllValidators
+{
+    dispatch_sync(self.queue, ^{
+        [self.entriesByDigest removeAllObjects];
+        self.headEntry = nil;
+        self.tailEntry = nil;
+        _totalCost = 0;
+    });
+}
+
+
+- (void)resetStatistics
+{
+    dispatch_sync(self.queue, ^{
+        _hitCount = 0;
+        _missCount = 0;
+    });
+}
+
+
+#pragma mark - Least-Recently-Used List
+
+// The following methods must only be invoked on the cache’s queue
+
+- (void)insertEntry:(TWTJSONSchemaValidatorCacheEntry *)entry
+{
+    self.entriesByDigest[entry.digest] = entry;
+    _totalCost += entry.cost;
+
+    entry.nextEntry = self.headEntry;
+    self.headEntry.previousEntry = entry;
+    self.headEntry = entry;
+    if (!self.tailEntry) {
+        self.tailEntry = entry;
+    }
+
+    [self evictEntriesExceedingTotalCostLimit];
+}
+
+
+- (void)moveEntryToHead:(TWTJSONSchemaValidatorCacheEntry *)entry
+{
+    if (entry == self.headEntry) {
+        return;
+    }
+
+    [self unlinkEntry:entry];
+    entry.nextEntry = self.headEntry;
+    self.headEntry.previousEntry = entry;
+    self.headEntry = entry;
+    if (!self.tailEntry) {
+        self.tailEntry = entry;
+    }
+}
+
+
+- (void)unlinkEntry:(TWTJSONSchemaValidatorCacheEntry *)entry
+{
+    if (entry.previousEntry) {
+        entry.previousEntry.nextEntry = entry.nextEntry;
+    } else {
+        self.headEntry = entry.nextEntry;
+    }
+
+    if (entry.nextEntry) {
+        entry.nextEntry.previousEntry = entry.previousEntry;
+    } else {
+        self.tailEntry = entry.previousEntry;
+    }
+
+    entry.previousEntry = nil;
+    entry.nextEntry = nil;
+}
+
+
+- (void)evictEntriesExceedingTotalCostLimit
+{
+    // Always keep the most recently used entry, even if it alone exceeds the limit
+    while (_totalCostLimit > 0 && _totalCost > _totalCostLimit && self.tailEntry && self.tailEntry != self.headEntry) {
+        TWTJSONSchemaValidatorCacheEntry *entry = self.tailEntry;
+        [self unlinkEntry:entry];
+        _totalCost -= entry.cost;
+        [self.entriesByDigest removeObjectForKey:entry.digest];
+    }
+}
+
+
+#pragma mark - Digests
+
++ (NSString *)digestForJSONSchema:(NSDictionary *)schema
+{
+    NSParameterAssert(schema);
+    return [self digestForCanonicalData:[self canonicalDataForJSONSchema:schema]];
+}
+
+
++ (NSData *)canonicalDataForJSONSchema:(NSDictionary *)schema
+{
+    NSMutableData *data = [[NSMutableData alloc] init];
+    TWTAppendCanonicalJSONRepresentation(data, schema);
+    return data;
+}
+
+
++ (NSString *)digestForCanonicalData:(NSData *)data
+{
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256(data.bytes, (CC_LONG)data.length, digest);
+
+    NSMutableString *digestString = [[NSMutableString alloc] initWithCapacity:CC_SHA256_DIGEST_LENGTH * 2];
+    for (NSUInteger i = 0; i < CC_SHA256_DIGEST_LENGTH; ++i) {
+        [digestString appendFormat:@"%02x", digest[i]];
+    }
+
+    return digestString;
+}
+
+@end
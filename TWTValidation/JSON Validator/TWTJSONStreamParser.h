@@ -0,0 +1,73 @@
+//
+//  TWTJSONStreamParser.h
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+@import Foundation;
+
+@protocol TWTJSONStreamParserDelegate;
+
+
+// TWTJSONStreamParser tokenizes UTF-8 encoded JSON incrementally, informing its delegate of each structural event
+// as it is read. Data may be supplied in arbitrarily sized chunks, and tokens may be split across chunks. The parser
+// keeps only the bytes of the token it is currently reading and one byte of state for each level of nesting, so
+// documents of any size can be parsed in bounded memory.
+//
+// Scalar values are reported using the same classes that NSJSONSerialization uses: strings as NSStrings, numbers
+// and booleans as NSNumbers, integers too large for a long long as NSDecimalNumbers, and null as NSNull. Parse errors
+// are in the TWTValidationErrorDomain with the code TWTValidationErrorCodeMalformedJSON.
+@interface TWTJSONStreamParser : NSObject
+
+@property (nonatomic, weak) id<TWTJSONStreamParserDelegate> delegate;
+
+// The number of bytes that have been consumed by the parser
+@property (nonatomic, assign, readonly) NSUInteger byteOffset;
+
+// Parses the next chunk of a document. Returns NO if the document is malformed.
+- (BOOL)parseData:(NSData *)data error:(NSError *__autoreleasing *)outError;
+
+// Informs the parser that the document has ended. Returns NO if the document is malformed or incomplete.
+- (BOOL)finishParsingWithError:(NSError *__autoreleasing *)outError;
+
+// Convenience methods that parse an entire document. The stream is opened if necessary and read in chunks; it is not
+// closed.
+- (BOOL)parseAllData:(NSData *)data error:(NSError *__autoreleasing *)outError;
+- (BOOL)parseInputStream:(NSInputStream *)inputStream error:(NSError *__autoreleasing *)outError;
+
+@end
+
+
+@protocol TWTJSONStreamParserDelegate <NSObject>
+
+- (void)parserDidStartObject:(TWTJSONStreamParser *)parser;
+- (void)parser:(TWTJSONStreamParser *)parser didReadKey:(NSString *)key;
+- (void)parserDidEndObject:(TWTJSONStreamParser *)parser;
+
+- (void)parserDidStartArray:(TWTJSONStreamParser *)parser;
+- (void)parserDidEndArray:(TWTJSONStreamParser *)parser;
+
+// value is an NSString, NSNumber, or NSNull
+- (void)parser:(TWTJSONStreamParser *)parser didReadValue:(id)value;
+
+@end
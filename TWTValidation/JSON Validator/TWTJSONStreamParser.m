@@ -0,0 +1,714 @@
+//
+//  TWTJSONStreamParser.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTJSONStreamParser.h>
+
+#import <TWTValidation/TWTValidationErrors.h>
+#import <TWTValidation/TWTValidationLocalization.h>
+
+
+/*!
+ The number of bytes read from an input stream at a time.
+ */
+static const NSUInteger TWTJSONStreamParserInputStreamChunkLength = 64 * 1024;
+
+
+/*!
+ TWTJSONStreamParserState defines the parser’s expectations for the next token.
+ */
+typedef NS_ENUM(uint8_t, TWTJSONStreamParserState) {
+    TWTJSONStreamParserStateValue,
+    TWTJSONStreamParserStateValueOrArrayEnd,
+    TWTJSONStreamParserStateKeyOrObjectEnd,
+    TWTJSONStreamParserStateKey,
+    TWTJSONStreamParserStateColon,
+    TWTJSONStreamParserStateCommaOrContainerEnd,
+    TWTJSONStreamParserStateDone
+};
+
+
+/*!
+ TWTJSONStreamParserTokenResult defines the possible results of reading a token.
+ */
+typedef NS_ENUM(NSUInteger, TWTJSONStreamParserTokenResult) {
+    TWTJSONStreamParserTokenResultRead,
+    TWTJSONStreamParserTokenResultNeedsMoreData,
+    TWTJSONStreamParserTokenResultMalformed
+};
+
+
+static inline BOOL TWTJSONStreamParserIsWhitespace(uint8_t byte)
+{
+    return byte == ' ' || byte == '\n' || byte == '\r' || byte == '\t';
+}
+
+
+static inline BOOL TWTJSONStreamParserIsDigit(uint8_t byte)
+{
+    return byte >= '0' && byte <= '9';
+}
+
+
+static BOOL TWTJSONStreamParserReadHexCodeUnit(const uint8_t *bytes, unichar *outCodeUnit)
+{
+    unichar codeUnit = 0;
+    for (NSUInteger i = 0; i < 4; ++i) {
+        uint8_t byte = bytes[i];
+        codeUnit <<= 4;
+        if (byte >= '0' && byte <= '9') {
+            codeUnit |= byte - '0';
+        } else if (byte >= 'a' && byte <= 'f') {
+            codeUnit |= byte - 'a' + 10;
+        } else if (byte >= 'A' && byte <= 'F') {
+            codeUnit |= byte - 'A' + 10;
+        } else {
+            return NO;
+        }
+    }
+
+    *outCodeUnit = codeUnit;
+    return YES;
+}
+
+
+/*!
+ @abstract Decodes the contents of a JSON string that contains escape sequences.
+ @param bytes The bytes between the string’s quotation marks.
+ @param length The number of bytes.
+ @result The decoded string, or nil if the contents are not valid.
+ */
+static NSString *TWTJSONStreamParserDecodeEscapedString(const uint8_t *bytes, NSUInteger length)
+{
+    NSMutableString *string = [[NSMutableString alloc] initWithCapacity:length];
+    NSUInteger runStart = 0;
+    NSUInteger i = 0;
+    while (i < length) {
+        if (bytes[i] != '\\') {
+            ++i;
+            continue;
+        }
+
+        if (i > runStart) {
+            NSString *run = [[NSString alloc] initWithBytes:bytes + runStart length:i - runStart encoding:NSUTF8StringEncoding];
+            if (!run) {
+                return nil;
+            }
+
+            [string appendString:run];
+        }
+
+        if (++i >= length) {
+            return nil;
+        }
+
+        // Code units are appended individually. An escaped high surrogate must be followed by an escaped low one
+        unichar codeUnit = 0;
+        BOOL isHighSurrogate = NO;
+        switch (bytes[i]) {
+            case '"':
+            case '\\':
+            case '/':
+                codeUnit = bytes[i];
+                break;
+            case 'b':
+                codeUnit = '\b';
+                break;
+            case 'f':
+                codeUnit = '\f';
+                break;
+            case 'n':
+                codeUnit = '\n';
+                break;
+            case 'r':
+                codeUnit = '\r';
+                break;
+            case 't':
+                codeUnit = '\t';
+                break;
+            case 'u':
+                if (i + 4 >= length) {
+                    return nil;
+                }
+
+                if (!TWTJSONStreamParserReadHexCodeUnit(bytes + i + 1, &codeUnit)) {
+                    return nil;
+                }
+
+                // Like NSJSONSerialization, reject surrogates that aren’t part of a pair. A high surrogate’s low surrogate
+                // is read below
+                i += 4;
+                isHighSurrogate = CFStringIsSurrogateHighCharacter(codeUnit);
+                if (CFStringIsSurrogateLowCharacter(codeUnit)) {
+                    return nil;
+                }
+                break;
+            default:
+                return nil;
+        }
+
+        CFStringAppendCharacters((__bridge CFMutableStringRef)string, &codeUnit, 1);
+        runStart = ++i;
+
+        if (isHighSurrogate) {
+            unichar lowSurrogate = 0;
+            if (i + 6 > length) {
+                return nil;
+            } else if (bytes[i] != '\\' || bytes[i + 1] != 'u' || !TWTJSONStreamParserReadHexCodeUnit(bytes + i + 2, &lowSurrogate) ||
+                       !CFStringIsSurrogateLowCharacter(lowSurrogate)) {
+                return nil;
+            }
+
+            CFStringAppendCharacters((__bridge CFMutableStringRef)string, &lowSurrogate, 1);
+            i += 6;
+            runStart = i;
+        }
+    }
+
+    if (length > runStart) {
+        NSString *run = [[NSString alloc] initWithBytes:bytes + runStart length:length - runStart encoding:NSUTF8StringEncoding];
+        if (!run) {
+            return nil;
+        }
+
+        [string appendString:run];
+    }
+
+    return string;
+}
+
+
+/*!
+ @abstract Returns whether the specified bytes are a number as defined by the JSON grammar.
+ @param outIsIntegral On return, whether the number has neither a fraction nor an exponent.
+ */
+static BOOL TWTJSONStreamParserIsValidNumber(const uint8_t *bytes, NSUInteger length, BOOL *outIsIntegral)
+{
+    NSUInteger i = 0;
+    if (i < length && bytes[i] == '-') {
+        ++i;
+    }
+
+    // Integer part: either 0 or a non-zero digit followed by any digits
+    if (i < length && bytes[i] == '0') {
+        ++i;
+    } else if (i < length && TWTJSONStreamParserIsDigit(bytes[i])) {
+        while (i < length && TWTJSONStreamParserIsDigit(bytes[i])) {
+            ++i;
+        }
+    } else {
+        return NO;
+    }
+
+    BOOL isIntegral = YES;
+    if (i < length && bytes[i] == '.') {
+        isIntegral = NO;
+        NSUInteger fractionStart = ++i;
+        while (i < length && TWTJSONStreamParserIsDigit(bytes[i])) {
+            ++i;
+        }
+
+        if (i == fractionStart) {
+            return NO;
+        }
+    }
+
+    if (i < length && (bytes[i] == 'e' || bytes[i] == 'E')) {
+        isIntegral = NO;
+        if (++i < length && (bytes[i] == '+' || bytes[i] == '-')) {
+            ++i;
+        }
+
+        NSUInteger exponentStart = i;
+        while (i < length && TWTJSONStreamParserIsDigit(bytes[i])) {
+            ++i;
+        }
+
+        if (i == exponentStart) {
+            return NO;
+        }
+    }
+
+    *outIsIntegral = isIntegral;
+    return i == length;
+}
+
+
+/*!
+ @abstract Returns the locale used to interpret numbers, whose decimal separator is always a period.
+ */
+static NSLocale *TWTJSONStreamParserNumberLocale(void)
+{
+    static NSLocale *locale = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        locale = [[NSLocale alloc] initWithLocaleIdentifier:@"en_US_POSIX"];
+    });
+
+    return locale;
+}
+
+
+#pragma mark
+
+@interface TWTJSONStreamParser ()
+
+@property (nonatomic, assign, readwrite) NSUInteger byteOffset;
+
+// The container ('{' or '[') at each level of nesting
+@property (nonatomic, strong, readonly) NSMutableData *containerStack;
+
+// Bytes from previous chunks that began a token that has not been completely read
+@property (nonatomic, strong, readonly) NSMutableData *pendingData;
+
+// How far into the pending token a string has already been scanned, so that long strings split across many chunks
+// are not rescanned from the beginning each time
+@property (nonatomic, assign) NSUInteger pendingStringScanLength;
+
+@property (nonatomic, assign) TWTJSONStreamParserState state;
+@property (nonatomic, assign, getter = hasFailed) BOOL failed;
+
+@end
+
+
+@implementation TWTJSONStreamParser
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _containerStack = [[NSMutableData alloc] init];
+        _pendingData = [[NSMutableData alloc] init];
+        _state = TWTJSONStreamParserStateValue;
+    }
+
+    return self;
+}
+
+
+- (BOOL)parseData:(NSData *)data error:(NSError *__autoreleasing *)outError
+{
+    return [self parseData:data final:NO error:outError];
+}
+
+
+- (BOOL)finishParsingWithError:(NSError *__autoreleasing *)outError
+{
+    if (![self parseData:[NSData data] final:YES error:outError]) {
+        return NO;
+    } else if (self.state != TWTJSONStreamParserStateDone) {
+        self.failed = YES;
+        if (outError) {
+            *outError = [self malformedJSONErrorAtByteOffset:self.byteOffset];
+        }
+
+        return NO;
+    }
+
+    return YES;
+}
+
+
+- (BOOL)parseAllData:(NSData *)data error:(NSError *__autoreleasing *)outError
+{
+    return [self parseData:data error:outError] && [self finishParsingWithError:outError];
+}
+
+
+- (BOOL)parseInputStream:(NSInputStream *)inputStream error:(NSError *__autoreleasing *)outError
+{
+    NSParameterAssert(inputStream);
+    if (inputStream.streamStatus == NSStreamStatusNotOpen) {
+        [inputStream open];
+    }
+
+    uint8_t *buffer = malloc(TWTJSONStreamParserInputStreamChunkLength);
+    BOOL parsed = YES;
+    NSError *error = nil;
+    while (parsed) {
+        NSInteger readLength = [inputStream read:buffer maxLength:TWTJSONStreamParserInputStreamChunkLength];
+        if (readLength < 0) {
+            error = inputStream.streamError;
+            parsed = NO;
+        } else if (readLength == 0) {
+            break;
+        } else {
+            @autoreleasepool {
+                NSData *chunk = [[NSData alloc] initWithBytesNoCopy:buffer length:readLength freeWhenDone:NO];
+                parsed = [self parseData:chunk error:&error];
+            }
+        }
+    }
+
+    free(buffer);
+
+    if (!parsed) {
+        if (outError) {
+            *outError = error;
+        }
+
+        return NO;
+    }
+
+    return [self finishParsingWithError:outError];
+}
+
+
+- (BOOL)parseData:(NSData *)data final:(BOOL)final error:(NSError *__autoreleasing *)outError
+{
+    if (self.hasFailed) {
+        if (outError) {
+            *outError = [self malformedJSONErrorAtByteOffset:self.byteOffset];
+        }
+
+        return NO;
+    }
+
+    // If an earlier chunk ended in the middle of a token, continue from the start of that token. Otherwise, parse the
+    // data in place so that large or memory-mapped documents are not copied
+    BOOL usesPendingData = self.pendingData.length > 0;
+    if (usesPendingData) {
+        [self.pendingData appendData:data];
+    }
+
+    const uint8_t *bytes = usesPendingData ? self.pendingData.bytes : data.bytes;
+    NSUInteger length = usesPendingData ? self.pendingData.length : data.length;
+
+    NSUInteger consumedLength = 0;
+    BOOL parsed = [self parseBytes:bytes length:length final:final consumedLength:&consumedLength error:outError];
+    if (!parsed) {
+        self.failed = YES;
+        return NO;
+    }
+
+    self.byteOffset += consumedLength;
+    if (usesPendingData) {
+        [self.pendingData replaceBytesInRange:NSMakeRange(0, consumedLength) withBytes:NULL length:0];
+    } else if (consumedLength < length) {
+        [self.pendingData appendBytes:bytes + consumedLength length:length - consumedLength];
+    }
+
+    return YES;
+}
+
+
+- (BOOL)parseBytes:(const uint8_t *)bytes
+            length:(NSUInteger)length
+             final:(BOOL)final
+    consumedLength:(NSUInteger *)outConsumedLength
+             error:(NSError *__autoreleasing *)outError
+{
+    NSUInteger i = 0;
+
+    // Skip a UTF-8 byte order mark at the beginning of the document
+    if (self.byteOffset == 0 && length > 0 && bytes[0] == 0xEF) {
+        if (length < 3 && !final) {
+            *outConsumedLength = 0;
+            return YES;
+        } else if (length >= 3 && bytes[1] == 0xBB && bytes[2] == 0xBF) {
+            i = 3;
+        }
+    }
+
+    TWTJSONStreamParserTokenResult result = TWTJSONStreamParserTokenResultRead;
+    while (result == TWTJSONStreamParserTokenResultRead) {
+        while (i < length && TWTJSONStreamParserIsWhitespace(bytes[i])) {
+            ++i;
+        }
+
+        if (i == length) {
+            break;
+        }
+
+        uint8_t byte = bytes[i];
+        switch (self.state) {
+            case TWTJSONStreamParserStateDone:
+                result = TWTJSONStreamParserTokenResultMalformed;
+                break;
+
+            case TWTJSONStreamParserStateColon:
+                if (byte == ':') {
+                    ++i;
+                    self.state = TWTJSONStreamParserStateValue;
+                } else {
+                    result = TWTJSONStreamParserTokenResultMalformed;
+                }
+                break;
+
+            case TWTJSONStreamParserStateCommaOrContainerEnd: {
+                uint8_t container = ((const uint8_t *)self.containerStack.bytes)[self.containerStack.length - 1];
+                if (byte == ',') {
+                    ++i;
+                    self.state = container == '{' ? TWTJSONStreamParserStateKey : TWTJSONStreamParserStateValue;
+                } else if ((byte == '}' && container == '{') || (byte == ']' && container == '[')) {
+                    ++i;
+                    [self endContainer];
+                } else {
+                    result = TWTJSONStreamParserTokenResultMalformed;
+                }
+                break;
+            }
+
+            case TWTJSONStreamParserStateKeyOrObjectEnd:
+                if (byte == '}') {
+                    ++i;
+                    [self endContainer];
+                    break;
+                }
+                // Otherwise, this must be a key
+            case TWTJSONStreamParserStateKey: {
+                NSString *key = nil;
+                result = byte == '"' ? [self readStringFromBytes:bytes length:length index:&i final:final string:&key] : TWTJSONStreamParserTokenResultMalformed;
+                if (result == TWTJSONStreamParserTokenResultRead) {
+                    self.state = TWTJSONStreamParserStateColon;
+                    [self.delegate parser:self didReadKey:key];
+                }
+                break;
+            }
+
+            case TWTJSONStreamParserStateValueOrArrayEnd:
+                if (byte == ']') {
+                    ++i;
+                    [self endContainer];
+                    break;
+                }
+                // Otherwise, this must be a value
+            case TWTJSONStreamParserStateValue:
+                result = [self readValueFromBytes:bytes length:length index:&i final:final];
+                break;
+        }
+    }
+
+    if (result == TWTJSONStreamParserTokenResultMalformed) {
+        if (outError) {
+            *outError = [self malformedJSONErrorAtByteOffset:self.byteOffset + i];
+        }
+
+        return NO;
+    }
+
+    *outConsumedLength = i;
+    return YES;
+}
+
+
+#pragma mark - Tokens
+
+- (TWTJSONStreamParserTokenResult)readValueFromBytes:(const uint8_t *)bytes length:(NSUInteger)length index:(NSUInteger *)ioIndex final:(BOOL)final
+{
+    NSUInteger i = *ioIndex;
+    uint8_t byte = bytes[i];
+
+    if (byte == '{' || byte == '[') {
+        *ioIndex = i + 1;
+        [self.containerStack appendBytes:&byte length:1];
+        if (byte == '{') {
+            self.state = TWTJSONStreamParserStateKeyOrObjectEnd;
+            [self.delegate parserDidStartObject:self];
+        } else {
+            self.state = TWTJSONStreamParserStateValueOrArrayEnd;
+            [self.delegate parserDidStartArray:self];
+        }
+
+        return TWTJSONStreamParserTokenResultRead;
+    }
+
+    id value = nil;
+    TWTJSONStreamParserTokenResult result = TWTJSONStreamParserTokenResultMalformed;
+    if (byte == '"') {
+        result = [self readStringFromBytes:bytes length:length index:ioIndex final:final string:&value];
+    } else if (byte == '-' || TWTJSONStreamParserIsDigit(byte)) {
+        result = [self readNumberFromBytes:bytes length:length index:ioIndex final:final number:&value];
+    } else if (byte == 't') {
+        result = [self readLiteral:"true" value:@YES fromBytes:bytes length:length index:ioIndex final:final result:&value];
+    } else if (byte == 'f') {
+        result = [self readLiteral:"false" value:@NO fromBytes:bytes length:length index:ioIndex final:final result:&value];
+    } else if (byte == 'n') {
+        result = [self readLiteral:"null" value:[NSNull null] fromBytes:bytes length:length index:ioIndex final:final result:&value];
+    }
+
+    if (result == TWTJSONStreamParserTokenResultRead) {
+        self.state = self.containerStack.length > 0 ? TWTJSONStreamParserStateCommaOrContainerEnd : TWTJSONStreamParserStateDone;
+        [self.delegate parser:self didReadValue:value];
+    }
+
+    return result;
+}
+
+
+- (TWTJSONStreamParserTokenResult)readStringFromBytes:(const uint8_t *)bytes
+                                               length:(NSUInteger)length
+                                                index:(NSUInteger *)ioIndex
+                                                final:(BOOL)final
+                                               string:(NSString *__autoreleasing *)outString
+{
+    NSUInteger start = *ioIndex + 1;
+    NSUInteger end = start + self.pendingStringScanLength;
+    while (end < length && bytes[end] != '"') {
+        if (bytes[end] == '\\') {
+            end += 2;
+        } else if (bytes[end] < 0x20) {
+            return TWTJSONStreamParserTokenResultMalformed;
+        } else {
+            ++end;
+        }
+    }
+
+    if (end >= length) {
+        if (final) {
+            return TWTJSONStreamParserTokenResultMalformed;
+        }
+
+        self.pendingStringScanLength = end - start;
+        return TWTJSONStreamParserTokenResultNeedsMoreData;
+    }
+
+    self.pendingStringScanLength = 0;
+
+    NSString *string = nil;
+    if (memchr(bytes + start, '\\', end - start)) {
+        string = TWTJSONStreamParserDecodeEscapedString(bytes + start, end - start);
+    } else {
+        string = [[NSString alloc] initWithBytes:bytes + start length:end - start encoding:NSUTF8StringEncoding];
+    }
+
+    if (!string) {
+        return TWTJSONStreamParserTokenResultMalformed;
+    }
+
+    *outString = string;
+    *ioIndex = end + 1;
+    return TWTJSONStreamParserTokenResultRead;
+}
+
+
+- (TWTJSONStreamParserTokenResult)readNumberFromBytes:(const uint8_t *)bytes
+                                               length:(NSUInteger)length
+                                                index:(NSUInteger *)ioIndex
+                                                final:(BOOL)final
+                                               number:(NSNumber *__autoreleasing *)outNumber
+{
+    NSUInteger start = *ioIndex;
+    NSUInteger end = start;
+    while (end < length && (TWTJSONStreamParserIsDigit(bytes[end]) || bytes[end] == '-' || bytes[end] == '+' ||
+                            bytes[end] == '.' || bytes[end] == 'e' || bytes[end] == 'E')) {
+        ++end;
+    }
+
+    if (end == length && !final) {
+        return TWTJSONStreamParserTokenResultNeedsMoreData;
+    }
+
+    BOOL isIntegral = NO;
+    NSUInteger numberLength = end - start;
+    if (!TWTJSONStreamParserIsValidNumber(bytes + start, numberLength, &isIntegral)) {
+        return TWTJSONStreamParserTokenResultMalformed;
+    }
+
+    // strtoll and strtod need a NUL-terminated string
+    char stackBuffer[64];
+    char *buffer = numberLength < sizeof(stackBuffer) ? stackBuffer : malloc(numberLength + 1);
+    memcpy(buffer, bytes + start, numberLength);
+    buffer[numberLength] = '\0';
+
+    // Like NSJSONSerialization, integers that fit in a long long are represented as such, except that -0 is a double
+    // so that its sign is kept. Integers that don’t fit are NSDecimalNumbers, and all other numbers are doubles
+    NSNumber *number = nil;
+    if (isIntegral) {
+        errno = 0;
+        long long integerValue = strtoll(buffer, NULL, 10);
+        if (errno == ERANGE) {
+            number = [NSDecimalNumber decimalNumberWithString:@(buffer) locale:TWTJSONStreamParserNumberLocale()];
+        } else if (integerValue != 0 || buffer[0] != '-') {
+            number = @(integerValue);
+        }
+    }
+
+    if (!number) {
+        number = @(strtod(buffer, NULL));
+    }
+
+    if (buffer != stackBuffer) {
+        free(buffer);
+    }
+
+    *outNumber = number;
+    *ioIndex = end;
+    return TWTJSONStreamParserTokenResultRead;
+}
+
+
+- (TWTJSONStreamParserTokenResult)readLiteral:(const char *)literal
+                                        value:(id)literalValue
+                                    fromBytes:(const uint8_t *)bytes
+                                       length:(NSUInteger)length
+                                        index:(NSUInteger *)ioIndex
+                                        final:(BOOL)final
+                                       result:(id __autoreleasing *)outValue
+{
+    NSUInteger start = *ioIndex;
+    NSUInteger literalLength = strlen(literal);
+    NSUInteger availableLength = MIN(literalLength, length - start);
+    if (memcmp(bytes + start, literal, availableLength) != 0) {
+        return TWTJSONStreamParserTokenResultMalformed;
+    } else if (availableLength < literalLength) {
+        return final ? TWTJSONStreamParserTokenResultMalformed : TWTJSONStreamParserTokenResultNeedsMoreData;
+    }
+
+    *outValue = literalValue;
+    *ioIndex = start + literalLength;
+    return TWTJSONStreamParserTokenResultRead;
+}
+
+
+- (void)endContainer
+{
+    NSMutableData *containerStack = self.containerStack;
+    uint8_t container = ((const uint8_t *)containerStack.bytes)[containerStack.length - 1];
+    containerStack.length -= 1;
+
+    self.state = containerStack.length > 0 ? TWTJSONStreamParserStateCommaOrContainerEnd : TWTJSONStreamParserStateDone;
+    if (container == '{') {
+        [self.delegate parserDidEndObject:self];
+    } else {
+        [self.delegate parserDidEndArray:self];
+    }
+}
+
+
+#pragma mark - Errors
+
+- (NSError *)malformedJSONErrorAtByteOffset:(NSUInteger)byteOffset
+{
+    return [NSError twt_validationErrorWithCode:TWTValidationErrorCodeMalformedJSON
+                               failingValidator:nil
+                                          value:nil
+                      localizedDescriptionBlock:^{
+                          NSString *format = TWTLocalizedString(@"TWTJSONStreamParser.malformedJSONError.format");
+                          return [NSString stringWithFormat:format, (unsigned long)byteOffset];
+                      }];
+}
+
+@end
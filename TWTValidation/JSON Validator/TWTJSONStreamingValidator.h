@@ -0,0 +1,62 @@
+//
+//  TWTJSONStreamingValidator.h
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+@import Foundation;
+
+@class TWTValidator;
+
+
+// TWTJSONStreamingValidator validates JSON documents as they are read from data, files, or input streams, without
+// first materializing them using NSJSONSerialization. It drives a validator tree—typically one created by
+// +[TWTJSONObjectValidator validatorWithJSONSchema:error:warnings:]—with the events produced by a TWTJSONStreamParser,
+// keeping state only for each level of nesting in the document.
+//
+// Arrays and objects whose schemas can be checked incrementally are never materialized. Instead, their items and
+// property values are validated as they are read. Containers that no validator checks are skipped entirely. Any other
+// container, e.g., one whose schema uses enum, allOf, anyOf, oneOf, not, or uniqueItems, is materialized on its own
+// and validated using -validateValue:error:, so memory use is bounded by the largest such container rather than by
+// the size of the document.
+//
+// Validation results are the same as those of -validateValue:error: on the document parsed by NSJSONSerialization,
+// except for objects with duplicate keys. NSJSONSerialization keeps only one of a duplicated key’s values, but a
+// streamed object’s values are all validated, and each occurrence of a key counts toward its number of properties.
+// Errors for streamed arrays and objects have no validated value, and the errors for their items and properties are
+// in document order. Streaming validators are immutable and may be used from multiple threads at once.
+@interface TWTJSONStreamingValidator : NSObject
+
+@property (nonatomic, strong, readonly) TWTValidator *validator;
+
+- (instancetype)initWithValidator:(TWTValidator *)validator;
+
+// These return NO if the document is malformed or invalid. If the document is malformed, the error’s code is
+// TWTValidationErrorCodeMalformedJSON. Otherwise, it is the validation error.
+- (BOOL)validateJSONData:(NSData *)data error:(NSError *__autoreleasing *)outError;
+- (BOOL)validateJSONInputStream:(NSInputStream *)inputStream error:(NSError *__autoreleasing *)outError;
+
+// Memory-maps the file if possible so that the document is paged in as it is parsed
+- (BOOL)validateJSONContentsOfFile:(NSString *)path error:(NSError *__autoreleasing *)outError;
+
+@end
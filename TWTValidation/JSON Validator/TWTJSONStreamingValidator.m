@@ -0,0 +1,499 @@
+//
+//  TWTJSONStreamingValidator.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTJSONStreamingValidator.h>
+
+#import <TWTValidation/TWTJSONObjectValidator.h>
+#import <TWTValidation/TWTJSONSchemaArrayValidator.h>
+#import <TWTValidation/TWTJSONSchemaImpliedTypeValidator.h>
+#import <TWTValidation/TWTJSONSchemaObjectValidator.h>
+#import <TWTValidation/TWTJSONStreamParser.h>
+#import <TWTValidation/TWTKeyedCollectionValidator.h>
+#import <TWTValidation/TWTProxyValidator.h>
+#import <TWTValidation/TWTValidationErrors.h>
+#import <TWTValidation/TWTValidationLocalization.h>
+
+
+@interface TWTJSONObjectValidator (TWTJSONStreamingValidator)
+
+@property (nonatomic, strong, readonly) TWTValidator *commonValidator;
+@property (nonatomic, strong, readonly) TWTValidator *typeValidator;
+
+@end
+
+
+/*!
+ @abstract Resolves the validator that actually checks a JSON array or object on behalf of the specified validator.
+ @discussion Proxy and key-value pair validators are replaced by the validators they delegate to, as are implied
+     type validators whose implied types include the container’s type. JSON object validators that have only a type
+     validator are replaced by it and added to wrappingValidators, since their errors wrap their type validator’s.
+ @param validator The validator to resolve.
+ @param containerType The JSON type of the container, either TWTJSONTypeArray or TWTJSONTypeObject.
+ @param wrappingValidators A mutable array to which JSON object validators that were resolved through are added,
+     outermost first. May be nil.
+ @result The resolved validator, or nil if the validator passes every array and object.
+ */
+static TWTValidator *TWTJSONStreamingValidatorResolvedContainerValidator(TWTValidator *validator, TWTJSONType containerType, NSMutableArray *wrappingValidators)
+{
+    while (validator) {
+        if ([validator isMemberOfClass:[TWTValidator class]]) {
+            // Base validators only fail nil and null, which containers never are
+            return nil;
+        } else if ([validator isKindOfClass:[TWTProxyValidator class]]) {
+            TWTValidator *proxiedValidator = [(TWTProxyValidator *)validator validator];
+            if (!proxiedValidator) {
+                return validator;
+            }
+
+            validator = proxiedValidator;
+        } else if ([validator isKindOfClass:[TWTKeyValuePairValidator class]]) {
+            validator = [(TWTKeyValuePairValidator *)validator valueValidator];
+        } else if ([validator isKindOfClass:[TWTJSONObjectValidator class]]) {
+            TWTJSONObjectValidator *objectValidator = (TWTJSONObjectValidator *)validator;
+            if (objectValidator.commonValidator) {
+                return validator;
+            } else if (!objectValidator.typeValidator) {
+                return nil;
+            }
+
+            [wrappingValidators addObject:validator];
+            validator = objectValidator.typeValidator;
+        } else if ([validator isKindOfClass:[TWTJSONSchemaImpliedTypeValidator class]]) {
+            // Implied type validators pass their type validator’s errors through unwrapped
+            TWTJSONSchemaImpliedTypeValidator *impliedTypeValidator = (TWTJSONSchemaImpliedTypeValidator *)validator;
+            if (!TWTJSONTypeMaskContainsType(impliedTypeValidator.impliedTypes, containerType)) {
+                return nil;
+            }
+
+            validator = impliedTypeValidator.typeValidator;
+        } else {
+            return validator;
+        }
+    }
+
+    return nil;
+}
+
+
+/*!
+ TWTJSONStreamingValidationFrameType defines how a JSON array or object is handled while it is being read.
+ */
+typedef NS_ENUM(NSUInteger, TWTJSONStreamingValidationFrameType) {
+    /*! The container is not validated, and neither are its contents. */
+    TWTJSONStreamingValidationFrameTypeSkipped,
+
+    /*! The container is built and then validated, or added to its enclosing materialized container. */
+    TWTJSONStreamingValidationFrameTypeMaterialized,
+
+    /*! The container is an array whose items are validated as they are read. */
+    TWTJSONStreamingValidationFrameTypeStreamedArray,
+
+    /*! The container is an object whose property values are validated as they are read. */
+    TWTJSONStreamingValidationFrameTypeStreamedObject
+};
+
+
+/*!
+ TWTJSONStreamingValidationFrames hold the state for a single level of nesting in a document being validated.
+ */
+@interface TWTJSONStreamingValidationFrame : NSObject
+
+@property (nonatomic, assign) TWTJSONStreamingValidationFrameType type;
+
+// The key of the property being read in an object
+@property (nonatomic, copy) NSString *currentKey;
+
+// Materialized frames. validators is nil if the container is part of an enclosing materialized container
+@property (nonatomic, copy) NSArray *validators;
+@property (nonatomic, strong) id container;
+
+// Streamed frames. itemCount is the number of items in an array or keys in an object. Only the keys whose presence
+// affects an object’s validation are kept
+@property (nonatomic, strong) id schemaValidator;
+@property (nonatomic, copy) NSArray *wrappingValidators;
+@property (nonatomic, assign) NSUInteger itemCount;
+@property (nonatomic, strong) NSMutableSet *keys;
+@property (nonatomic, assign) BOOL childrenValidated;
+@property (nonatomic, strong) NSMutableArray *childErrors;
+
+@end
+
+
+@implementation TWTJSONStreamingValidationFrame
+
+@end
+
+
+#pragma mark
+
+/*!
+ TWTJSONStreamingValidationSessions validate a single document. They are the delegates of the parsers that read it.
+ */
+@interface TWTJSONStreamingValidationSession : NSObject <TWTJSONStreamParserDelegate>
+
+@property (nonatomic, strong, readonly) TWTValidator *validator;
+@property (nonatomic, assign, readonly) BOOL collectsErrors;
+@property (nonatomic, assign, readonly) BOOL failsFast;
+@property (nonatomic, strong, readonly) TWTJSONStreamParser *parser;
+@property (nonatomic, strong, readonly) NSMutableArray *frames;
+
+@property (nonatomic, assign) BOOL validated;
+@property (nonatomic, strong) NSError *error;
+
+- (instancetype)initWithValidator:(TWTValidator *)validator collectsErrors:(BOOL)collectsErrors;
+
+- (BOOL)finishWithError:(NSError *__autoreleasing *)outError;
+
+@end
+
+
+@implementation TWTJSONStreamingValidationSession
+
+- (instancetype)init
+{
+    return [self initWithValidator:nil collectsErrors:NO];
+}
+
+
+- (instancetype)initWithValidator:(TWTValidator *)validator collectsErrors:(BOOL)collectsErrors
+{
+    self = [super init];
+    if (self) {
+        _validator = validator;
+        _collectsErrors = collectsErrors;
+        _failsFast = [TWTValidator isFailFastModeEnabled];
+        _parser = [[TWTJSONStreamParser alloc] init];
+        _parser.delegate = self;
+        _frames = [[NSMutableArray alloc] init];
+    }
+
+    return self;
+}
+
+
+- (BOOL)finishWithError:(NSError *__autoreleasing *)outError
+{
+    if (!self.validated && outError) {
+        *outError = self.error;
+    }
+
+    return self.validated;
+}
+
+
+#pragma mark - Parser Delegate
+
+- (void)parserDidStartObject:(TWTJSONStreamParser *)parser
+{
+    [self startContainerWithClass:[NSMutableDictionary class]];
+}
+
+
+- (void)parser:(TWTJSONStreamParser *)parser didReadKey:(NSString *)key
+{
+    TWTJSONStreamingValidationFrame *frame = self.frames.lastObject;
+    frame.currentKey = key;
+    if (frame.type == TWTJSONStreamingValidationFrameTypeStreamedObject) {
+        ++frame.itemCount;
+        if ([frame.schemaValidator presenceOfKeyAffectsStreamedObjectValidation:key]) {
+            [frame.keys addObject:key];
+        }
+    }
+}
+
+
+- (void)parserDidEndObject:(TWTJSONStreamParser *)parser
+{
+    [self endContainer];
+}
+
+
+- (void)parserDidStartArray:(TWTJSONStreamParser *)parser
+{
+    [self startContainerWithClass:[NSMutableArray class]];
+}
+
+
+- (void)parserDidEndArray:(TWTJSONStreamParser *)parser
+{
+    [self endContainer];
+}
+
+
+- (void)parser:(TWTJSONStreamParser *)parser didReadValue:(id)value
+{
+    TWTJSONStreamingValidationFrame *frame = self.frames.lastObject;
+    if (frame.type == TWTJSONStreamingValidationFrameTypeMaterialized) {
+        [self addValue:value toMaterializedFrame:frame];
+    } else if (!frame || frame.type != TWTJSONStreamingValidationFrameTypeSkipped) {
+        [self validateValue:value withValidators:[self validatorsForNextValue]];
+    }
+}
+
+
+#pragma mark - Frames
+
+- (NSArray *)validatorsForNextValue
+{
+    TWTJSONStreamingValidationFrame *frame = self.frames.lastObject;
+    if (!frame) {
+        return @[ self.validator ];
+    }
+
+    switch (frame.type) {
+        case TWTJSONStreamingValidationFrameTypeSkipped:
+        case TWTJSONStreamingValidationFrameTypeMaterialized:
+            return nil;
+        case TWTJSONStreamingValidationFrameTypeStreamedArray: {
+            NSUInteger index = frame.itemCount++;
+            TWTValidator *validator = [frame.schemaValidator validatorForItemAtIndex:index];
+
+            // In fail-fast mode, stop validating children once one has failed
+            return validator && (frame.childrenValidated || !self.failsFast) ? @[ validator ] : nil;
+        }
+        case TWTJSONStreamingValidationFrameTypeStreamedObject:
+            return frame.childrenValidated || !self.failsFast ? [frame.schemaValidator validatorsForPropertyWithKey:frame.currentKey] : nil;
+    }
+
+    return nil;
+}
+
+
+- (void)startContainerWithClass:(Class)containerClass
+{
+    TWTJSONStreamingValidationFrame *parent = self.frames.lastObject;
+    TWTJSONStreamingValidationFrame *frame = [[TWTJSONStreamingValidationFrame alloc] init];
+
+    if (parent.type == TWTJSONStreamingValidationFrameTypeMaterialized) {
+        frame.type = TWTJSONStreamingValidationFrameTypeMaterialized;
+        frame.container = [[containerClass alloc] init];
+    } else if (parent && parent.type == TWTJSONStreamingValidationFrameTypeSkipped) {
+        frame.type = TWTJSONStreamingValidationFrameTypeSkipped;
+    } else {
+        [self configureFrame:frame forContainerWithClass:containerClass validators:[self validatorsForNextValue]];
+    }
+
+    [self.frames addObject:frame];
+}
+
+
+- (void)configureFrame:(TWTJSONStreamingValidationFrame *)frame forContainerWithClass:(Class)containerClass validators:(NSArray *)validators
+{
+    BOOL isObject = containerClass == [NSMutableDictionary class];
+    TWTJSONType containerType = isObject ? TWTJSONTypeObject : TWTJSONTypeArray;
+
+    // Ignore validators that pass every container
+    NSMutableArray *checkingValidators = [[NSMutableArray alloc] initWithCapacity:validators.count];
+    TWTValidator *schemaValidator = nil;
+    NSArray *wrappingValidators = nil;
+    for (TWTValidator *validator in validators) {
+        NSMutableArray *resolvedWrappingValidators = [[NSMutableArray alloc] init];
+        TWTValidator *resolvedValidator = TWTJSONStreamingValidatorResolvedContainerValidator(validator, containerType, resolvedWrappingValidators);
+        if (resolvedValidator) {
+            [checkingValidators addObject:validator];
+            schemaValidator = resolvedValidator;
+            wrappingValidators = resolvedWrappingValidators;
+        }
+    }
+
+    if (checkingValidators.count == 0) {
+        frame.type = TWTJSONStreamingValidationFrameTypeSkipped;
+        return;
+    }
+
+    if (checkingValidators.count == 1) {
+        if (isObject && [schemaValidator isKindOfClass:[TWTJSONSchemaObjectValidator class]] &&
+            [(TWTJSONSchemaObjectValidator *)schemaValidator supportsStreamingValidation]) {
+            frame.type = TWTJSONStreamingValidationFrameTypeStreamedObject;
+            frame.keys = [[NSMutableSet alloc] init];
+        } else if (!isObject && [schemaValidator isKindOfClass:[TWTJSONSchemaArrayValidator class]] &&
+                   [(TWTJSONSchemaArrayValidator *)schemaValidator supportsStreamingValidation]) {
+            frame.type = TWTJSONStreamingValidationFrameTypeStreamedArray;
+        }
+    }
+
+    if (frame.type == TWTJSONStreamingValidationFrameTypeStreamedArray || frame.type == TWTJSONStreamingValidationFrameTypeStreamedObject) {
+        frame.schemaValidator = schemaValidator;
+        frame.wrappingValidators = wrappingValidators;
+        frame.childrenValidated = YES;
+        frame.childErrors = self.collectsErrors ? [[NSMutableArray alloc] init] : nil;
+    } else {
+        frame.type = TWTJSONStreamingValidationFrameTypeMaterialized;
+        frame.validators = checkingValidators;
+        frame.container = [[containerClass alloc] init];
+    }
+}
+
+
+- (void)endContainer
+{
+    TWTJSONStreamingValidationFrame *frame = self.frames.lastObject;
+    [self.frames removeLastObject];
+
+    switch (frame.type) {
+        case TWTJSONStreamingValidationFrameTypeSkipped:
+            [self recordResultWithValidated:YES errors:nil];
+            break;
+
+        case TWTJSONStreamingValidationFrameTypeMaterialized:
+            if (frame.validators) {
+                [self validateValue:frame.container withValidators:frame.validators];
+            } else {
+                [self addValue:frame.container toMaterializedFrame:self.frames.lastObject];
+            }
+            break;
+
+        case TWTJSONStreamingValidationFrameTypeStreamedArray:
+        case TWTJSONStreamingValidationFrameTypeStreamedObject: {
+            NSError *error = nil;
+            BOOL validated = NO;
+            if (frame.type == TWTJSONStreamingValidationFrameTypeStreamedArray) {
+                validated = [frame.schemaValidator validateStreamedArrayWithItemCount:frame.itemCount
+                                                                       itemsValidated:frame.childrenValidated
+                                                                           itemErrors:frame.childErrors
+                                                                                error:self.collectsErrors ? &error : NULL];
+            } else {
+                validated = [frame.schemaValidator validateStreamedObjectWithKeyCount:frame.itemCount
+                                                                          presentKeys:frame.keys
+                                                                  propertiesValidated:frame.childrenValidated
+                                                                       propertyErrors:frame.childErrors
+                                                                                error:self.collectsErrors ? &error : NULL];
+            }
+
+            // Wrap the error just as each JSON object validator would have wrapped its type validator’s error
+            for (TWTValidator *wrappingValidator in [frame.wrappingValidators reverseObjectEnumerator]) {
+                if (!error) {
+                    break;
+                }
+
+                error = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeJSONObjectValidatorError
+                                            failingValidator:wrappingValidator
+                                                       value:nil
+                                   localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTJSONObjectValidator.validationError"); }
+                                            underlyingErrors:@[ error ]];
+            }
+
+            [self recordResultWithValidated:validated errors:error ? @[ error ] : nil];
+            break;
+        }
+    }
+}
+
+
+- (void)addValue:(id)value toMaterializedFrame:(TWTJSONStreamingValidationFrame *)frame
+{
+    if ([frame.container isKindOfClass:[NSMutableDictionary class]]) {
+        [frame.container setObject:value forKey:frame.currentKey];
+    } else {
+        [frame.container addObject:value];
+    }
+}
+
+
+- (void)validateValue:(id)value withValidators:(NSArray *)validators
+{
+    BOOL validated = YES;
+    NSMutableArray *errors = self.collectsErrors ? [[NSMutableArray alloc] init] : nil;
+    for (TWTValidator *validator in validators) {
+        NSError *error = nil;
+        if (![validator validateValue:value error:self.collectsErrors ? &error : NULL]) {
+            validated = NO;
+            if (error) {
+                [errors addObject:error];
+            }
+
+            if (self.failsFast) {
+                break;
+            }
+        }
+    }
+
+    [self recordResultWithValidated:validated errors:errors];
+}
+
+
+- (void)recordResultWithValidated:(BOOL)validated errors:(NSArray *)errors
+{
+    TWTJSONStreamingValidationFrame *frame = self.frames.lastObject;
+    if (!frame) {
+        self.validated = validated;
+        self.error = errors.firstObject;
+    } else if (!validated) {
+        frame.childrenValidated = NO;
+        [frame.childErrors addObjectsFromArray:errors];
+    }
+}
+
+@end
+
+
+#pragma mark
+
+@implementation TWTJSONStreamingValidator
+
+- (instancetype)init
+{
+    return [self initWithValidator:nil];
+}
+
+
+- (instancetype)initWithValidator:(TWTValidator *)validator
+{
+    NSParameterAssert(validator);
+
+    self = [super init];
+    if (self) {
+        _validator = validator;
+    }
+
+    return self;
+}
+
+
+- (BOOL)validateJSONData:(NSData *)data error:(NSError *__autoreleasing *)outError
+{
+    NSParameterAssert(data);
+    TWTJSONStreamingValidationSession *session = [[TWTJSONStreamingValidationSession alloc] initWithValidator:self.validator collectsErrors:outError != NULL];
+    return [session.parser parseAllData:data error:outError] && [session finishWithError:outError];
+}
+
+
+- (BOOL)validateJSONInputStream:(NSInputStream *)inputStream error:(NSError *__autoreleasing *)outError
+{
+    NSParameterAssert(inputStream);
+    TWTJSONStreamingValidationSession *session = [[TWTJSONStreamingValidationSession alloc] initWithValidator:self.validator collectsErrors:outError != NULL];
+    return [session.parser parseInputStream:inputStream error:outError] && [session finishWithError:outError];
+}
+
+
+- (BOOL)validateJSONContentsOfFile:(NSString *)path error:(NSError *__autoreleasing *)outError
+{
+    NSParameterAssert(path);
+    NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedIfSafe error:outError];
+    return data && [self validateJSONData:data error:outError];
+}
+
+@end
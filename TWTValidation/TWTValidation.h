@@ -28,6 +28,7 @@
 
 #import <TWTValidation/TWTValidator.h>
 #import <TWTValidation/TWTValidationErrors.h>
+#import <TWTValidation/TWTValidationLocalization.h>
 
 #import <TWTValidation/TWTBlockValidator.h>
 
@@ -40,8 +41,18 @@
 
 #import <TWTValidation/TWTValueSetValidator.h>
 
+#import <TWTValidation/TWTValidationContext.h>
+#import <TWTValidation/TWTValidationExecutor.h>
+
 #import <TWTValidation/TWTValueValidator.h>
 #import <TWTValidation/TWTNumberValidator.h>
 #import <TWTValidation/TWTStringValidator.h>
 
 #import <TWTValidation/TWTJSONObjectValidator.h>
+#import <TWTValidation/TWTJSONSchemaPattern.h>
+#import <TWTValidation/TWTJSONSchemaProgram.h>
+#import <TWTValidation/TWTJSONSchemaValidatorCache.h>
+#import <TWTValidation/TWTJSONStreamParser.h>
+#import <TWTValidation/TWTJSONStreamingValidator.h>
+#import <TWTValidation/TWTJSONType.h>
+#import <TWTValidation/TWTJSONValueEquality.h>
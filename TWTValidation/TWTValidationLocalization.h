@@ -24,5 +24,40 @@
 //  THE SOFTWARE.
 //
 
-#define TWTLocalizedString(key) \
-    [[NSBundle bundleForClass:[self class]] localizedStringForKey:(key) value:@"" table:@"TWTValidation"]
+@import Foundation;
+
+/*!
+ @abstract Returns the localized string for the specified key in the TWTValidation strings table.
+ @discussion Lookups do not lock or search bundles; the table is loaded once and then replaced only when the
+     localization changes. See TWTValidationPreloadLocalizedStrings() and TWTValidationSetLocalization().
+ @param key The key. May not be nil.
+ @result The localized string for the key. Returns the key itself if there is no localized string for it.
+ */
+extern NSString *TWTValidationLocalizedString(NSString *key);
+
+#define TWTLocalizedString(key) TWTValidationLocalizedString(key)
+
+/*!
+ @abstract Loads the localized strings used in validation error descriptions.
+ @discussion Localized strings are loaded from the framework’s TWTValidation.strings table the first time an error
+     description is requested and are then looked up without locking. Apps that want to avoid paying for that
+     load while validating can call this function at startup. It is safe to call this function more than once and
+     from any thread.
+ */
+extern void TWTValidationPreloadLocalizedStrings(void);
+
+/*!
+ @abstract Returns the localization used for validation error descriptions.
+ @result The localization used for validation error descriptions, e.g., @"en". Returns nil if the default
+     localization, which is chosen based on the user’s preferred languages, is being used.
+ */
+extern NSString *TWTValidationLocalization(void);
+
+/*!
+ @abstract Sets the localization used for validation error descriptions.
+ @discussion The strings for the new localization are loaded immediately. Keys that are missing from the new
+     localization fall back to the framework’s development localization. Error descriptions that have already
+     been formatted are not affected.
+ @param localization The localization to use, e.g., @"fr". If nil, the default localization is used.
+ */
+extern void TWTValidationSetLocalization(NSString *localization);
@@ -0,0 +1,155 @@
+//
+//  TWTValidationLocalization.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTValidationLocalization.h>
+
+#import <stdatomic.h>
+
+#import <TWTValidation/TWTValidator.h>
+
+
+static NSString *const kTWTValidationStringsTable = @"TWTValidation";
+
+
+#pragma mark String Tables
+
+/*!
+ TWTValidationLocalizedStringTables pair a localization with its immutable dictionary of localized strings. The
+ current table is published through an atomic pointer with release semantics and read with acquire semantics, so
+ lookups never lock and always see a fully initialized table. Tables are never deallocated once published: a thread
+ may be reading a table at the moment it is replaced, and localizations change rarely enough that keeping every table
+ alive costs almost nothing.
+ */
+@interface TWTValidationLocalizedStringTable : NSObject
+
+@property (nonatomic, copy, readonly) NSString *localization;
+@property (nonatomic, copy, readonly) NSDictionary *strings;
+
+- (instancetype)initWithLocalization:(NSString *)localization;
+
+@end
+
+
+static NSMutableArray *TWTValidationPublishedStringTables = nil;
+static _Atomic(void *) TWTValidationCurrentStringTable = NULL;
+
+
+@implementation TWTValidationLocalizedStringTable
+
+- (instancetype)initWithLocalization:(NSString *)localization
+{
+    self = [super init];
+    if (self) {
+        _localization = [localization copy];
+
+        NSBundle *bundle = [NSBundle bundleForClass:[TWTValidator class]];
+        NSString *developmentLocalization = bundle.developmentLocalization ?: @"en";
+        NSString *tableLocalization = localization ?: [[NSBundle preferredLocalizationsFromArray:bundle.localizations] firstObject];
+
+        // Start with the development localization so that missing keys fall back to it, then overlay the requested one
+        NSMutableDictionary *strings = [[NSMutableDictionary alloc] init];
+        NSMutableOrderedSet *localizations = [NSMutableOrderedSet orderedSetWithObject:developmentLocalization];
+        if (tableLocalization) {
+            [localizations addObject:tableLocalization];
+        }
+
+        for (NSString *stringsLocalization in localizations) {
+            NSString *path = [bundle pathForResource:kTWTValidationStringsTable ofType:@"strings" inDirectory:nil forLocalization:stringsLocalization];
+            NSDictionary *localizedStrings = path ? [NSDictionary dictionaryWithContentsOfFile:path] : nil;
+            if (localizedStrings) {
+                [strings addEntriesFromDictionary:localizedStrings];
+            }
+        }
+
+        _strings = [strings copy];
+    }
+
+    return self;
+}
+
+@end
+
+
+static TWTValidationLocalizedStringTable *TWTValidationPublishStringTable(TWTValidationLocalizedStringTable *table, BOOL replacesCurrentTable)
+{
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        TWTValidationPublishedStringTables = [[NSMutableArray alloc] init];
+    });
+
+    @synchronized(TWTValidationPublishedStringTables) {
+        void *currentTable = atomic_load_explicit(&TWTValidationCurrentStringTable, memory_order_acquire);
+        if (currentTable && !replacesCurrentTable) {
+            return (__bridge TWTValidationLocalizedStringTable *)currentTable;
+        }
+
+        // The array keeps the table alive forever; the current table pointer itself is unretained
+        [TWTValidationPublishedStringTables addObject:table];
+        atomic_compare_exchange_strong_explicit(&TWTValidationCurrentStringTable, &currentTable, (__bridge void *)table,
+                                                memory_order_release, memory_order_relaxed);
+        return table;
+    }
+}
+
+
+static TWTValidationLocalizedStringTable *TWTValidationCurrentLocalizedStringTable(void)
+{
+    TWTValidationLocalizedStringTable *table = (__bridge TWTValidationLocalizedStringTable *)atomic_load_explicit(&TWTValidationCurrentStringTable,
+                                                                                                                  memory_order_acquire);
+    if (table) {
+        return table;
+    }
+
+    // If several threads get here at once, they may each load the default table, but only one is published. A
+    // localization set in the meantime takes precedence over the default
+    return TWTValidationPublishStringTable([[TWTValidationLocalizedStringTable alloc] initWithLocalization:nil], NO);
+}
+
+
+#pragma mark - Public Functions
+
+NSString *TWTValidationLocalizedString(NSString *key)
+{
+    return TWTValidationCurrentLocalizedStringTable().strings[key] ?: key;
+}
+
+
+void TWTValidationPreloadLocalizedStrings(void)
+{
+    TWTValidationCurrentLocalizedStringTable();
+}
+
+
+NSString *TWTValidationLocalization(void)
+{
+    return TWTValidationCurrentLocalizedStringTable().localization;
+}
+
+
+void TWTValidationSetLocalization(NSString *localization)
+{
+    TWTValidationPublishStringTable([[TWTValidationLocalizedStringTable alloc] initWithLocalization:localization], YES);
+}
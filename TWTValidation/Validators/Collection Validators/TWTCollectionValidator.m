@@ -28,6 +28,7 @@
 
 #import <TWTValidation/TWTCompoundValidator.h>
 #import <TWTValidation/TWTNumberValidator.h>
+#import <TWTValidation/TWTValidationContext.h>
 #import <TWTValidation/TWTValidationErrors.h>
 #import <TWTValidation/TWTValidationLocalization.h>
 
@@ -87,6 +88,12 @@
 
 
 - (BOOL)validateValue:(id)collection error:(out NSError *__autoreleasing *)outError
+{
+    return [self validateValue:collection context:nil error:outError];
+}
+
+
+- (BOOL)validateValue:(id)collection context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
 {
     if (![super validateValue:collection error:outError]) {
         return NO;
@@ -95,7 +102,7 @@
             *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueNotCollection
                                             failingValidator:self
                                                        value:collection
-                                        localizedDescription:TWTLocalizedString(@"TWTCollectionValidator.notCollectionError")];
+                                   localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTCollectionValidator.notCollectionError"); }];
         }
 
         return NO;
@@ -104,16 +111,61 @@
     NSError *countValidationError = nil;
     BOOL countValidated = YES;
     if (self.countValidator) {
-        countValidated = [self.countValidator validateValue:@([collection count]) error:outError ? &countValidationError : NULL];
+        countValidated = TWTValidatorValidateCount(self.countValidator, [collection count], outError ? &countValidationError : NULL);
     }
     
+    // In fail-fast mode, we can skip validating elements if the count is invalid and stop after the first invalid element
+    BOOL failsFast = TWTValidationContextIsFailFastModeEnabled(context);
+    TWTValidationExecutor *executor = TWTValidationContextExecutor(context);
     BOOL elementsValidated = YES;
     NSMutableArray *elementValidationErrors = outError ? [[NSMutableArray alloc] init] : nil;
-    for (id element in collection) {
-        NSError *error = nil;
-        if (![self.elementAndValidator validateValue:element error:outError ? &error : NULL]) {
+    if (!failsFast && [executor shouldExecuteConcurrentlyWithCount:[collection count]]) {
+        NSArray *elements = [self elementArrayForCollection:collection];
+        TWTCompoundValidator *elementAndValidator = self.elementAndValidator;
+
+        // Each result is NSNull if the element passed or was skipped because the deadline passed, and the element’s
+        // underlying errors otherwise
+        BOOL collectsErrors = outError != NULL;
+        BOOL deadlineExceeded = NO;
+        NSArray *results = [context resultsOfExecutingCount:elements.count
+                                           deadlineExceeded:&deadlineExceeded
+                                                      block:^id(TWTValidationContext *chunkContext, NSUInteger index) {
+            NSError *error = nil;
+            if (TWTValidationContextValidateValue(chunkContext, elementAndValidator, elements[index], collectsErrors ? &error : NULL)) {
+                return nil;
+            }
+
+            return error.twt_underlyingErrors ?: @[ ];
+        }];
+
+        if (deadlineExceeded) {
             elementsValidated = NO;
-            [elementValidationErrors addObjectsFromArray:error.twt_underlyingErrors];
+            [elementValidationErrors addObject:[context deadlineExceededErrorWithFailingValidator:self value:collection]];
+        }
+
+        for (id result in results) {
+            if (result != [NSNull null]) {
+                elementsValidated = NO;
+                [elementValidationErrors addObjectsFromArray:result];
+            }
+        }
+    } else if (countValidated || !failsFast) {
+        for (id element in collection) {
+            if ([context isPastDeadline]) {
+                elementsValidated = NO;
+                [elementValidationErrors addObject:[context deadlineExceededErrorWithFailingValidator:self value:collection]];
+                break;
+            }
+
+            NSError *error = nil;
+            if (!TWTValidationContextValidateValue(context, self.elementAndValidator, element, outError ? &error : NULL)) {
+                elementsValidated = NO;
+                [elementValidationErrors addObjectsFromArray:error.twt_underlyingErrors];
+
+                if (failsFast) {
+                    break;
+                }
+            }
         }
     }
     
@@ -136,9 +188,25 @@
         }
         
         *outError = [NSError errorWithDomain:TWTValidationErrorDomain code:TWTValidationErrorCodeCollectionValidatorError userInfo:[userInfo copy]];
+        *outError = TWTValidationContextErrorByMarkingTruncation(context, *outError);
     }
     
     return validated;
 }
 
+
+- (NSArray *)elementArrayForCollection:(id)collection
+{
+    if ([collection isKindOfClass:[NSArray class]]) {
+        return collection;
+    }
+
+    NSMutableArray *elements = [[NSMutableArray alloc] initWithCapacity:[collection count]];
+    for (id element in collection) {
+        [elements addObject:element];
+    }
+
+    return elements;
+}
+
 @end
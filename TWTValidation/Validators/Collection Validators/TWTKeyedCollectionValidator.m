@@ -27,6 +27,9 @@
 #import <TWTValidation/TWTKeyedCollectionValidator.h>
 
 #import <TWTValidation/TWTCompoundValidator.h>
+#import <TWTValidation/TWTKeyIndexTable.h>
+#import <TWTValidation/TWTNumberValidator.h>
+#import <TWTValidation/TWTValidationContext.h>
 #import <TWTValidation/TWTValidationErrors.h>
 #import <TWTValidation/TWTValidationLocalization.h>
 
@@ -83,7 +86,13 @@
 
 - (BOOL)validateValue:(id)value error:(out NSError *__autoreleasing *)outError
 {
-    return !self.valueValidator || [self.valueValidator validateValue:value error:outError];
+    return [self validateValue:value context:nil error:outError];
+}
+
+
+- (BOOL)validateValue:(id)value context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
+    return !self.valueValidator || [self.valueValidator validateValue:value context:context error:outError];
 }
 
 @end
@@ -91,6 +100,22 @@
 
 #pragma mark
 
+/*!
+ The number of entries a keyed collection validator fetches into stack buffers instead of heap buffers.
+ */
+static const NSUInteger TWTKeyedCollectionValidatorStackEntryCount = 64;
+
+
+/*!
+ TWTKeyedCollectionEntryFailures describe which parts of a keyed collection’s entry failed validation.
+ */
+typedef NS_OPTIONS(NSUInteger, TWTKeyedCollectionEntryFailures) {
+    TWTKeyedCollectionEntryFailureKey = 1 << 0,
+    TWTKeyedCollectionEntryFailureValue = 1 << 1,
+    TWTKeyedCollectionEntryFailureKeyValuePair = 1 << 2
+};
+
+
 @interface TWTKeyedCollectionValidator ()
 
 @property (nonatomic, strong, readwrite) TWTValidator *countValidator;
@@ -100,6 +125,10 @@
 @property (nonatomic, copy, readwrite) NSArray *keyValuePairValidators;
 @property (nonatomic, strong) NSMapTable *keyValuePairAndValidators;
 
+// The keys that have key-value pair validators and, at the same indexes, arrays of their validators
+@property (nonatomic, strong) TWTKeyIndexTable *keyValuePairKeyTable;
+@property (nonatomic, copy) NSArray *keyValuePairValidatorArrays;
+
 @end
 
 
@@ -126,22 +155,30 @@
         _keyValuePairValidators = [keyValuePairValidators copy];
         
         // Group all our pair validators by their key
+        NSMutableArray *pairKeys = [[NSMutableArray alloc] init];
         NSMapTable *pairValidatorsByKey = [NSMapTable strongToStrongObjectsMapTable];
         for (TWTKeyValuePairValidator *pairValidator in keyValuePairValidators) {
             NSMutableArray *validators = [pairValidatorsByKey objectForKey:pairValidator.key];
             if (!validators) {
                 validators = [[NSMutableArray alloc] init];
                 [pairValidatorsByKey setObject:validators forKey:pairValidator.key];
+                [pairKeys addObject:pairValidator.key];
             }
             
             [validators addObject:pairValidator];
         }
         
         _keyValuePairAndValidators = [NSMapTable strongToStrongObjectsMapTable];
-        for (id key in pairValidatorsByKey) {
-            [_keyValuePairAndValidators setObject:[TWTCompoundValidator andValidatorWithSubvalidators:[pairValidatorsByKey objectForKey:key]]
-                                           forKey:key];
+        NSMutableArray *pairValidatorArrays = [[NSMutableArray alloc] initWithCapacity:pairKeys.count];
+        for (id key in pairKeys) {
+            NSArray *validators = [[pairValidatorsByKey objectForKey:key] copy];
+            [_keyValuePairAndValidators setObject:[TWTCompoundValidator andValidatorWithSubvalidators:validators] forKey:key];
+            [pairValidatorArrays addObject:validators];
         }
+
+        // The set of keys is fixed, so each key’s validators can be found in a key index table instead of a dictionary
+        _keyValuePairKeyTable = [[TWTKeyIndexTable alloc] initWithKeys:pairKeys];
+        _keyValuePairValidatorArrays = [pairValidatorArrays copy];
     }
     
     return self;
@@ -181,6 +218,12 @@
 
 
 - (BOOL)validateValue:(id)keyedCollection error:(out NSError *__autoreleasing *)outError
+{
+    return [self validateValue:keyedCollection context:nil error:outError];
+}
+
+
+- (BOOL)validateValue:(id)keyedCollection context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
 {
     if (![super validateValue:keyedCollection error:outError]) {
         return NO;
@@ -191,17 +234,16 @@
             *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueNotKeyedCollection
                                             failingValidator:self
                                                        value:keyedCollection
-                                        localizedDescription:TWTLocalizedString(@"TWTKeyedCollectionValidator.notKeyedCollectionError")];
+                                   localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTKeyedCollectionValidator.notKeyedCollectionError"); }];
         }
 
         return NO;
     }
 
-
     NSError *countValidationError = nil;
     BOOL countValidated = YES;
     if (self.countValidator) {
-        countValidated = [self.countValidator validateValue:@([keyedCollection count]) error:outError ? &countValidationError : NULL];
+        countValidated = TWTValidatorValidateCount(self.countValidator, [keyedCollection count], outError ? &countValidationError : NULL);
     }
 
     BOOL keysValidated = YES;
@@ -212,25 +254,136 @@
     NSMutableArray *valueValidationErrors = outError ? [[NSMutableArray alloc] init] : nil;
     NSMutableArray *pairValidationErrors = outError ? [[NSMutableArray alloc] init] : nil;
 
-    for (id key in keyedCollection) {
-        NSError *error = nil;
-        if (![self.keyAndValidator validateValue:key error:outError ? &error : NULL]) {
-            keysValidated = NO;
-            [keyValidationErrors addObjectsFromArray:error.twt_underlyingErrors];
+    // In fail-fast mode, we can skip validating entries if the count is invalid and stop after the first invalid entry
+    BOOL failsFast = TWTValidationContextIsFailFastModeEnabled(context);
+    TWTValidationExecutor *executor = TWTValidationContextExecutor(context);
+    if (!failsFast && [executor shouldExecuteConcurrentlyWithCount:[keyedCollection count]]) {
+        NSMutableArray *keys = [[NSMutableArray alloc] initWithCapacity:[keyedCollection count]];
+        for (id key in keyedCollection) {
+            [keys addObject:key];
         }
-        
-        id value = [keyedCollection objectForKey:key];
-        error = nil;
-        if (![self.valueAndValidator validateValue:value error:outError ? &error : NULL]) {
+
+        // Each result is an array containing the errors from the key, value, and key-value pair validations, in that
+        // order. Each of those is NSNull if validation passed. Results are NSNull for entries that passed or were
+        // skipped because the deadline passed
+        BOOL collectsErrors = outError != NULL;
+        BOOL deadlineExceeded = NO;
+        NSArray *results = [context resultsOfExecutingCount:keys.count
+                                           deadlineExceeded:&deadlineExceeded
+                                                      block:^id(TWTValidationContext *chunkContext, NSUInteger index) {
+            id key = keys[index];
+            NSMutableArray *keyErrors = collectsErrors ? [[NSMutableArray alloc] init] : nil;
+            NSMutableArray *valueErrors = collectsErrors ? [[NSMutableArray alloc] init] : nil;
+            NSMutableArray *pairErrors = collectsErrors ? [[NSMutableArray alloc] init] : nil;
+
+            TWTKeyedCollectionEntryFailures failures = [self validateEntryWithKey:key
+                                                                            value:[keyedCollection objectForKey:key]
+                                                                          context:chunkContext
+                                                                        failsFast:NO
+                                                                        keyErrors:keyErrors
+                                                                      valueErrors:valueErrors
+                                                                       pairErrors:pairErrors];
+            if (!failures) {
+                return nil;
+            }
+
+            return @[ (failures & TWTKeyedCollectionEntryFailureKey) ? (keyErrors ?: @[ ]) : [NSNull null],
+                      (failures & TWTKeyedCollectionEntryFailureValue) ? (valueErrors ?: @[ ]) : [NSNull null],
+                      (failures & TWTKeyedCollectionEntryFailureKeyValuePair) ? (pairErrors ?: @[ ]) : [NSNull null] ];
+        }];
+
+        if (deadlineExceeded) {
             valuesValidated = NO;
-            [valueValidationErrors addObjectsFromArray:error.twt_underlyingErrors];
+            [valueValidationErrors addObject:[context deadlineExceededErrorWithFailingValidator:self value:keyedCollection]];
         }
-        
-        TWTCompoundValidator *pairAndValidator = [self.keyValuePairAndValidators objectForKey:key];
-        error = nil;
-        if (pairAndValidator && ![pairAndValidator validateValue:value error:outError ? &error : NULL]) {
-            pairsValidated = NO;
-            [pairValidationErrors addObjectsFromArray:error.twt_underlyingErrors];
+
+        for (id result in results) {
+            if (result == [NSNull null]) {
+                continue;
+            }
+
+            if (result[0] != [NSNull null]) {
+                keysValidated = NO;
+                [keyValidationErrors addObjectsFromArray:result[0]];
+            }
+
+            if (result[1] != [NSNull null]) {
+                valuesValidated = NO;
+                [valueValidationErrors addObjectsFromArray:result[1]];
+            }
+
+            if (result[2] != [NSNull null]) {
+                pairsValidated = NO;
+                [pairValidationErrors addObjectsFromArray:result[2]];
+            }
+        }
+    } else if (countValidated || !failsFast) {
+        // Fetch all the keys up front so that each entry is validated in a single pass. Dictionaries hand over their
+        // values at the same time, which saves a hash lookup per entry
+        BOOL isDictionary = [keyedCollection isKindOfClass:[NSDictionary class]];
+        NSUInteger entryCount = [keyedCollection count];
+        __unsafe_unretained id stackKeys[TWTKeyedCollectionValidatorStackEntryCount];
+        __unsafe_unretained id stackValues[TWTKeyedCollectionValidatorStackEntryCount];
+        __unsafe_unretained id *keys = stackKeys;
+        __unsafe_unretained id *values = stackValues;
+        if (entryCount > TWTKeyedCollectionValidatorStackEntryCount) {
+            keys = (__unsafe_unretained id *)malloc(entryCount * sizeof(id));
+            values = isDictionary ? (__unsafe_unretained id *)malloc(entryCount * sizeof(id)) : NULL;
+        }
+
+        if (isDictionary) {
+            [(NSDictionary *)keyedCollection getObjects:values andKeys:keys];
+        } else {
+            NSUInteger keyIndex = 0;
+            for (id key in keyedCollection) {
+                if (keyIndex == entryCount) {
+                    break;
+                }
+
+                keys[keyIndex++] = key;
+            }
+
+            entryCount = keyIndex;
+        }
+
+        for (NSUInteger entryIndex = 0; entryIndex < entryCount; ++entryIndex) {
+            // Entries that were not validated before the deadline passed are reported with the value errors
+            if ([context isPastDeadline]) {
+                valuesValidated = NO;
+                [valueValidationErrors addObject:[context deadlineExceededErrorWithFailingValidator:self value:keyedCollection]];
+                break;
+            }
+
+            // Values from other collections may not be retained by the collection, so they are fetched one at a time
+            id key = keys[entryIndex];
+            id value = isDictionary ? values[entryIndex] : [keyedCollection objectForKey:key];
+            TWTKeyedCollectionEntryFailures failures = [self validateEntryWithKey:key
+                                                                            value:value
+                                                                          context:context
+                                                                        failsFast:failsFast
+                                                                        keyErrors:keyValidationErrors
+                                                                      valueErrors:valueValidationErrors
+                                                                       pairErrors:pairValidationErrors];
+            if (failures & TWTKeyedCollectionEntryFailureKey) {
+                keysValidated = NO;
+            }
+
+            if (failures & TWTKeyedCollectionEntryFailureValue) {
+                valuesValidated = NO;
+            }
+
+            if (failures & TWTKeyedCollectionEntryFailureKeyValuePair) {
+                pairsValidated = NO;
+            }
+
+            if (failures && failsFast) {
+                break;
+            }
+        }
+
+        if (keys != stackKeys) {
+            free(keys);
+            free(values);
         }
     }
     
@@ -261,9 +414,85 @@
         }
 
         *outError = [NSError errorWithDomain:TWTValidationErrorDomain code:TWTValidationErrorCodeKeyedCollectionValidatorError userInfo:[userInfo copy]];
+        *outError = TWTValidationContextErrorByMarkingTruncation(context, *outError);
     }
     
     return validated;
 }
 
+
+/*!
+ @abstract Validates a single entry in a keyed collection with the receiver’s key, value, and key-value pair
+     validators, adding any errors to the specified arrays.
+ @discussion Subvalidators are run directly rather than through compound validators, so that no intermediate
+     errors are created and the entry’s key-value pair validators are found with a single table lookup.
+ @param key The entry’s key.
+ @param value The entry’s value.
+ @param context The validation context. May be nil.
+ @param failsFast Whether to stop validating the entry after its first failure.
+ @param keyErrors The array to which key validation errors are added. If nil, errors are not collected.
+ @param valueErrors The array to which value validation errors are added. If nil, errors are not collected.
+ @param pairErrors The array to which key-value pair validation errors are added. If nil, errors are not collected.
+ @result The parts of the entry that failed validation. 0 if the entry is valid.
+ */
+- (TWTKeyedCollectionEntryFailures)validateEntryWithKey:(id)key
+                                                  value:(id)value
+                                                context:(TWTValidationContext *)context
+                                              failsFast:(BOOL)failsFast
+                                              keyErrors:(NSMutableArray *)keyErrors
+                                            valueErrors:(NSMutableArray *)valueErrors
+                                             pairErrors:(NSMutableArray *)pairErrors
+{
+    TWTKeyedCollectionEntryFailures failures = 0;
+
+    for (TWTValidator *keyValidator in self.keyAndValidator.subvalidators) {
+        NSError *error = nil;
+        if (!TWTValidationContextValidateValue(context, keyValidator, key, keyErrors ? &error : NULL)) {
+            failures |= TWTKeyedCollectionEntryFailureKey;
+            if (error) {
+                [keyErrors addObject:error];
+            }
+
+            if (failsFast) {
+                return failures;
+            }
+        }
+    }
+
+    for (TWTValidator *valueValidator in self.valueAndValidator.subvalidators) {
+        NSError *error = nil;
+        if (!TWTValidationContextValidateValue(context, valueValidator, value, valueErrors ? &error : NULL)) {
+            failures |= TWTKeyedCollectionEntryFailureValue;
+            if (error) {
+                [valueErrors addObject:error];
+            }
+
+            if (failsFast) {
+                return failures;
+            }
+        }
+    }
+
+    NSUInteger pairIndex = TWTKeyIndexTableIndexOfKey(self.keyValuePairKeyTable, key);
+    if (pairIndex == NSNotFound) {
+        return failures;
+    }
+
+    for (TWTKeyValuePairValidator *pairValidator in self.keyValuePairValidatorArrays[pairIndex]) {
+        NSError *error = nil;
+        if (!TWTValidationContextValidateValue(context, pairValidator, value, pairErrors ? &error : NULL)) {
+            failures |= TWTKeyedCollectionEntryFailureKeyValuePair;
+            if (error) {
+                [pairErrors addObject:error];
+            }
+
+            if (failsFast) {
+                return failures;
+            }
+        }
+    }
+
+    return failures;
+}
+
 @end
@@ -50,8 +50,9 @@ typedef NS_ENUM(NSUInteger, TWTCompoundValidatorType) {
  validators, validation passes if and only if at least one of its subvalidators passes validation. Validation
  passes for a Mutual Exclusion validator only if exactly one subvalidator passes validation.
 
- It is important to note that compound validators do not short-circuit validation. All of a compound
- validator’s subvalidators validate a value before the compound validator returns from -validateValue:error:.
+ It is important to note that compound validators do not short-circuit validation unless fail-fast mode is
+ enabled (see +[TWTValidator isFailFastModeEnabled]). By default, all of a compound validator’s subvalidators
+ validate a value before the compound validator returns from -validateValue:error:.
 
  Compound validators are immutable objects. As such, sending -copy or -copyWithZone: to a compound validator
  will simply return the validator itself.
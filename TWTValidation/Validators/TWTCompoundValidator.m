@@ -26,6 +26,7 @@
 
 #import <TWTValidation/TWTCompoundValidator.h>
 
+#import <TWTValidation/TWTValidationContext.h>
 #import <TWTValidation/TWTValidationErrors.h>
 #import <TWTValidation/TWTValidationLocalization.h>
 
@@ -96,20 +97,95 @@
 }
 
 
+- (BOOL)isResultDecidedWithValidatedCount:(NSUInteger)validatedCount invalidatedCount:(NSUInteger)invalidatedCount
+{
+    // Note that the checks in -validateValue:context:error: still produce the correct result if we stop at these points
+    switch (self.compoundValidatorType) {
+        case TWTCompoundValidatorTypeNot:
+        case TWTCompoundValidatorTypeOr:
+            return validatedCount > 0;
+        case TWTCompoundValidatorTypeAnd:
+            return invalidatedCount > 0;
+        case TWTCompoundValidatorTypeMutualExclusion:
+            return validatedCount > 1;
+    }
+
+    return NO;
+}
+
+
 - (BOOL)validateValue:(id)value error:(out NSError *__autoreleasing *)outError
+{
+    return [self validateValue:value context:nil error:outError];
+}
+
+
+- (BOOL)validateValue:(id)value context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
 {
     // Only collect errors if outError is non-NULL
     NSMutableArray *errors = outError ? [[NSMutableArray alloc] init] : nil;
 
+    NSArray *subvalidators = self.subvalidators;
+    BOOL failsFast = TWTValidationContextIsFailFastModeEnabled(context);
+    TWTValidationExecutor *executor = TWTValidationContextExecutor(context);
     NSUInteger validatedCount = 0;
-    for (TWTValidator *subvalidator in self.subvalidators) {
-        NSError *error = nil;
-
-        // Only pass in an error if outError is non-nil. This will save the subvalidators some work
-        if ([subvalidator validateValue:value error:outError ? &error : NULL]) {
-            ++validatedCount;
-        } else if (error) {
-            [errors addObject:error];
+    NSUInteger invalidatedCount = 0;
+    BOOL deadlineExceeded = NO;
+
+    if (!failsFast && [executor shouldExecuteConcurrentlyWithCount:subvalidators.count]) {
+        // Each result is @YES if the subvalidator passed, and the subvalidator’s error or @NO otherwise. Results are
+        // NSNull for subvalidators that were skipped because the deadline passed
+        BOOL collectsErrors = outError != NULL;
+        NSArray *results = [context resultsOfExecutingCount:subvalidators.count
+                                           deadlineExceeded:&deadlineExceeded
+                                                      block:^id(TWTValidationContext *chunkContext, NSUInteger index) {
+            NSError *error = nil;
+            if (TWTValidationContextValidateValue(chunkContext, subvalidators[index], value, collectsErrors ? &error : NULL)) {
+                return @YES;
+            }
+
+            return error ?: @NO;
+        }];
+
+        if (deadlineExceeded) {
+            [errors addObject:[context deadlineExceededErrorWithFailingValidator:self value:value]];
+        }
+
+        for (id result in results) {
+            if (result == [NSNull null]) {
+                continue;
+            } else if ([result isKindOfClass:[NSError class]]) {
+                ++invalidatedCount;
+                [errors addObject:result];
+            } else if ([result boolValue]) {
+                ++validatedCount;
+            } else {
+                ++invalidatedCount;
+            }
+        }
+    } else {
+        for (TWTValidator *subvalidator in subvalidators) {
+            if ([context isPastDeadline]) {
+                deadlineExceeded = YES;
+                [errors addObject:[context deadlineExceededErrorWithFailingValidator:self value:value]];
+                break;
+            }
+
+            NSError *error = nil;
+
+            // Only pass in an error if outError is non-nil. This will save the subvalidators some work
+            if (TWTValidationContextValidateValue(context, subvalidator, value, outError ? &error : NULL)) {
+                ++validatedCount;
+            } else {
+                ++invalidatedCount;
+                if (error) {
+                    [errors addObject:error];
+                }
+            }
+
+            if (failsFast && [self isResultDecidedWithValidatedCount:validatedCount invalidatedCount:invalidatedCount]) {
+                break;
+            }
         }
     }
 
@@ -119,7 +195,7 @@
             validated = validatedCount == 0;
             break;
         case TWTCompoundValidatorTypeAnd:
-            validated = validatedCount == self.subvalidators.count;
+            validated = validatedCount == subvalidators.count;
             break;
         case TWTCompoundValidatorTypeOr:
             validated = validatedCount > 0;
@@ -128,29 +204,30 @@
             validated = validatedCount == 1;
             break;
     }
-    
+
+    if (deadlineExceeded) {
+        validated = NO;
+    }
+
     if (!validated && outError) {
-        NSString *description = nil;
-        switch (self.compoundValidatorType) {
-            case TWTCompoundValidatorTypeNot:
-                description = TWTLocalizedString(@"TWTCompoundValidator.not.validationError");
-                break;
-            case TWTCompoundValidatorTypeAnd:
-                description = TWTLocalizedString(@"TWTCompoundValidator.and.validationError");
-                break;
-            case TWTCompoundValidatorTypeOr:
-                description = TWTLocalizedString(@"TWTCompoundValidator.or.validationError");
-                break;
-            case TWTCompoundValidatorTypeMutualExclusion:
-                description = TWTLocalizedString(@"TWTCompoundValidator.mutualExclusion.validationError");
-                break;
-        }
-        
+        TWTCompoundValidatorType compoundValidatorType = self.compoundValidatorType;
         *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeCompoundValidatorError
                                         failingValidator:self
                                                    value:value
-                                    localizedDescription:description
+                               localizedDescriptionBlock:^NSString *{
+                                   switch (compoundValidatorType) {
+                                       case TWTCompoundValidatorTypeNot:
+                                           return TWTLocalizedString(@"TWTCompoundValidator.not.validationError");
+                                       case TWTCompoundValidatorTypeAnd:
+                                           return TWTLocalizedString(@"TWTCompoundValidator.and.validationError");
+                                       case TWTCompoundValidatorTypeOr:
+                                           return TWTLocalizedString(@"TWTCompoundValidator.or.validationError");
+                                       case TWTCompoundValidatorTypeMutualExclusion:
+                                           return TWTLocalizedString(@"TWTCompoundValidator.mutualExclusion.validationError");
+                                   }
+                               }
                                         underlyingErrors:errors];
+        *outError = TWTValidationContextErrorByMarkingTruncation(context, *outError);
     }
 
     return validated;
@@ -0,0 +1,122 @@
+//
+//  TWTKeyIndexTable.h
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+@import Foundation;
+
+/*!
+ TWTKeyIndexTables map each key in a fixed array of distinct keys to its index in that array. They are intended for
+ validators that know at initialization which keys they validate specially and need to look up every key of every
+ value they validate.
+
+ Lookups use linear probing in a table that is at most half full, so most take one or two probes. Tables with only a
+ few keys also look for a seed that hashes each key to its own entry, in which case lookups of the table’s keys take a
+ single probe; for more keys, such a seed is too unlikely to be worth looking for. Keys are compared by pointer
+ before they are compared with -isEqual:, so keys that are the same objects as the table’s keys—e.g., interned
+ string literals—are found without sending any messages other than -hash.
+
+ Key index tables are immutable and may be used from multiple threads at once.
+ */
+@interface TWTKeyIndexTable : NSObject {
+@public
+    // These are for TWTKeyIndexTableIndexOfKey() only
+    __unsafe_unretained id *_keyObjects;
+    NSUInteger *_keyHashes;
+    NSUInteger _keyCount;
+
+    // Each entry is the index of a key plus one, so that zero can mean empty
+    uint32_t *_entries;
+    NSUInteger _entryMask;
+    uint64_t _seed;
+    NSUInteger _probeLimit;
+}
+
+/*!
+ @abstract The table’s keys.
+ */
+@property (nonatomic, copy, readonly) NSArray *keys;
+
+/*!
+ @abstract Initializes a newly allocated key index table with the specified keys.
+ @discussion This is the class’s designated initializer.
+ @param keys The keys. Keys must be distinct and must not change their hashes while the table exists. May be nil.
+ @result An initialized key index table with the specified keys.
+ */
+- (instancetype)initWithKeys:(NSArray *)keys;
+
+@end
+
+
+/*!
+ @abstract Returns the index of the first entry that a key with the specified hash is probed for.
+ @param hash The key’s hash.
+ @param seed The table’s seed.
+ @param mask The table’s entry mask.
+ @result The index of the key’s first entry.
+ */
+static inline NSUInteger TWTKeyIndexTableEntryIndexForHash(NSUInteger hash, uint64_t seed, NSUInteger mask)
+{
+    // The splitmix64 finalizer, so that every bit of the hash and seed affects the index
+    uint64_t bits = (uint64_t)hash ^ seed;
+    bits ^= bits >> 30;
+    bits *= 0xbf58476d1ce4e5b9ULL;
+    bits ^= bits >> 27;
+    bits *= 0x94d049bb133111ebULL;
+    return (NSUInteger)(bits ^ (bits >> 31)) & mask;
+}
+
+
+/*!
+ @abstract Returns the index of the specified key in a key index table.
+ @discussion This neither allocates nor retains anything, so it is suitable for use in validation loops.
+ @param table The key index table. May not be nil.
+ @param key The key. May be nil.
+ @result The index of the key in the table’s keys, or NSNotFound if the table does not contain the key.
+ */
+static inline NSUInteger TWTKeyIndexTableIndexOfKey(__unsafe_unretained TWTKeyIndexTable *table, __unsafe_unretained id key)
+{
+    if (!table->_keyCount || !key) {
+        return NSNotFound;
+    }
+
+    NSUInteger hash = [key hash];
+    NSUInteger entryIndex = TWTKeyIndexTableEntryIndexForHash(hash, table->_seed, table->_entryMask);
+    for (NSUInteger probe = 0; probe < table->_probeLimit; ++probe) {
+        uint32_t entry = table->_entries[entryIndex];
+        if (!entry) {
+            return NSNotFound;
+        }
+
+        NSUInteger keyIndex = entry - 1;
+        __unsafe_unretained id tableKey = table->_keyObjects[keyIndex];
+        if (tableKey == key || (table->_keyHashes[keyIndex] == hash && [tableKey isEqual:key])) {
+            return keyIndex;
+        }
+
+        entryIndex = (entryIndex + 1) & table->_entryMask;
+    }
+
+    return NSNotFound;
+}
@@ -0,0 +1,165 @@
+//
+//  TWTKeyIndexTable.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTKeyIndexTable.h>
+
+
+/*!
+ The largest number of keys for which a key index table looks for a perfect hash. The chance that a random seed hashes
+ n keys into 4n entries without a collision is roughly e^(-n/8), so for more keys than this, a search would almost
+ always fail and only slow down initialization.
+ */
+static const NSUInteger TWTKeyIndexTablePerfectHashKeyCountLimit = 16;
+
+/*!
+ The number of seeds a key index table tries at each capacity when looking for a perfect hash of its keys.
+ */
+static const NSUInteger TWTKeyIndexTableSeedAttemptCount = 32;
+
+
+@implementation TWTKeyIndexTable
+
+- (instancetype)init
+{
+    return [self initWithKeys:nil];
+}
+
+
+- (instancetype)initWithKeys:(NSArray *)keys
+{
+    self = [super init];
+    if (self) {
+        NSAssert(keys.count <= UINT32_MAX, @"Too many keys for a key index table");
+        _keys = [keys copy] ?: @[ ];
+        _keyCount = _keys.count;
+        _keyObjects = (__unsafe_unretained id *)calloc(MAX(_keyCount, 1), sizeof(id));
+        _keyHashes = calloc(MAX(_keyCount, 1), sizeof(NSUInteger));
+
+        NSUInteger keyIndex = 0;
+        for (id key in _keys) {
+            _keyObjects[keyIndex] = key;
+            _keyHashes[keyIndex] = [key hash];
+            ++keyIndex;
+        }
+
+        [self fillEntries];
+    }
+
+    return self;
+}
+
+
+- (void)dealloc
+{
+    free(_keyObjects);
+    free(_keyHashes);
+    free(_entries);
+}
+
+
+- (void)fillEntries
+{
+    // Keep the table at most half full so that probe sequences stay short even without a perfect hash
+    NSUInteger minimumCapacity = 2;
+    while (minimumCapacity < _keyCount * 2) {
+        minimumCapacity <<= 1;
+    }
+
+    // For a few keys, try for a perfect hash in a table that’s at most half full, and then in one that’s at most a
+    // quarter full. Seeds are checked without filling the table, which is only filled once a seed is chosen
+    if (_keyCount <= TWTKeyIndexTablePerfectHashKeyCountLimit) {
+        bool *occupiedEntries = malloc(minimumCapacity * 2 * sizeof(bool));
+        for (NSUInteger capacity = minimumCapacity; capacity <= minimumCapacity * 2; capacity <<= 1) {
+            for (uint64_t attempt = 0; attempt < TWTKeyIndexTableSeedAttemptCount; ++attempt) {
+                uint64_t seed = attempt * 0x9e3779b97f4a7c15ULL;
+                if ([self seed:seed hashesKeysWithoutCollisionsInCapacity:capacity occupiedEntries:occupiedEntries]) {
+                    free(occupiedEntries);
+                    [self fillEntriesWithCapacity:capacity seed:seed];
+                    return;
+                }
+            }
+        }
+
+        free(occupiedEntries);
+    }
+
+    [self fillEntriesWithCapacity:minimumCapacity seed:0];
+}
+
+
+/*!
+ @abstract Returns whether the specified seed hashes each of the receiver’s keys to a different entry.
+ @param seed The seed with which to hash keys.
+ @param capacity The number of entries. Must be a power of two greater than the number of keys.
+ @param occupiedEntries Scratch space for at least capacity flags.
+ @result Whether no two keys are hashed to the same entry.
+ */
+- (BOOL)seed:(uint64_t)seed hashesKeysWithoutCollisionsInCapacity:(NSUInteger)capacity occupiedEntries:(bool *)occupiedEntries
+{
+    memset(occupiedEntries, 0, capacity * sizeof(bool));
+    for (NSUInteger keyIndex = 0; keyIndex < _keyCount; ++keyIndex) {
+        NSUInteger entryIndex = TWTKeyIndexTableEntryIndexForHash(_keyHashes[keyIndex], seed, capacity - 1);
+        if (occupiedEntries[entryIndex]) {
+            return NO;
+        }
+
+        occupiedEntries[entryIndex] = true;
+    }
+
+    return YES;
+}
+
+
+/*!
+ @abstract Replaces the receiver’s entries with ones that have the specified capacity and seed.
+ @param capacity The number of entries. Must be a power of two greater than the number of keys.
+ @param seed The seed with which to hash keys.
+ @result The length of the longest probe sequence in the new entries.
+ */
+- (NSUInteger)fillEntriesWithCapacity:(NSUInteger)capacity seed:(uint64_t)seed
+{
+    free(_entries);
+    _entries = calloc(capacity, sizeof(uint32_t));
+    _entryMask = capacity - 1;
+    _seed = seed;
+    _probeLimit = 0;
+
+    for (NSUInteger keyIndex = 0; keyIndex < _keyCount; ++keyIndex) {
+        NSUInteger entryIndex = TWTKeyIndexTableEntryIndexForHash(_keyHashes[keyIndex], seed, _entryMask);
+        NSUInteger probeCount = 1;
+        while (_entries[entryIndex]) {
+            entryIndex = (entryIndex + 1) & _entryMask;
+            ++probeCount;
+        }
+
+        _entries[entryIndex] = (uint32_t)(keyIndex + 1);
+        _probeLimit = MAX(_probeLimit, probeCount);
+    }
+
+    return _probeLimit;
+}
+
+@end
@@ -29,6 +29,7 @@
 @import ObjectiveC.runtime;
 
 #import <TWTValidation/TWTCompoundValidator.h>
+#import <TWTValidation/TWTValidationContext.h>
 #import <TWTValidation/TWTValidationErrors.h>
 #import <TWTValidation/TWTValidationLocalization.h>
 
@@ -88,6 +89,12 @@ static SEL TWTKeyValueCodingValidatorSelectorForKey(NSString *key)
 
 
 - (BOOL)validateValue:(id)object error:(out NSError *__autoreleasing *)outError
+{
+    return [self validateValue:object context:nil error:outError];
+}
+
+
+- (BOOL)validateValue:(id)object context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
 {
     if (![super validateValue:object error:outError]) {
         return NO;
@@ -98,8 +105,20 @@ static SEL TWTKeyValueCodingValidatorSelectorForKey(NSString *key)
     // For each key, get the validators from object (using -twt_validatorsForKey:). If object didn’t return any,
     // ask the object’s class for its validators (using +twt_validatorsForKey:). If that didn’t return any either,
     // fall back on -validateValue:forKey:error: instead.
+    BOOL failsFast = TWTValidationContextIsFailFastModeEnabled(context);
     BOOL validated = YES;
     for (NSString *key in self.keys) {
+        if (!validated && failsFast) {
+            break;
+        } else if ([context isPastDeadline]) {
+            validated = NO;
+            if (outError) {
+                errorsByKey[key] = @[ [context deadlineExceededErrorWithFailingValidator:self value:object] ];
+            }
+
+            break;
+        }
+
         NSError *error = nil;
         id value = [object valueForKey:key];
 
@@ -113,7 +132,7 @@ static SEL TWTKeyValueCodingValidatorSelectorForKey(NSString *key)
 
         if (validatorSet) {
             TWTCompoundValidator *andValidator = [TWTCompoundValidator andValidatorWithSubvalidators:[validatorSet allObjects]];
-            if (![andValidator validateValue:value error:outError ? &error : NULL]) {
+            if (!TWTValidationContextValidateValue(context, andValidator, value, outError ? &error : NULL)) {
                 validated = NO;
                 if (error.twt_underlyingErrors) {
                     errorsByKey[key] = error.twt_underlyingErrors;
@@ -143,6 +162,7 @@ static SEL TWTKeyValueCodingValidatorSelectorForKey(NSString *key)
         *outError = [NSError errorWithDomain:TWTValidationErrorDomain
                                         code:TWTValidationErrorCodeKeyValueCodingValidatorError
                                     userInfo:userInfo];
+        *outError = TWTValidationContextErrorByMarkingTruncation(context, *outError);
     }
 
     return validated;
@@ -0,0 +1,308 @@
+//
+//  TWTValidationContext.h
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+@import Foundation;
+
+#import <TWTValidation/TWTValidationExecutor.h>
+#import <TWTValidation/TWTValidator.h>
+
+
+/*!
+ @abstract TWTValidationPathFrames record one step of the path from the outermost value being validated to a part of
+     that value, along with the schema keyword that applies to the part.
+ @discussion Validators that validate the parts of a value push a frame onto their validation context, usually a
+     local variable, before validating each part and pop it afterward. Frames are linked to their parents and are
+     only converted into JSON pointer strings when an error is created, so recording paths costs almost nothing when
+     validation passes. Frames do not retain their strings, which must outlive the frame.
+ @field parent The frame for the enclosing value. This is set by -[TWTValidationContext pushPathFrame:].
+ @field instanceKey The key of the part in its enclosing value, or nil if the part is identified by an index.
+ @field instanceIndex The index of the part in its enclosing value. NSNotFound if the part is identified by a key
+     or the frame does not move to a new value, e.g., when validating a property dependency.
+ @field schemaKeyword The schema keyword that applies to the part, e.g., @"properties". nil if the frame does not
+     have a schema path component.
+ @field schemaKey The key of the schema within the keyword’s value, e.g., a property name, or nil if none.
+ @field schemaIndex The index of the schema within the keyword’s value, or NSNotFound if none.
+ */
+typedef struct TWTValidationPathFrame {
+    const struct TWTValidationPathFrame *parent;
+    __unsafe_unretained NSString *instanceKey;
+    NSUInteger instanceIndex;
+    __unsafe_unretained NSString *schemaKeyword;
+    __unsafe_unretained NSString *schemaKey;
+    NSUInteger schemaIndex;
+} TWTValidationPathFrame;
+
+
+/*!
+ @abstract Returns a path frame for the part of a value with the specified key.
+ @param instanceKey The key of the part. If nil, the frame does not have an instance path component.
+ @param schemaKeyword The schema keyword that applies to the part.
+ @param schemaKey The key of the schema within the keyword’s value, or nil if none.
+ @result A new path frame.
+ */
+static inline TWTValidationPathFrame TWTValidationPathFrameMakeWithKey(NSString *instanceKey, NSString *schemaKeyword, NSString *schemaKey)
+{
+    return (TWTValidationPathFrame){ NULL, instanceKey, NSNotFound, schemaKeyword, schemaKey, NSNotFound };
+}
+
+
+/*!
+ @abstract Returns a path frame for the part of a value at the specified index.
+ @param instanceIndex The index of the part.
+ @param schemaKeyword The schema keyword that applies to the part.
+ @param schemaIndex The index of the schema within the keyword’s value, or NSNotFound if none.
+ @result A new path frame.
+ */
+static inline TWTValidationPathFrame TWTValidationPathFrameMakeWithIndex(NSUInteger instanceIndex, NSString *schemaKeyword, NSUInteger schemaIndex)
+{
+    return (TWTValidationPathFrame){ NULL, nil, instanceIndex, schemaKeyword, nil, schemaIndex };
+}
+
+
+/*!
+ TWTValidationContexts hold the state of a validation run: how it should be performed, when it should give up, and which
+ part of the value is being validated. Contexts are passed to validators using
+ -[TWTValidator validateValue:context:error:], and validators that aggregate the results of other validators pass
+ their context to those validators.
+
+ Contexts are not thread-safe. A context may be reused for any number of validations, but only on one thread at a
+ time. Validators that validate concurrently give each piece of work a copy of their context, which has the same
+ configuration and error budget but its own path.
+ */
+@interface TWTValidationContext : NSObject <NSCopying>
+
+/*!
+ @abstract The executor that validators use to execute their work.
+ @discussion If nil, validators execute their work serially on the calling thread. nil by default.
+ */
+@property (nonatomic, strong) TWTValidationExecutor *executor;
+
+/*!
+ @abstract Whether validators stop validating a value as soon as its validation result is known.
+ @discussion See +[TWTValidator isFailFastModeEnabled] for more information. This is initially the value of
+     +[TWTValidator isFailFastModeEnabled] when the context is created.
+ */
+@property (nonatomic, assign, getter = isFailFastModeEnabled) BOOL failFastModeEnabled;
+
+/*!
+ @abstract The time by which validation must finish.
+ @discussion Validators that aggregate the results of other validators check the deadline before validating each
+     subvalidator, element, or entry, whether serially or using -resultsOfExecutingCount:deadlineExceeded:block:.
+     Once the deadline has passed, they stop validating and the value being validated is invalid. Their errors include an underlying error with the TWTValidationErrorCodeDeadlineExceeded
+     code. nil, the default, means there is no deadline.
+ */
+@property (nonatomic, copy) NSDate *deadline;
+
+/*!
+ @abstract Returns whether the receiver’s deadline has passed.
+ @result Whether the receiver has a deadline and it has passed.
+ */
+- (BOOL)isPastDeadline;
+
+/*!
+ @abstract Returns an error indicating that validation stopped because the receiver’s deadline passed.
+ @param validator The validator that stopped.
+ @param value The value that the validator was validating.
+ @result A deadline exceeded error.
+ */
+- (NSError *)deadlineExceededErrorWithFailingValidator:(TWTValidator *)validator value:(id)value;
+
+/*!
+ @abstract Executes the specified block once for each index from 0 to count - 1 using the receiver’s executor and
+     returns the results in index order.
+ @discussion Validators use this to validate their subvalidators, elements, or entries concurrently. The indexes are
+     divided into a bounded number of chunks, each of which is executed with its own copy of the receiver, so the
+     receiver is copied once per chunk rather than once per index. The copy is passed to the block, which must use
+     it instead of the receiver.
+
+     The deadline is checked before each index. Once it has passed, no more indexes are executed and their results
+     are NSNull.
+ @param count The number of times to execute the block.
+ @param outDeadlineExceeded On return, whether any indexes were skipped because the deadline passed. May not be NULL.
+ @param block The block to execute. May not be nil. If the block returns nil for an index, the corresponding element
+     of the result is NSNull.
+ @result An array containing the results of each execution of the block in index order.
+ */
+- (NSArray *)resultsOfExecutingCount:(NSUInteger)count
+                    deadlineExceeded:(BOOL *)outDeadlineExceeded
+                               block:(id (^)(TWTValidationContext *context, NSUInteger index))block;
+
+/*!
+ @abstract The maximum number of errors that validators collect from their subvalidators.
+ @discussion Collecting an error for every failure in a large value can take more memory than the value itself.
+     Validators that aggregate the results of other validators validate each subvalidator, element, or entry using
+     -validateValue:withSubvalidator:error:, which counts the errors they collect. Once this many have been
+     collected, subvalidators are no longer asked for errors, so they only determine whether values are valid.
+     Errors created after that point indicate that they are incomplete using TWTValidationErrorsTruncatedKey.
+     NSUIntegerMax, the default, means there is no limit.
+ */
+@property (nonatomic, assign) NSUInteger maximumErrorCount;
+
+/*!
+ @abstract The number of errors that validators have collected using the receiver.
+ @discussion The count is shared with copies of the receiver and accumulates across validations until it is reset
+     using -resetErrorCount.
+ */
+@property (nonatomic, assign, readonly) NSUInteger errorCount;
+
+/*!
+ @abstract Whether a subvalidator failed without being asked for an error because the maximum error count was reached.
+ @discussion This is reset by -resetErrorCount.
+ */
+@property (nonatomic, assign, readonly, getter = isErrorCollectionTruncated) BOOL errorCollectionTruncated;
+
+/*!
+ @abstract Resets the receiver’s error count and truncation state.
+ @discussion Contexts that are reused for several validations should be reset between them so that each validation
+     gets the full error budget.
+ */
+- (void)resetErrorCount;
+
+/*!
+ @abstract Validates a value using a subvalidator, counting any error collected against the maximum error count.
+ @discussion If the maximum error count has been reached, the subvalidator is not asked for an error, and if it
+     fails, the receiver’s error collection is marked as truncated.
+ @param value The value to validate.
+ @param validator The subvalidator to validate the value with.
+ @param outError A pointer to an error object to return indirectly. If NULL, no error is returned.
+ @result Whether the value is valid.
+ */
+- (BOOL)validateValue:(id)value withSubvalidator:(TWTValidator *)validator error:(out NSError *__autoreleasing *)outError;
+
+/*!
+ @abstract Returns the specified error, marked as truncated if the receiver’s error collection was truncated.
+ @param error The error. May be nil.
+ @result The error, marked as truncated if necessary.
+ */
+- (NSError *)errorByMarkingTruncationOfError:(NSError *)error;
+
+/*!
+ @abstract The frame for the part of the outermost value that is currently being validated.
+ @discussion NULL when the outermost value itself is being validated. Copies of the receiver start with the same
+     current frame.
+ */
+@property (nonatomic, assign, readonly) const TWTValidationPathFrame *currentPathFrame;
+
+/*!
+ @abstract Pushes a path frame onto the receiver’s path.
+ @discussion The frame’s parent is set to the receiver’s current frame, and the frame becomes the current frame.
+     The frame must remain valid until it is popped using -popPathFrame.
+ @param frame The frame to push. May not be NULL.
+ */
+- (void)pushPathFrame:(TWTValidationPathFrame *)frame;
+
+/*!
+ @abstract Pops the current path frame off the receiver’s path, making its parent the current frame.
+ */
+- (void)popPathFrame;
+
+/*!
+ @abstract Returns an RFC 6901 JSON pointer to the part of the outermost value that is currently being validated.
+ @result The current instance path. This is the empty string when the outermost value itself is being validated.
+ */
+- (NSString *)currentInstancePath;
+
+/*!
+ @abstract Returns an RFC 6901 JSON pointer to the schema that applies to the part of the outermost value that is
+     currently being validated.
+ @result The current schema path. This is the empty string when the outermost value itself is being validated.
+ */
+- (NSString *)currentSchemaPath;
+
+/*!
+ @abstract Returns a copy of the specified error with the receiver’s current instance and schema paths.
+ @discussion See -[NSError twt_errorByAddingInstancePath:schemaPath:] for more information. The paths are only
+     converted into strings if the error does not already have them.
+ @param error The error. May be nil.
+ @result A copy of the error with the receiver’s current paths. Returns the error itself if it is nil or already
+     has an instance path.
+ */
+- (NSError *)errorByAddingCurrentPathsToError:(NSError *)error;
+
+@end
+
+
+/*!
+ @abstract Returns whether validators using the specified context should run in fail-fast mode.
+ @param context The validation context. If nil, +[TWTValidator isFailFastModeEnabled] is returned.
+ @result Whether validators should run in fail-fast mode.
+ */
+static inline BOOL TWTValidationContextIsFailFastModeEnabled(TWTValidationContext *context)
+{
+    return context ? context.failFastModeEnabled : [TWTValidator isFailFastModeEnabled];
+}
+
+
+/*!
+ @abstract Returns the executor that validators using the specified context should use.
+ @param context The validation context. If it is nil or has no executor, +[TWTValidationExecutor serialExecutor] is
+     returned.
+ @result The executor that validators should use.
+ */
+static inline TWTValidationExecutor *TWTValidationContextExecutor(TWTValidationContext *context)
+{
+    return context.executor ?: [TWTValidationExecutor serialExecutor];
+}
+
+
+/*!
+ @abstract Returns a copy of the specified error with the specified context’s current instance and schema paths.
+ @param context The validation context. If nil, the error is returned unmodified.
+ @param error The error. May be nil.
+ @result The error with the context’s current paths.
+ */
+static inline NSError *TWTValidationContextErrorByAddingCurrentPaths(TWTValidationContext *context, NSError *error)
+{
+    return context ? [context errorByAddingCurrentPathsToError:error] : error;
+}
+
+
+/*!
+ @abstract Validates a value using a subvalidator and the specified context.
+ @discussion This is equivalent to -[TWTValidationContext validateValue:withSubvalidator:error:], except that if
+     context is nil, the subvalidator is simply asked to validate the value.
+ @param context The validation context. May be nil.
+ @param validator The subvalidator.
+ @param value The value to validate.
+ @param outError A pointer to an error object to return indirectly. If NULL, no error is returned.
+ @result Whether the value is valid.
+ */
+static inline BOOL TWTValidationContextValidateValue(TWTValidationContext *context, TWTValidator *validator, id value, NSError *__autoreleasing *outError)
+{
+    return context ? [context validateValue:value withSubvalidator:validator error:outError] : [validator validateValue:value context:nil error:outError];
+}
+
+
+/*!
+ @abstract Returns the specified error, marked as truncated if the specified context’s error collection was truncated.
+ @param context The validation context. If nil, the error is returned unmodified.
+ @param error The error. May be nil.
+ @result The error, marked as truncated if necessary.
+ */
+static inline NSError *TWTValidationContextErrorByMarkingTruncation(TWTValidationContext *context, NSError *error)
+{
+    return context ? [context errorByMarkingTruncationOfError:error] : error;
+}
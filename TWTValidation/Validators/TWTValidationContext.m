@@ -0,0 +1,285 @@
+//
+//  TWTValidationContext.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTValidationContext.h>
+
+#import <stdatomic.h>
+
+#import <TWTValidation/TWTValidationErrors.h>
+#import <TWTValidation/TWTValidationLocalization.h>
+
+
+/*!
+ The maximum number of chunks into which -resultsOfExecutingCount:deadlineExceeded:block: divides its work. Each chunk
+ copies the context once, so this bounds the number of copies regardless of how much work there is.
+ */
+static const NSUInteger TWTValidationContextMaximumChunkCount = 64;
+
+
+#pragma mark Functions
+
+/*!
+ @abstract Appends an RFC 6901 reference token for the specified key or index to a JSON pointer.
+ @discussion Keys are escaped by replacing “~” with “~0” and “/” with “~1”. Nothing is appended if key is nil and
+     index is NSNotFound.
+ */
+static void TWTJSONPointerAppendReferenceToken(NSMutableString *pointer, NSString *key, NSUInteger index)
+{
+    if (key) {
+        NSString *escapedKey = [[key stringByReplacingOccurrencesOfString:@"~" withString:@"~0"] stringByReplacingOccurrencesOfString:@"/" withString:@"~1"];
+        [pointer appendFormat:@"/%@", escapedKey];
+    } else if (index != NSNotFound) {
+        [pointer appendFormat:@"/%lu", (unsigned long)index];
+    }
+}
+
+
+/*!
+ @abstract Appends the instance or schema path components of the specified frame and its ancestors to a JSON pointer.
+ */
+static void TWTJSONPointerAppendPathFrame(NSMutableString *pointer, const TWTValidationPathFrame *frame, BOOL isSchemaPath)
+{
+    if (!frame) {
+        return;
+    }
+
+    TWTJSONPointerAppendPathFrame(pointer, frame->parent, isSchemaPath);
+    if (!isSchemaPath) {
+        TWTJSONPointerAppendReferenceToken(pointer, frame->instanceKey, frame->instanceIndex);
+    } else if (frame->schemaKeyword) {
+        TWTJSONPointerAppendReferenceToken(pointer, frame->schemaKeyword, NSNotFound);
+        TWTJSONPointerAppendReferenceToken(pointer, frame->schemaKey, frame->schemaIndex);
+    }
+}
+
+
+#pragma mark
+
+/*!
+ TWTValidationErrorBudgets count the errors collected using a validation context and its copies, which may be used
+ on different threads.
+ */
+@interface TWTValidationErrorBudget : NSObject {
+@public
+    atomic_size_t _errorCount;
+    atomic_bool _truncated;
+}
+
+@end
+
+
+@implementation TWTValidationErrorBudget
+
+@end
+
+
+#pragma mark
+
+@implementation TWTValidationContext {
+    TWTValidationErrorBudget *_errorBudget;
+    CFAbsoluteTime _deadlineTime;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _failFastModeEnabled = [TWTValidator isFailFastModeEnabled];
+        _deadlineTime = INFINITY;
+        _maximumErrorCount = NSUIntegerMax;
+        _errorBudget = [[TWTValidationErrorBudget alloc] init];
+    }
+    return self;
+}
+
+
+- (instancetype)copyWithZone:(NSZone *)zone
+{
+    // Copies share configuration and the error budget, but push their own path frames, since they may be used on
+    // other threads
+    TWTValidationContext *copy = [[[self class] allocWithZone:zone] init];
+    copy.executor = self.executor;
+    copy.failFastModeEnabled = self.failFastModeEnabled;
+    copy.deadline = self.deadline;
+    copy.maximumErrorCount = self.maximumErrorCount;
+    copy->_errorBudget = _errorBudget;
+    copy->_currentPathFrame = _currentPathFrame;
+    return copy;
+}
+
+
+- (void)setDeadline:(NSDate *)deadline
+{
+    _deadline = [deadline copy];
+    _deadlineTime = deadline ? deadline.timeIntervalSinceReferenceDate : INFINITY;
+}
+
+
+- (BOOL)isPastDeadline
+{
+    return _deadlineTime != INFINITY && CFAbsoluteTimeGetCurrent() >= _deadlineTime;
+}
+
+
+- (NSError *)deadlineExceededErrorWithFailingValidator:(TWTValidator *)validator value:(id)value
+{
+    return [NSError twt_validationErrorWithCode:TWTValidationErrorCodeDeadlineExceeded
+                               failingValidator:validator
+                                          value:value
+                      localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTValidationContext.deadlineExceeded.validationError"); }];
+}
+
+
+- (NSArray *)resultsOfExecutingCount:(NSUInteger)count
+                    deadlineExceeded:(BOOL *)outDeadlineExceeded
+                               block:(id (^)(TWTValidationContext *context, NSUInteger index))block
+{
+    NSParameterAssert(outDeadlineExceeded);
+    NSParameterAssert(block);
+
+    NSUInteger chunkLength = MAX((count + TWTValidationContextMaximumChunkCount - 1) / TWTValidationContextMaximumChunkCount, 1);
+    NSUInteger chunkCount = (count + chunkLength - 1) / chunkLength;
+
+    // Each index retains its result in its own slot so that chunks need not synchronize with one another
+    void **results = calloc(MAX(count, 1), sizeof(void *));
+    atomic_bool deadlineExceeded = ATOMIC_VAR_INIT(false);
+    atomic_bool *deadlineExceededPointer = &deadlineExceeded;
+
+    [TWTValidationContextExecutor(self) executeCount:chunkCount block:^(NSUInteger chunk) {
+        // Contexts may only be used on one thread at a time, so each chunk gets its own
+        TWTValidationContext *chunkContext = [self copy];
+        NSUInteger end = MIN((chunk + 1) * chunkLength, count);
+        for (NSUInteger index = chunk * chunkLength; index < end; ++index) {
+            if (atomic_load_explicit(deadlineExceededPointer, memory_order_relaxed)) {
+                break;
+            } else if ([chunkContext isPastDeadline]) {
+                atomic_store_explicit(deadlineExceededPointer, true, memory_order_relaxed);
+                break;
+            }
+
+            results[index] = (__bridge_retained void *)block(chunkContext, index);
+        }
+    }];
+
+    NSMutableArray *resultArray = [[NSMutableArray alloc] initWithCapacity:count];
+    for (NSUInteger i = 0; i < count; ++i) {
+        [resultArray addObject:results[i] ? (__bridge_transfer id)results[i] : [NSNull null]];
+    }
+
+    free(results);
+    *outDeadlineExceeded = atomic_load_explicit(&deadlineExceeded, memory_order_relaxed);
+    return resultArray;
+}
+
+
+#pragma mark - Error budget
+
+- (NSUInteger)errorCount
+{
+    return atomic_load_explicit(&_errorBudget->_errorCount, memory_order_relaxed);
+}
+
+
+- (BOOL)isErrorCollectionTruncated
+{
+    return atomic_load_explicit(&_errorBudget->_truncated, memory_order_relaxed);
+}
+
+
+- (void)resetErrorCount
+{
+    atomic_store_explicit(&_errorBudget->_errorCount, 0, memory_order_relaxed);
+    atomic_store_explicit(&_errorBudget->_truncated, false, memory_order_relaxed);
+}
+
+
+- (BOOL)validateValue:(id)value withSubvalidator:(TWTValidator *)validator error:(out NSError *__autoreleasing *)outError
+{
+    BOOL withholdsError = outError && self.errorCount >= _maximumErrorCount;
+    BOOL validated = [validator validateValue:value context:self error:withholdsError ? NULL : outError];
+    if (validated) {
+        return YES;
+    }
+
+    if (withholdsError) {
+        atomic_store_explicit(&_errorBudget->_truncated, true, memory_order_relaxed);
+    } else if (outError && *outError) {
+        atomic_fetch_add_explicit(&_errorBudget->_errorCount, 1, memory_order_relaxed);
+    }
+
+    return NO;
+}
+
+
+- (NSError *)errorByMarkingTruncationOfError:(NSError *)error
+{
+    return self.errorCollectionTruncated ? [error twt_errorByMarkingTruncated] : error;
+}
+
+
+#pragma mark - Paths
+
+- (void)pushPathFrame:(TWTValidationPathFrame *)frame
+{
+    NSParameterAssert(frame);
+    frame->parent = _currentPathFrame;
+    _currentPathFrame = frame;
+}
+
+
+- (void)popPathFrame
+{
+    NSAssert(_currentPathFrame, @"no path frame to pop");
+    _currentPathFrame = _currentPathFrame->parent;
+}
+
+
+- (NSString *)currentInstancePath
+{
+    NSMutableString *path = [[NSMutableString alloc] init];
+    TWTJSONPointerAppendPathFrame(path, _currentPathFrame, NO);
+    return [path copy];
+}
+
+
+- (NSString *)currentSchemaPath
+{
+    NSMutableString *path = [[NSMutableString alloc] init];
+    TWTJSONPointerAppendPathFrame(path, _currentPathFrame, YES);
+    return [path copy];
+}
+
+
+- (NSError *)errorByAddingCurrentPathsToError:(NSError *)error
+{
+    if (!error || error.twt_instancePath) {
+        return error;
+    }
+
+    return [error twt_errorByAddingInstancePath:[self currentInstancePath] schemaPath:[self currentSchemaPath]];
+}
+
+@end
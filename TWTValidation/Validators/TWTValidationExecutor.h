@@ -0,0 +1,129 @@
+//
+//  TWTValidationExecutor.h
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+@import Foundation;
+
+/*!
+ TWTValidationExecutors execute the independent pieces of work that make up a validation. Validators that aggregate
+ the results of other validators—e.g., compound, collection, and keyed collection validators—use the executor of
+ their validation context to validate their subvalidators, elements, or entries. Validators without a context or
+ whose context has no executor execute their work serially on the calling thread.
+
+ The base TWTValidationExecutor class executes work serially on the calling thread. TWTWorkStealingValidationExecutor
+ distributes work among a pool of threads.
+
+ Executors only execute work concurrently when there is enough of it to be worth the overhead. Validators ask their
+ executor whether to do so using -shouldExecuteConcurrentlyWithCount: and otherwise validate on the calling thread
+ exactly as they would without an executor. Validators never execute work concurrently in fail-fast mode, because the
+ point at which validation stops depends on the order in which work is performed.
+ */
+@interface TWTValidationExecutor : NSObject
+
+/*!
+ @abstract Returns a shared executor that executes work serially on the calling thread.
+ @discussion Validators use this executor when their validation context does not have one.
+ @result The shared serial executor.
+ */
++ (TWTValidationExecutor *)serialExecutor;
+
+/*!
+ @abstract Returns whether the receiver would execute the specified number of pieces of work concurrently.
+ @discussion Validators use this to avoid the overhead of preparing for concurrent execution when it would not occur.
+     The base implementation always returns NO.
+ @param count The number of pieces of work.
+ @result Whether the receiver would execute count pieces of work concurrently.
+ */
+- (BOOL)shouldExecuteConcurrentlyWithCount:(NSUInteger)count;
+
+/*!
+ @abstract Executes the specified block once for each index from 0 to count - 1 and returns when all executions
+     have completed.
+ @discussion The block may be executed in any order and on any thread, so it should not depend on the results of
+     other executions. The base implementation executes the block serially on the calling thread.
+ @param count The number of times to execute the block.
+ @param block The block to execute. May not be nil.
+ */
+- (void)executeCount:(NSUInteger)count block:(void (^)(NSUInteger index))block;
+
+/*!
+ @abstract Executes the specified block once for each index from 0 to count - 1 and returns the results in index
+     order.
+ @discussion This is a convenience for validators that need to combine the results of their work in a
+     deterministic order regardless of how it was executed.
+ @param count The number of times to execute the block.
+ @param block The block to execute. May not be nil. If the block returns nil for an index, the corresponding
+     element of the result is NSNull.
+ @result An array containing the results of each execution of the block in index order.
+ */
+- (NSArray *)resultsOfExecutingCount:(NSUInteger)count block:(id (^)(NSUInteger index))block;
+
+@end
+
+
+/*!
+ TWTWorkStealingValidationExecutors execute work concurrently on a fixed pool of worker threads. Each worker has
+ its own queue of work, and workers that run out of work steal work from the others. Threads that are waiting for
+ their work to complete—including workers that start nested work, e.g., a collection validator inside a compound
+ validator—help execute queued work instead of blocking, so nested validators cannot starve the pool.
+
+ Work whose count is below the executor's concurrency threshold is executed serially on the calling thread.
+ */
+@interface TWTWorkStealingValidationExecutor : TWTValidationExecutor
+
+/*!
+ @abstract The number of worker threads in the receiver's pool.
+ */
+@property (nonatomic, assign, readonly) NSUInteger workerCount;
+
+/*!
+ @abstract The minimum number of pieces of work that the receiver executes concurrently.
+ @discussion Work with fewer pieces is executed serially on the calling thread. The default is 32.
+ */
+@property (nonatomic, assign) NSUInteger concurrencyThreshold;
+
+/*!
+ @abstract Initializes a newly allocated work-stealing executor with one worker for each active processor.
+ @result An initialized work-stealing executor.
+ */
+- (instancetype)init;
+
+/*!
+ @abstract Initializes a newly allocated work-stealing executor with the specified number of workers.
+ @discussion This is the class’s designated initializer.
+ @param workerCount The number of worker threads in the executor's pool. If 0, one worker is created for each
+     active processor.
+ @result An initialized work-stealing executor.
+ */
+- (instancetype)initWithWorkerCount:(NSUInteger)workerCount;
+
+/*!
+ @abstract Stops the receiver's worker threads.
+ @discussion Executors stop their worker threads when they are deallocated, so this is only necessary to stop them
+     sooner. Work submitted after invalidation is executed serially on the calling thread.
+ */
+- (void)invalidate;
+
+@end
@@ -0,0 +1,483 @@
+//
+//  TWTValidationExecutor.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTValidationExecutor.h>
+
+#import <pthread.h>
+#import <stdatomic.h>
+
+
+/*!
+ The default concurrency threshold for work-stealing executors.
+ */
+static const NSUInteger TWTWorkStealingValidationExecutorDefaultConcurrencyThreshold = 32;
+
+/*!
+ The number of tasks per worker that work-stealing executors divide work into. Having more tasks than workers gives
+ idle workers something to steal when some pieces of work take longer than others.
+ */
+static const NSUInteger TWTWorkStealingValidationExecutorTasksPerWorker = 4;
+
+/*!
+ TWTValidationExecutorTaskGroups track the tasks created by a single invocation of -executeCount:block:. Task
+ groups live on the stack of the invoking thread, which does not return until all of the group’s tasks have
+ completed.
+ */
+typedef struct TWTValidationExecutorTaskGroup {
+    __unsafe_unretained void (^block)(NSUInteger index);
+    atomic_size_t pendingTaskCount;
+} TWTValidationExecutorTaskGroup;
+
+
+/*!
+ TWTValidationExecutorTasks represent a contiguous range of indexes for which a task group’s block is executed.
+ */
+typedef struct TWTValidationExecutorTask {
+    TWTValidationExecutorTaskGroup *group;
+    NSRange range;
+} TWTValidationExecutorTask;
+
+
+/*!
+ TWTValidationExecutorTaskQueues are double-ended queues of tasks. A queue’s worker pushes and pops tasks at the
+ back of the queue, while other threads steal tasks from the front. Every queue in a pool shares a count of the
+ tasks queued in the pool, which is only changed while a queue’s mutex is held. A nonzero count thus always means
+ that a task can be dequeued, so idle workers never spin waiting for a task that hasn’t been pushed yet.
+ */
+typedef struct TWTValidationExecutorTaskQueue {
+    pthread_mutex_t mutex;
+    TWTValidationExecutorTask *tasks;
+    NSUInteger capacity;
+    NSUInteger front;
+    NSUInteger count;
+    atomic_size_t *queuedTaskCount;
+} TWTValidationExecutorTaskQueue;
+
+
+static void TWTValidationExecutorTaskQueueInitialize(TWTValidationExecutorTaskQueue *queue, atomic_size_t *queuedTaskCount)
+{
+    pthread_mutex_init(&queue->mutex, NULL);
+    queue->capacity = 16;
+    queue->tasks = malloc(queue->capacity * sizeof(TWTValidationExecutorTask));
+    queue->front = 0;
+    queue->count = 0;
+    queue->queuedTaskCount = queuedTaskCount;
+}
+
+
+static void TWTValidationExecutorTaskQueueDestroy(TWTValidationExecutorTaskQueue *queue)
+{
+    pthread_mutex_destroy(&queue->mutex);
+    free(queue->tasks);
+}
+
+
+static void TWTValidationExecutorTaskQueuePushBack(TWTValidationExecutorTaskQueue *queue, TWTValidationExecutorTask task)
+{
+    pthread_mutex_lock(&queue->mutex);
+    if (queue->count == queue->capacity) {
+        // Grow the ring buffer, moving its contents so that the front of the queue is at index 0
+        NSUInteger newCapacity = queue->capacity * 2;
+        TWTValidationExecutorTask *newTasks = malloc(newCapacity * sizeof(TWTValidationExecutorTask));
+        for (NSUInteger i = 0; i < queue->count; ++i) {
+            newTasks[i] = queue->tasks[(queue->front + i) % queue->capacity];
+        }
+
+        free(queue->tasks);
+        queue->tasks = newTasks;
+        queue->capacity = newCapacity;
+        queue->front = 0;
+    }
+
+    queue->tasks[(queue->front + queue->count) % queue->capacity] = task;
+    ++queue->count;
+    atomic_fetch_add(queue->queuedTaskCount, 1);
+    pthread_mutex_unlock(&queue->mutex);
+}
+
+
+static BOOL TWTValidationExecutorTaskQueuePopBack(TWTValidationExecutorTaskQueue *queue, TWTValidationExecutorTask *outTask)
+{
+    BOOL popped = NO;
+    pthread_mutex_lock(&queue->mutex);
+    if (queue->count > 0) {
+        --queue->count;
+        *outTask = queue->tasks[(queue->front + queue->count) % queue->capacity];
+        atomic_fetch_sub(queue->queuedTaskCount, 1);
+        popped = YES;
+    }
+    pthread_mutex_unlock(&queue->mutex);
+    return popped;
+}
+
+
+static BOOL TWTValidationExecutorTaskQueuePopFront(TWTValidationExecutorTaskQueue *queue, TWTValidationExecutorTask *outTask)
+{
+    BOOL popped = NO;
+    pthread_mutex_lock(&queue->mutex);
+    if (queue->count > 0) {
+        *outTask = queue->tasks[queue->front];
+        queue->front = (queue->front + 1) % queue->capacity;
+        --queue->count;
+        atomic_fetch_sub(queue->queuedTaskCount, 1);
+        popped = YES;
+    }
+    pthread_mutex_unlock(&queue->mutex);
+    return popped;
+}
+
+
+#pragma mark
+
+@implementation TWTValidationExecutor
+
++ (TWTValidationExecutor *)serialExecutor
+{
+    static TWTValidationExecutor *serialExecutor = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        serialExecutor = [[TWTValidationExecutor alloc] init];
+    });
+
+    return serialExecutor;
+}
+
+
+- (BOOL)shouldExecuteConcurrentlyWithCount:(NSUInteger)count
+{
+    return NO;
+}
+
+
+- (void)executeCount:(NSUInteger)count block:(void (^)(NSUInteger index))block
+{
+    NSParameterAssert(block);
+    for (NSUInteger i = 0; i < count; ++i) {
+        block(i);
+    }
+}
+
+
+- (NSArray *)resultsOfExecutingCount:(NSUInteger)count block:(id (^)(NSUInteger index))block
+{
+    NSParameterAssert(block);
+
+    // Each execution retains its result in its own slot so that executions need not synchronize with one another
+    void **results = calloc(MAX(count, 1), sizeof(void *));
+    [self executeCount:count block:^(NSUInteger index) {
+        results[index] = (__bridge_retained void *)(block(index) ?: [NSNull null]);
+    }];
+
+    NSMutableArray *resultArray = [[NSMutableArray alloc] initWithCapacity:count];
+    for (NSUInteger i = 0; i < count; ++i) {
+        [resultArray addObject:(__bridge_transfer id)results[i]];
+    }
+
+    free(results);
+    return resultArray;
+}
+
+@end
+
+
+#pragma mark
+
+/*!
+ TWTValidationExecutorWorkerPools hold the worker threads and task queues of a work-stealing executor. Worker threads
+ retain their pool rather than the executor, so executors are deallocated as soon as their clients release them,
+ at which point they invalidate their pool. The pool is deallocated once its last worker exits.
+ */
+@interface TWTValidationExecutorWorkerPool : NSObject {
+    TWTValidationExecutorTaskQueue *_queues;
+    pthread_key_t _workerIndexKey;
+    pthread_mutex_t _mutex;
+    pthread_cond_t _condition;
+    atomic_size_t _queuedTaskCount;
+    atomic_size_t _nextQueueIndex;
+    atomic_bool _invalidated;
+}
+
+@property (nonatomic, assign, readonly) NSUInteger workerCount;
+
+- (instancetype)initWithWorkerCount:(NSUInteger)workerCount;
+
+- (BOOL)isInvalidated;
+- (void)invalidate;
+
+/*!
+ @abstract Executes the specified block once for each index from 0 to count - 1 on the pool’s workers and returns
+     when all executions have completed.
+ @discussion The calling thread helps execute queued tasks while it waits.
+ @param count The number of times to execute the block. Must be at least 1.
+ @param block The block to execute. May not be nil.
+ */
+- (void)executeCount:(NSUInteger)count block:(void (^)(NSUInteger index))block;
+
+@end
+
+
+@implementation TWTValidationExecutorWorkerPool
+
+- (instancetype)init
+{
+    return [self initWithWorkerCount:1];
+}
+
+
+- (instancetype)initWithWorkerCount:(NSUInteger)workerCount
+{
+    self = [super init];
+    if (self) {
+        _workerCount = workerCount;
+
+        atomic_init(&_queuedTaskCount, 0);
+        atomic_init(&_nextQueueIndex, 0);
+        atomic_init(&_invalidated, false);
+
+        _queues = calloc(_workerCount, sizeof(TWTValidationExecutorTaskQueue));
+        for (NSUInteger i = 0; i < _workerCount; ++i) {
+            TWTValidationExecutorTaskQueueInitialize(&_queues[i], &_queuedTaskCount);
+        }
+
+        pthread_key_create(&_workerIndexKey, NULL);
+        pthread_mutex_init(&_mutex, NULL);
+        pthread_cond_init(&_condition, NULL);
+
+        for (NSUInteger i = 0; i < _workerCount; ++i) {
+            NSThread *thread = [[NSThread alloc] initWithTarget:self selector:@selector(runWorkerWithIndex:) object:@(i)];
+            thread.name = [NSString stringWithFormat:@"com.ticketmaster.TWTValidation.executor.worker-%lu", (unsigned long)i];
+            [thread start];
+        }
+    }
+
+    return self;
+}
+
+
+- (void)dealloc
+{
+    for (NSUInteger i = 0; i < _workerCount; ++i) {
+        TWTValidationExecutorTaskQueueDestroy(&_queues[i]);
+    }
+
+    free(_queues);
+    pthread_key_delete(_workerIndexKey);
+    pthread_mutex_destroy(&_mutex);
+    pthread_cond_destroy(&_condition);
+}
+
+
+- (BOOL)isInvalidated
+{
+    return atomic_load(&_invalidated);
+}
+
+
+- (void)invalidate
+{
+    atomic_store(&_invalidated, true);
+    [self broadcast];
+}
+
+
+- (void)executeCount:(NSUInteger)count block:(void (^)(NSUInteger index))block
+{
+    NSUInteger taskCount = MIN(count, self.workerCount * TWTWorkStealingValidationExecutorTasksPerWorker);
+
+    TWTValidationExecutorTaskGroup group;
+    group.block = block;
+    atomic_init(&group.pendingTaskCount, taskCount);
+
+    // Workers push nested work onto their own queues, where they will find it first. Other threads spread their work
+    // across all the queues
+    NSUInteger workerIndex = [self currentWorkerIndex];
+    for (NSUInteger i = 0; i < taskCount; ++i) {
+        NSUInteger location = count * i / taskCount;
+        NSUInteger length = count * (i + 1) / taskCount - location;
+        TWTValidationExecutorTask task = { &group, NSMakeRange(location, length) };
+
+        NSUInteger queueIndex = workerIndex != NSNotFound ? workerIndex : atomic_fetch_add(&_nextQueueIndex, 1) % self.workerCount;
+        TWTValidationExecutorTaskQueuePushBack(&_queues[queueIndex], task);
+    }
+
+    [self broadcast];
+
+    // Rather than blocking while our tasks are pending, help execute queued tasks. This keeps workers that start
+    // nested work from deadlocking the pool
+    while (atomic_load(&group.pendingTaskCount) > 0) {
+        TWTValidationExecutorTask task;
+        if ([self dequeueTask:&task forWorkerWithIndex:workerIndex]) {
+            [self runTask:task];
+            continue;
+        }
+
+        pthread_mutex_lock(&_mutex);
+        while (atomic_load(&group.pendingTaskCount) > 0 && atomic_load(&_queuedTaskCount) == 0) {
+            pthread_cond_wait(&_condition, &_mutex);
+        }
+        pthread_mutex_unlock(&_mutex);
+    }
+}
+
+
+#pragma mark - Workers
+
+- (NSUInteger)currentWorkerIndex
+{
+    uintptr_t value = (uintptr_t)pthread_getspecific(_workerIndexKey);
+    return value > 0 ? value - 1 : NSNotFound;
+}
+
+
+- (void)runWorkerWithIndex:(NSNumber *)index
+{
+    NSUInteger workerIndex = index.unsignedIntegerValue;
+    pthread_setspecific(_workerIndexKey, (void *)(uintptr_t)(workerIndex + 1));
+
+    while (!atomic_load(&_invalidated)) {
+        TWTValidationExecutorTask task;
+        if ([self dequeueTask:&task forWorkerWithIndex:workerIndex]) {
+            [self runTask:task];
+            continue;
+        }
+
+        pthread_mutex_lock(&_mutex);
+        while (atomic_load(&_queuedTaskCount) == 0 && !atomic_load(&_invalidated)) {
+            pthread_cond_wait(&_condition, &_mutex);
+        }
+        pthread_mutex_unlock(&_mutex);
+    }
+}
+
+
+- (BOOL)dequeueTask:(TWTValidationExecutorTask *)outTask forWorkerWithIndex:(NSUInteger)workerIndex
+{
+    // Workers take the most recently pushed task from their own queue first, as it is the most likely to be related
+    // to what they were just doing
+    BOOL dequeued = workerIndex != NSNotFound && TWTValidationExecutorTaskQueuePopBack(&_queues[workerIndex], outTask);
+
+    // Otherwise, steal the oldest task from another queue
+    NSUInteger startIndex = workerIndex != NSNotFound ? workerIndex + 1 : 0;
+    for (NSUInteger i = 0; !dequeued && i < self.workerCount; ++i) {
+        NSUInteger queueIndex = (startIndex + i) % self.workerCount;
+        dequeued = queueIndex != workerIndex && TWTValidationExecutorTaskQueuePopFront(&_queues[queueIndex], outTask);
+    }
+
+    return dequeued;
+}
+
+
+- (void)runTask:(TWTValidationExecutorTask)task
+{
+    @autoreleasepool {
+        for (NSUInteger i = task.range.location; i < NSMaxRange(task.range); ++i) {
+            task.group->block(i);
+        }
+    }
+
+    // Wake the thread waiting for the group if this was its last task. The group may be deallocated as soon as its
+    // pending task count reaches 0, so it must not be accessed after that
+    if (atomic_fetch_sub(&task.group->pendingTaskCount, 1) == 1) {
+        [self broadcast];
+    }
+}
+
+
+- (void)broadcast
+{
+    pthread_mutex_lock(&_mutex);
+    pthread_cond_broadcast(&_condition);
+    pthread_mutex_unlock(&_mutex);
+}
+
+@end
+
+
+#pragma mark
+
+@interface TWTWorkStealingValidationExecutor ()
+
+@property (nonatomic, strong, readonly) TWTValidationExecutorWorkerPool *workerPool;
+
+@end
+
+
+@implementation TWTWorkStealingValidationExecutor
+
+- (instancetype)init
+{
+    return [self initWithWorkerCount:0];
+}
+
+
+- (instancetype)initWithWorkerCount:(NSUInteger)workerCount
+{
+    self = [super init];
+    if (self) {
+        _concurrencyThreshold = TWTWorkStealingValidationExecutorDefaultConcurrencyThreshold;
+        _workerPool = [[TWTValidationExecutorWorkerPool alloc] initWithWorkerCount:(workerCount > 0 ? workerCount : MAX([[NSProcessInfo processInfo] activeProcessorCount], 1))];
+    }
+
+    return self;
+}
+
+
+- (void)dealloc
+{
+    [_workerPool invalidate];
+}
+
+
+- (NSUInteger)workerCount
+{
+    return self.workerPool.workerCount;
+}
+
+
+- (void)invalidate
+{
+    [self.workerPool invalidate];
+}
+
+
+- (BOOL)shouldExecuteConcurrentlyWithCount:(NSUInteger)count
+{
+    return count > 1 && count >= self.concurrencyThreshold && ![self.workerPool isInvalidated];
+}
+
+
+- (void)executeCount:(NSUInteger)count block:(void (^)(NSUInteger index))block
+{
+    NSParameterAssert(block);
+    if (![self shouldExecuteConcurrentlyWithCount:count]) {
+        [super executeCount:count block:block];
+        return;
+    }
+
+    [self.workerPool executeCount:count block:block];
+}
+
+@end
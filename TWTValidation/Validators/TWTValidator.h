@@ -26,6 +26,10 @@
 
 @import Foundation;
 
+
+@class TWTValidationContext;
+
+
 /*!
  TWTValidator is the base class for all validators in the TWTValidation framework. TWTValidator should almost
  never be used directly, as it provides little useful validation functionality. It mostly exists to define an
@@ -33,6 +37,29 @@
  */
 @interface TWTValidator : NSObject <NSCopying>
 
+/*!
+ @abstract Returns whether validators stop validating a value as soon as its validation result is known.
+ @discussion By default, validators that aggregate the results of other validators—e.g., compound, collection,
+     and key-value coding validators—run all of their subvalidators so that they can return a complete error
+     describing every validation failure. When fail-fast mode is enabled, these validators instead return as soon
+     as the result of validation is decided. An And validator, for example, returns after its first subvalidator
+     fails. This makes validating invalid values considerably cheaper, but errors returned in fail-fast mode only
+     describe the failures that were encountered before validation stopped.
+
+     This setting affects all validators in the process and may be changed from any thread. It is disabled by
+     default. To enable fail-fast mode for a single validation without affecting others, use a TWTValidationContext
+     whose failFastModeEnabled property is set instead; contexts use this setting only as their initial value.
+ @result Whether fail-fast mode is enabled.
+ */
++ (BOOL)isFailFastModeEnabled;
+
+/*!
+ @abstract Sets whether validators stop validating a value as soon as its validation result is known.
+ @discussion See +isFailFastModeEnabled for more information.
+ @param enabled Whether fail-fast mode should be enabled.
+ */
++ (void)setFailFastModeEnabled:(BOOL)enabled;
+
 /*!
  @abstract Returns a copy of the receiver.
  @discussion Because base TWTValidator objects are immutable, this simply returns the receiver. Subclass
@@ -65,4 +92,32 @@
  */
 - (BOOL)validateValue:(id)value error:(out NSError *__autoreleasing *)outError;
 
+/*!
+ @abstract Returns whether the specified value is valid using the specified validation context.
+ @discussion The context describes how validation should be performed and tracks which part of the value is being
+     validated; see TWTValidationContext.h for more information. The base implementation ignores
+     the context and invokes -validateValue:error:. Validators that aggregate the results of other validators
+     override this method to honor the context and pass it to the validators they invoke, and implement
+     -validateValue:error: by invoking this method with a nil context.
+ @param value The value to validate.
+ @param context The validation context. If nil, the process-wide defaults are used.
+ @param outError A pointer to an error object to return indirectly. If NULL, no error should be returned.
+ @result Whether the specified value is valid.
+ */
+- (BOOL)validateValue:(id)value context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError;
+
+/*!
+ @abstract Returns whether all the values in the specified array are valid.
+ @discussion This is a more efficient alternative to validating many values with -validateValue:error: when
+     the details of validation failures aren’t needed. The base implementation simply invokes
+     -validateValue:error: with a NULL error for each value in the array. Subclasses may override this method
+     to perform per-validation setup only once for the entire array, but the results of their implementations
+     must be equivalent to the base implementation’s.
+ @param values The values to validate. May not be nil.
+ @param outInvalidIndexes On return, contains the indexes of the values that are invalid. If NULL, no
+     indexes are returned. Note that all values are validated even if this is NULL.
+ @result Whether all the values are valid.
+ */
+- (BOOL)validateValues:(NSArray *)values results:(out NSIndexSet *__autoreleasing *)outInvalidIndexes;
+
 @end
@@ -26,12 +26,31 @@
 
 #import <TWTValidation/TWTValidator.h>
 
+#import <stdatomic.h>
+
 #import <TWTValidation/TWTValidationErrors.h>
 #import <TWTValidation/TWTValidationLocalization.h>
 
 
+// Validators on any thread may read this while it is being set, so it is atomic. It is an independent flag, so no
+// ordering is needed
+static atomic_bool TWTValidatorFailFastModeEnabled = ATOMIC_VAR_INIT(false);
+
+
 @implementation TWTValidator
 
++ (BOOL)isFailFastModeEnabled
+{
+    return atomic_load_explicit(&TWTValidatorFailFastModeEnabled, memory_order_relaxed);
+}
+
+
++ (void)setFailFastModeEnabled:(BOOL)enabled
+{
+    atomic_store_explicit(&TWTValidatorFailFastModeEnabled, enabled, memory_order_relaxed);
+}
+
+
 - (instancetype)copyWithZone:(NSZone *)zone
 {
     return self;
@@ -58,7 +77,7 @@
             *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueNil
                                             failingValidator:self
                                                        value:value
-                                        localizedDescription:TWTLocalizedString(@"TWTValidator.valueNil.validationError")];
+                                   localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTValidator.valueNil.validationError"); }];
         }
 
         return NO;
@@ -67,7 +86,7 @@
             *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueNull
                                             failingValidator:self
                                                        value:value
-                                        localizedDescription:TWTLocalizedString(@"TWTValidator.valueNull.validationError")];
+                                   localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTValidator.valueNull.validationError"); }];
         }
 
         return NO;
@@ -76,4 +95,32 @@
     return YES;
 }
 
+
+- (BOOL)validateValue:(id)value context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
+    return [self validateValue:value error:outError];
+}
+
+
+- (BOOL)validateValues:(NSArray *)values results:(out NSIndexSet *__autoreleasing *)outInvalidIndexes
+{
+    NSParameterAssert(values);
+
+    NSMutableIndexSet *invalidIndexes = [[NSMutableIndexSet alloc] init];
+    NSUInteger index = 0;
+    for (id value in values) {
+        if (![self validateValue:value error:NULL]) {
+            [invalidIndexes addIndex:index];
+        }
+
+        ++index;
+    }
+
+    if (outInvalidIndexes) {
+        *outInvalidIndexes = [invalidIndexes copy];
+    }
+
+    return invalidIndexes.count == 0;
+}
+
 @end
@@ -82,22 +82,54 @@
     }
 
     if (outError) {
-        NSInteger code = 0;
-        NSString *description = nil;
-
         if (!value) {
-            code = TWTValidationErrorCodeValueNil;
-            description = TWTLocalizedString(@"TWTValidator.valueNil.validationError");
+            *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueNil
+                                            failingValidator:self
+                                                       value:value
+                                   localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTValidator.valueNil.validationError"); }];
         } else {
-            code = TWTValidationErrorCodeValueNotInSet;
-            NSString *descriptionFormat = TWTLocalizedString(@"TWTValueSetValidator.valueNotInSet.validationError.format");
-            description = [NSString stringWithFormat:descriptionFormat, value, self.validValues];
+            // Formatting the entire set of valid values is expensive, so it’s only done if the description is needed
+            NSSet *validValues = self.validValues;
+            *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueNotInSet
+                                            failingValidator:self
+                                                       value:value
+                                   localizedDescriptionBlock:^{
+                                       NSString *descriptionFormat = TWTLocalizedString(@"TWTValueSetValidator.valueNotInSet.validationError.format");
+                                       return [NSString stringWithFormat:descriptionFormat, value, validValues];
+                                   }];
         }
-
-        *outError = [NSError twt_validationErrorWithCode:code failingValidator:self value:value localizedDescription:description];
     }
 
     return NO;
 }
 
+
+- (BOOL)validateValues:(NSArray *)values results:(out NSIndexSet *__autoreleasing *)outInvalidIndexes
+{
+    // Subclasses that override -validateValue:error: may perform additional checks that we don’t know about
+    if ([self methodForSelector:@selector(validateValue:error:)] != [TWTValueSetValidator instanceMethodForSelector:@selector(validateValue:error:)]) {
+        return [super validateValues:values results:outInvalidIndexes];
+    }
+
+    NSParameterAssert(values);
+
+    // Arrays can’t contain nil, so the only check is set membership
+    NSSet *validValues = self.validValues;
+    NSMutableIndexSet *invalidIndexes = [[NSMutableIndexSet alloc] init];
+    NSUInteger index = 0;
+    for (id value in values) {
+        if (![validValues containsObject:value]) {
+            [invalidIndexes addIndex:index];
+        }
+
+        ++index;
+    }
+
+    if (outInvalidIndexes) {
+        *outInvalidIndexes = [invalidIndexes copy];
+    }
+
+    return invalidIndexes.count == 0;
+}
+
 @end
@@ -76,4 +76,47 @@
  */
 - (instancetype)initWithMinimum:(NSNumber *)minimum maximum:(NSNumber *)maximum;
 
+/*!
+ @abstract Validates the specified integer without boxing it.
+ @discussion This is equivalent to validating the integer boxed in an NSNumber, but avoids allocating a
+     number unless the integer is invalid. The validator’s bounds are unboxed when they are set, so
+     comparing an integer against them does not require any floating-point conversion.
+ @param integer The integer being validated.
+ @param outError A pointer to an error object to return indirectly if the integer is invalid. May be NULL.
+ @result Whether the integer is valid.
+ */
+- (BOOL)validateInteger:(long long)integer error:(out NSError *__autoreleasing *)outError;
+
+/*!
+ @abstract Validates the specified double without boxing it.
+ @discussion This is equivalent to validating the double boxed in an NSNumber, but avoids allocating a
+     number unless the double is invalid.
+ @param doubleValue The double being validated.
+ @param outError A pointer to an error object to return indirectly if the double is invalid. May be NULL.
+ @result Whether the double is valid.
+ */
+- (BOOL)validateDouble:(double)doubleValue error:(out NSError *__autoreleasing *)outError;
+
 @end
+
+
+/*!
+ @abstract Validates a count using the specified validator.
+ @discussion This function is provided as a convenience for validators that validate counts. If the
+     validator is a TWTNumberValidator, the count is validated without being boxed. Otherwise, it is boxed
+     in an NSNumber and validated using -validateValue:error:.
+ @param validator The validator. May be nil, in which case the count is valid.
+ @param count The count being validated.
+ @param outError A pointer to an error object to return indirectly if the count is invalid. May be NULL.
+ @result Whether the count is valid.
+ */
+static inline BOOL TWTValidatorValidateCount(TWTValidator *validator, NSUInteger count, NSError *__autoreleasing *outError)
+{
+    if (!validator) {
+        return YES;
+    } else if ([validator isKindOfClass:[TWTNumberValidator class]]) {
+        return [(TWTNumberValidator *)validator validateInteger:(long long)count error:outError];
+    }
+
+    return [validator validateValue:@(count) error:outError];
+}
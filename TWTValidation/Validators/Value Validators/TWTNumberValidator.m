@@ -30,15 +30,164 @@
 #import <TWTValidation/TWTValidationLocalization.h>
 
 
+/*!
+ The kinds of scalars that number validators compare. Comparisons between integer and double scalars
+ are exact; inexact scalars can only be compared using -[NSNumber compare:].
+ */
+typedef NS_ENUM(uint8_t, TWTNumberValidatorScalarKind) {
+    TWTNumberValidatorScalarKindNone,
+    TWTNumberValidatorScalarKindInteger,
+    TWTNumberValidatorScalarKindDouble,
+    TWTNumberValidatorScalarKindInexact
+};
+
+
+/*!
+ TWTNumberValidatorScalars are unboxed numbers. Integral values that fit in a long long are always
+ represented as integers, so double scalars are either non-integral or outside the range of a long long.
+ */
+typedef struct _TWTNumberValidatorScalar {
+    TWTNumberValidatorScalarKind kind;
+    long long integerValue;
+    double doubleValue;
+} TWTNumberValidatorScalar;
+
+
+/*!
+ The smallest power of two that is too large to be represented by a long long.
+ */
+static const double TWTNumberValidatorLongLongLimit = 9223372036854775808.0;
+
+
+static inline TWTNumberValidatorScalar TWTNumberValidatorScalarMakeInteger(long long integerValue)
+{
+    return (TWTNumberValidatorScalar){ TWTNumberValidatorScalarKindInteger, integerValue, 0.0 };
+}
+
+
+static inline TWTNumberValidatorScalar TWTNumberValidatorScalarMakeDouble(double doubleValue)
+{
+    if (doubleValue != doubleValue) {
+        // NaN doesn’t have an order, so leave it to -compare:
+        return (TWTNumberValidatorScalar){ TWTNumberValidatorScalarKindInexact, 0, doubleValue };
+    } else if (trunc(doubleValue) == doubleValue && doubleValue >= -TWTNumberValidatorLongLongLimit && doubleValue < TWTNumberValidatorLongLongLimit) {
+        return TWTNumberValidatorScalarMakeInteger((long long)doubleValue);
+    }
+
+    return (TWTNumberValidatorScalar){ TWTNumberValidatorScalarKindDouble, 0, doubleValue };
+}
+
+
+/*!
+ @abstract Returns a scalar for the specified number.
+ @discussion Numbers that hold integers are unboxed without any floating-point conversion. Decimal numbers,
+     unsigned integers larger than LLONG_MAX, and NaN are inexact.
+ @param number The number. May be nil.
+ @result The number’s scalar. If number is nil, the scalar’s kind is TWTNumberValidatorScalarKindNone.
+ */
+static TWTNumberValidatorScalar TWTNumberValidatorScalarForNumber(NSNumber *number)
+{
+    if (!number) {
+        return (TWTNumberValidatorScalar){ TWTNumberValidatorScalarKindNone, 0, 0.0 };
+    }
+
+    switch (*number.objCType) {
+        case 'c':
+        case 's':
+        case 'i':
+        case 'l':
+        case 'q':
+        case 'B':
+            return TWTNumberValidatorScalarMakeInteger(number.longLongValue);
+        case 'C':
+        case 'S':
+        case 'I':
+        case 'L':
+        case 'Q': {
+            unsigned long long unsignedLongLongValue = number.unsignedLongLongValue;
+            if (unsignedLongLongValue <= LLONG_MAX) {
+                return TWTNumberValidatorScalarMakeInteger((long long)unsignedLongLongValue);
+            }
+
+            break;
+        }
+        case 'f':
+        case 'd':
+            if (![number isKindOfClass:[NSDecimalNumber class]]) {
+                return TWTNumberValidatorScalarMakeDouble(number.doubleValue);
+            }
+
+            break;
+    }
+
+    return (TWTNumberValidatorScalar){ TWTNumberValidatorScalarKindInexact, 0, number.doubleValue };
+}
+
+
+/*!
+ @abstract Compares two scalars, neither of which may be inexact or none.
+ @param scalar1 The first scalar.
+ @param scalar2 The second scalar.
+ @result The result of comparing the two scalars.
+ */
+static inline NSComparisonResult TWTNumberValidatorCompareScalars(TWTNumberValidatorScalar scalar1, TWTNumberValidatorScalar scalar2)
+{
+    if (scalar1.kind == TWTNumberValidatorScalarKindInteger && scalar2.kind == TWTNumberValidatorScalarKindInteger) {
+        return scalar1.integerValue < scalar2.integerValue ? NSOrderedAscending :
+            (scalar1.integerValue > scalar2.integerValue ? NSOrderedDescending : NSOrderedSame);
+    }
+
+    // Doubles outside the range of a long long are larger in magnitude than every integer scalar. Handling
+    // them here avoids problems with integers that round up to ±2^63 when converted to doubles.
+    if (scalar1.kind == TWTNumberValidatorScalarKindInteger && fabs(scalar2.doubleValue) >= TWTNumberValidatorLongLongLimit) {
+        return scalar2.doubleValue > 0 ? NSOrderedAscending : NSOrderedDescending;
+    } else if (scalar2.kind == TWTNumberValidatorScalarKindInteger && fabs(scalar1.doubleValue) >= TWTNumberValidatorLongLongLimit) {
+        return scalar1.doubleValue > 0 ? NSOrderedDescending : NSOrderedAscending;
+    }
+
+    // Otherwise, any double is non-integral and thus smaller in magnitude than 2^53, so rounding an integer
+    // to a double can’t change the result
+    double doubleValue1 = scalar1.kind == TWTNumberValidatorScalarKindInteger ? (double)scalar1.integerValue : scalar1.doubleValue;
+    double doubleValue2 = scalar2.kind == TWTNumberValidatorScalarKindInteger ? (double)scalar2.integerValue : scalar2.doubleValue;
+    return doubleValue1 < doubleValue2 ? NSOrderedAscending : (doubleValue1 > doubleValue2 ? NSOrderedDescending : NSOrderedSame);
+}
+
+
 @interface TWTNumberValidator ()
 
 @property (nonatomic, strong, readwrite) NSNumber *minimum;
 @property (nonatomic, strong, readwrite) NSNumber *maximum;
 
+/*!
+ @abstract Returns whether the specified scalar is valid, and if not, why.
+ @discussion This does not check the scalar’s class or whether it is nil or null.
+ @param scalar The scalar being validated.
+ @param number The number from which the scalar was unboxed. If nil and either the scalar or one of the
+     validator’s bounds is inexact, the scalar is boxed so that it can be compared using -compare:.
+ @param outErrorCode On return, if the scalar is invalid, the code of the error that describes why.
+ @result Whether the scalar is valid.
+ */
+- (BOOL)validateScalar:(TWTNumberValidatorScalar)scalar number:(NSNumber *)number errorCode:(out NSInteger *)outErrorCode;
+
+/*!
+ @abstract Returns a lazily described validation error with the specified code for the specified value.
+ @param errorCode The error code.
+ @param value The invalid value.
+ @result The validation error.
+ */
+- (NSError *)validationErrorWithCode:(NSInteger)errorCode value:(id)value;
+
 @end
 
 
-@implementation TWTNumberValidator
+@implementation TWTNumberValidator {
+    TWTNumberValidatorScalar _minimumScalar;
+    TWTNumberValidatorScalar _maximumScalar;
+
+    // Subclasses that override -validateValue:error: may perform additional checks that we don’t know about,
+    // so we can only validate primitives directly if this is NO
+    BOOL _overridesValidateValue;
+}
 
 - (instancetype)init
 {
@@ -54,8 +203,11 @@
     self = [super init];
     if (self) {
         self.valueClass = [NSNumber class];
-        _minimum = minimum;
-        _maximum = maximum;
+        self.minimum = minimum;
+        self.maximum = maximum;
+
+        SEL validateValueSelector = @selector(validateValue:error:);
+        _overridesValidateValue = [[self class] instanceMethodForSelector:validateValueSelector] != [TWTNumberValidator instanceMethodForSelector:validateValueSelector];
     }
 
     return self;
@@ -97,54 +249,179 @@
 }
 
 
+- (void)setMinimum:(NSNumber *)minimum
+{
+    _minimum = minimum;
+    _minimumScalar = TWTNumberValidatorScalarForNumber(minimum);
+}
+
+
+- (void)setMaximum:(NSNumber *)maximum
+{
+    _maximum = maximum;
+    _maximumScalar = TWTNumberValidatorScalarForNumber(maximum);
+}
+
+
+#pragma mark - Validation
+
 - (BOOL)validateValue:(id)value error:(out NSError *__autoreleasing *)outError
 {
-    if (![super validateValue:value error:outError]) {
-        return NO;
-    } else if (TWTValidatorValueIsNilOrNull(value)) {
-        // This will only happen if nil or null is allowed
+    // Most values are numbers, which don’t need our superclass’s nil, null, and class checks
+    Class numberClass = [NSNumber class];
+    if (self.valueClass != numberClass || ![value isKindOfClass:numberClass]) {
+        if (![super validateValue:value error:outError]) {
+            return NO;
+        } else if (TWTValidatorValueIsNilOrNull(value)) {
+            // This will only happen if nil or null is allowed
+            return YES;
+        }
+    }
+
+    NSInteger errorCode = -1;
+    if ([self validateScalar:TWTNumberValidatorScalarForNumber(value) number:value errorCode:&errorCode]) {
+        return YES;
+    }
+
+    if (outError) {
+        *outError = [self validationErrorWithCode:errorCode value:value];
+    }
+    
+    return NO;
+}
+
+
+- (BOOL)validateInteger:(long long)integer error:(out NSError *__autoreleasing *)outError
+{
+    if (_overridesValidateValue || self.valueClass != [NSNumber class]) {
+        return [self validateValue:@(integer) error:outError];
+    }
+
+    NSInteger errorCode = -1;
+    if ([self validateScalar:TWTNumberValidatorScalarMakeInteger(integer) number:nil errorCode:&errorCode]) {
         return YES;
     }
 
+    if (outError) {
+        *outError = [self validationErrorWithCode:errorCode value:@(integer)];
+    }
+
+    return NO;
+}
+
+
+- (BOOL)validateDouble:(double)doubleValue error:(out NSError *__autoreleasing *)outError
+{
+    if (_overridesValidateValue || self.valueClass != [NSNumber class]) {
+        return [self validateValue:@(doubleValue) error:outError];
+    }
+
     NSInteger errorCode = -1;
-    double doubleValue = [value doubleValue];
-
-    NSComparisonResult minimumComparisonResult = self.isMinimumExclusive ? NSOrderedSame : NSOrderedDescending;
-    NSComparisonResult maximumComparisonResult = self.isMaximumExclusive ? NSOrderedSame : NSOrderedAscending;
-
-    if (self.minimum && [self.minimum compare:value] >= minimumComparisonResult) {
-        errorCode = TWTValidationErrorCodeValueLessThanMinimum;
-    } else if (self.maximum && [self.maximum compare:value] <= maximumComparisonResult) {
-        errorCode = TWTValidationErrorCodeValueGreaterThanMaximum;
-    } else if (self.requiresIntegralValue && trunc(doubleValue) != doubleValue) {
-        errorCode = TWTValidationErrorCodeValueIsNotIntegral;
-    } else {
+    if ([self validateScalar:TWTNumberValidatorScalarMakeDouble(doubleValue) number:nil errorCode:&errorCode]) {
         return YES;
     }
 
     if (outError) {
-        NSString *description = nil;
+        *outError = [self validationErrorWithCode:errorCode value:@(doubleValue)];
+    }
+
+    return NO;
+}
+
+
+- (BOOL)validateValues:(NSArray *)values results:(out NSIndexSet *__autoreleasing *)outInvalidIndexes
+{
+    if (_overridesValidateValue) {
+        return [super validateValues:values results:outInvalidIndexes];
+    }
+
+    Class numberClass = [NSNumber class];
+    BOOL checksValueClass = self.valueClass != numberClass;
+    return [self validateValues:values results:outInvalidIndexes passingTest:^BOOL(id value) {
+        if (checksValueClass || ![value isKindOfClass:numberClass]) {
+            // Let -validateValue:error: deal with nil, null, and values of the wrong class
+            return [self validateValue:value error:NULL];
+        }
+
+        NSInteger errorCode = -1;
+        return [self validateScalar:TWTNumberValidatorScalarForNumber(value) number:value errorCode:&errorCode];
+    }];
+}
+
+
+- (BOOL)validateScalar:(TWTNumberValidatorScalar)scalar number:(NSNumber *)number errorCode:(out NSInteger *)outErrorCode
+{
+    if (scalar.kind == TWTNumberValidatorScalarKindInexact || _minimumScalar.kind == TWTNumberValidatorScalarKindInexact ||
+        _maximumScalar.kind == TWTNumberValidatorScalarKindInexact) {
+        if (!number) {
+            number = scalar.kind == TWTNumberValidatorScalarKindInteger ? @(scalar.integerValue) : @(scalar.doubleValue);
+        }
+
+        NSComparisonResult minimumComparisonResult = self.isMinimumExclusive ? NSOrderedSame : NSOrderedDescending;
+        NSComparisonResult maximumComparisonResult = self.isMaximumExclusive ? NSOrderedSame : NSOrderedAscending;
+        double doubleValue = number.doubleValue;
+
+        if (self.minimum && [self.minimum compare:number] >= minimumComparisonResult) {
+            *outErrorCode = TWTValidationErrorCodeValueLessThanMinimum;
+            return NO;
+        } else if (self.maximum && [self.maximum compare:number] <= maximumComparisonResult) {
+            *outErrorCode = TWTValidationErrorCodeValueGreaterThanMaximum;
+            return NO;
+        } else if (self.requiresIntegralValue && trunc(doubleValue) != doubleValue) {
+            *outErrorCode = TWTValidationErrorCodeValueIsNotIntegral;
+            return NO;
+        }
+
+        return YES;
+    }
+
+    if (_minimumScalar.kind != TWTNumberValidatorScalarKindNone) {
+        NSComparisonResult result = TWTNumberValidatorCompareScalars(scalar, _minimumScalar);
+        if (result == NSOrderedAscending || (result == NSOrderedSame && self.isMinimumExclusive)) {
+            *outErrorCode = TWTValidationErrorCodeValueLessThanMinimum;
+            return NO;
+        }
+    }
+
+    if (_maximumScalar.kind != TWTNumberValidatorScalarKindNone) {
+        NSComparisonResult result = TWTNumberValidatorCompareScalars(scalar, _maximumScalar);
+        if (result == NSOrderedDescending || (result == NSOrderedSame && self.isMaximumExclusive)) {
+            *outErrorCode = TWTValidationErrorCodeValueGreaterThanMaximum;
+            return NO;
+        }
+    }
+
+    // Integer scalars are always integral, and double scalars are either non-integral or too large to have a
+    // fractional part
+    if (self.requiresIntegralValue && scalar.kind == TWTNumberValidatorScalarKindDouble && trunc(scalar.doubleValue) != scalar.doubleValue) {
+        *outErrorCode = TWTValidationErrorCodeValueIsNotIntegral;
+        return NO;
+    }
+
+    return YES;
+}
+
+
+- (NSError *)validationErrorWithCode:(NSInteger)errorCode value:(id)value
+{
+    NSNumber *minimum = self.minimum;
+    NSNumber *maximum = self.maximum;
+    return [NSError twt_validationErrorWithCode:errorCode failingValidator:self value:value localizedDescriptionBlock:^NSString *{
         switch (errorCode) {
             case TWTValidationErrorCodeValueLessThanMinimum: {
                 NSString *descriptionFormat = TWTLocalizedString(@"TWTNumberValidator.valueLessThanMinimum.validationError.format");
-                description = [NSString stringWithFormat:descriptionFormat, value, self.minimum];
-                break;
+                return [NSString stringWithFormat:descriptionFormat, value, minimum];
             }
             case TWTValidationErrorCodeValueGreaterThanMaximum: {
                 NSString *descriptionFormat = TWTLocalizedString(@"TWTNumberValidator.valueGreaterThanMaximum.validationError.format");
-                description = [NSString stringWithFormat:descriptionFormat, value, self.maximum];
-                break;
+                return [NSString stringWithFormat:descriptionFormat, value, maximum];
             }
-            case TWTValidationErrorCodeValueIsNotIntegral: {
+            default: {
                 NSString *descriptionFormat = TWTLocalizedString(@"TWTNumberValidator.valueIsNotIntegral.validationError.format");
-                description = [NSString stringWithFormat:descriptionFormat, value];
+                return [NSString stringWithFormat:descriptionFormat, value];
             }
         }
-
-        *outError = [NSError twt_validationErrorWithCode:errorCode failingValidator:self value:value localizedDescription:description];
-    }
-    
-    return NO;
+    }];
 }
 
 @end
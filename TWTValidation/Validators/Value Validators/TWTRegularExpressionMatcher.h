@@ -0,0 +1,87 @@
+//
+//  TWTRegularExpressionMatcher.h
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+@import Foundation;
+
+/*!
+ TWTRegularExpressionMatchResults are the results of matching a string with a TWTRegularExpressionMatcher.
+ */
+typedef NS_ENUM(NSInteger, TWTRegularExpressionMatchResult) {
+    /*! Indicates that the string does not contain a match. */
+    TWTRegularExpressionMatchResultNoMatch,
+
+    /*! Indicates that the string contains a match. */
+    TWTRegularExpressionMatchResultMatch,
+
+    /*!
+     Indicates that the matcher could not decide whether the string contains a match, because the string contains a
+     character whose membership in a character class escape like \w the matcher doesn’t know. The string should be
+     matched with the regular expression instead.
+     */
+    TWTRegularExpressionMatchResultUndecided
+};
+
+
+/*!
+ TWTRegularExpressionMatchers determine whether strings contain a match for a regular expression in time linear in
+ the length of the string. They support a subset of ICU’s regular expression syntax that covers the ECMA-262
+ patterns typically used in JSON Schemas: literals, the . wildcard, character classes including \d, \w, and \s,
+ groups, alternation, greedy and lazy quantifiers including counted repetition, and the ^ and $ anchors. Patterns
+ with other constructs, e.g., backreferences, lookaround, word boundaries, or possessive quantifiers, are not
+ supported.
+
+ Matchers compile their patterns into nondeterministic finite automata, which they simulate in a single pass over a
+ string. Unlike backtracking matchers, they never revisit a character, so no pattern can make them take
+ exponential time. Because only whether a match exists is needed, a matcher stops at the first match it finds.
+
+ Matchers are immutable and may be used from multiple threads at once.
+ */
+@interface TWTRegularExpressionMatcher : NSObject
+
+/*!
+ @abstract The pattern that the matcher matches.
+ */
+@property (nonatomic, copy, readonly) NSString *pattern;
+
+/*!
+ @abstract Initializes a newly allocated matcher with the pattern and options of the specified regular expression.
+ @discussion This is the class’s designated initializer.
+ @param regularExpression The regular expression. May not be nil.
+ @param options The matching options with which strings would be matched with the regular expression.
+ @result An initialized matcher, or nil if the regular expression’s pattern or options are not supported.
+ */
+- (instancetype)initWithRegularExpression:(NSRegularExpression *)regularExpression matchingOptions:(NSMatchingOptions)options;
+
+/*!
+ @abstract Returns whether the specified string contains a match for the receiver’s pattern.
+ @discussion This does not allocate any memory for patterns that compile into fewer than 256 instructions.
+ @param string The string. May not be nil.
+ @result Whether the string contains a match. If the result is TWTRegularExpressionMatchResultUndecided, the string
+     should be matched with the regular expression from which the receiver was created.
+ */
+- (TWTRegularExpressionMatchResult)resultOfMatchingString:(NSString *)string;
+
+@end
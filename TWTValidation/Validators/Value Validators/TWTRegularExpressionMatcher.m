@@ -0,0 +1,1304 @@
+//
+//  TWTRegularExpressionMatcher.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTRegularExpressionMatcher.h>
+
+
+/*!
+ The maximum number of instructions in a compiled pattern. Counted repetition can make a program much larger than its
+ pattern, so patterns that compile into more instructions than this are not supported.
+ */
+static const NSUInteger TWTRegularExpressionMatcherInstructionLimit = 4096;
+
+/*!
+ The maximum depth of nested groups in a supported pattern.
+ */
+static const NSUInteger TWTRegularExpressionMatcherNestingLimit = 64;
+
+/*!
+ The largest bound in a supported counted repetition.
+ */
+static const NSUInteger TWTRegularExpressionMatcherRepetitionLimit = 1000;
+
+/*!
+ The number of instructions up to which matching uses stack buffers instead of heap buffers.
+ */
+static const NSUInteger TWTRegularExpressionMatcherStackInstructionCount = 256;
+
+
+#pragma mark - Programs
+
+/*!
+ TWTRegularExpressionOpcodes identify the operations performed by the instructions of a compiled pattern.
+ */
+typedef NS_ENUM(uint8_t, TWTRegularExpressionOpcode) {
+    // Consumes the instruction’s character
+    TWTRegularExpressionOpcodeCharacter,
+
+    // Consumes any character other than a line terminator
+    TWTRegularExpressionOpcodeAnyCharacterExceptLineTerminator,
+
+    // Consumes any character
+    TWTRegularExpressionOpcodeAnyCharacter,
+
+    // Consumes a character in the instruction’s character class
+    TWTRegularExpressionOpcodeCharacterClass,
+
+    // Continues at both of the instruction’s targets
+    TWTRegularExpressionOpcodeSplit,
+
+    // Continues at the instruction’s first target
+    TWTRegularExpressionOpcodeJump,
+
+    // Continues at the next instruction only at the start of the string
+    TWTRegularExpressionOpcodeAssertStart,
+
+    // Continues at the next instruction only at the end of the string or before a line terminator that ends it
+    TWTRegularExpressionOpcodeAssertEnd,
+
+    // Indicates that the string contains a match
+    TWTRegularExpressionOpcodeMatch
+};
+
+
+/*!
+ TWTRegularExpressionInstructions are the instructions of a compiled pattern.
+ */
+typedef struct _TWTRegularExpressionInstruction {
+    TWTRegularExpressionOpcode opcode;
+    UTF32Char character;
+
+    // For character class instructions, the first target is the index of the character class
+    uint32_t target1;
+    uint32_t target2;
+} TWTRegularExpressionInstruction;
+
+
+/*!
+ TWTRegularExpressionClassEscapes identify the character class escapes—\d, \D, \w, \W, \s, and \S—that a character
+ class contains.
+ */
+typedef NS_OPTIONS(uint8_t, TWTRegularExpressionClassEscapes) {
+    TWTRegularExpressionClassEscapeDigit = 1 << 0,
+    TWTRegularExpressionClassEscapeNonDigit = 1 << 1,
+    TWTRegularExpressionClassEscapeWord = 1 << 2,
+    TWTRegularExpressionClassEscapeNonWord = 1 << 3,
+    TWTRegularExpressionClassEscapeSpace = 1 << 4,
+    TWTRegularExpressionClassEscapeNonSpace = 1 << 5
+};
+
+
+/*!
+ TWTRegularExpressionCharacterClasses describe the character classes of a compiled pattern. Their ranges are stored
+ as pairs of first and last characters in an array shared by all the pattern’s classes.
+ */
+typedef struct _TWTRegularExpressionCharacterClass {
+    NSUInteger rangeIndex;
+    NSUInteger rangeCount;
+    TWTRegularExpressionClassEscapes escapes;
+    BOOL negated;
+} TWTRegularExpressionCharacterClass;
+
+
+/*!
+ TWTRegularExpressionMemberships are the results of checking whether a character is in a character class.
+ */
+typedef NS_ENUM(uint8_t, TWTRegularExpressionMembership) {
+    TWTRegularExpressionMembershipNo,
+    TWTRegularExpressionMembershipYes,
+
+    // The matcher doesn’t know whether ICU considers the character part of the class
+    TWTRegularExpressionMembershipUnknown
+};
+
+
+static inline TWTRegularExpressionMembership TWTRegularExpressionMembershipMake(BOOL isMember)
+{
+    return isMember ? TWTRegularExpressionMembershipYes : TWTRegularExpressionMembershipNo;
+}
+
+
+static inline TWTRegularExpressionMembership TWTRegularExpressionMembershipInverse(TWTRegularExpressionMembership membership)
+{
+    switch (membership) {
+        case TWTRegularExpressionMembershipNo:
+            return TWTRegularExpressionMembershipYes;
+        case TWTRegularExpressionMembershipYes:
+            return TWTRegularExpressionMembershipNo;
+        case TWTRegularExpressionMembershipUnknown:
+            return TWTRegularExpressionMembershipUnknown;
+    }
+}
+
+
+/*!
+ @abstract Returns whether the specified character is one of ICU’s line terminators.
+ */
+static inline BOOL TWTRegularExpressionIsLineTerminator(UTF32Char character)
+{
+    return (character >= 0x0A && character <= 0x0D) || character == 0x85 || character == 0x2028 || character == 0x2029;
+}
+
+
+/*!
+ @abstract Returns whether the specified character matches ICU’s \d, i.e., is a Unicode decimal digit.
+ */
+static TWTRegularExpressionMembership TWTRegularExpressionDigitMembership(UTF32Char character)
+{
+    if (character < 0x80) {
+        return TWTRegularExpressionMembershipMake(character >= '0' && character <= '9');
+    }
+
+    return TWTRegularExpressionMembershipMake(CFCharacterSetIsLongCharacterMember(CFCharacterSetGetPredefined(kCFCharacterSetDecimalDigit), character));
+}
+
+
+/*!
+ @abstract Returns whether the specified character matches ICU’s \s, i.e., [\t\n\f\r\p{Z}].
+ */
+static TWTRegularExpressionMembership TWTRegularExpressionSpaceMembership(UTF32Char character)
+{
+    // Unicode considers vertical tab and next line whitespace, but they aren’t in the definition above
+    if (character == 0x0B || character == 0x85) {
+        return TWTRegularExpressionMembershipUnknown;
+    } else if (character < 0x80) {
+        return TWTRegularExpressionMembershipMake(character == '\t' || character == '\n' || character == '\f' || character == '\r' || character == ' ');
+    }
+
+    // The whitespace set is Zs and tab, to which we add Zl and Zp
+    return TWTRegularExpressionMembershipMake(character == 0x2028 || character == 0x2029 ||
+                                              CFCharacterSetIsLongCharacterMember(CFCharacterSetGetPredefined(kCFCharacterSetWhitespace), character));
+}
+
+
+/*!
+ @abstract Returns whether the specified character matches ICU’s \w, i.e.,
+     [\p{Alphabetic}\p{Mark}\p{Decimal_Number}\p{Connector_Punctuation}‌‍].
+ @discussion Foundation has no set of alphabetic characters, so characters that are neither clearly in nor clearly
+     out of the class, e.g., letter numbers and unassigned code points, have unknown membership.
+ */
+static TWTRegularExpressionMembership TWTRegularExpressionWordMembership(UTF32Char character)
+{
+    if (character < 0x80) {
+        return TWTRegularExpressionMembershipMake((character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') ||
+                                                  (character >= '0' && character <= '9') || character == '_');
+    }
+
+    // Connector punctuation and joiners
+    if (character == 0x200C || character == 0x200D || character == 0x203F || character == 0x2040 || character == 0x2054 ||
+        character == 0xFE33 || character == 0xFE34 || (character >= 0xFE4D && character <= 0xFE4F) || character == 0xFF3F) {
+        return TWTRegularExpressionMembershipYes;
+    }
+
+    // The letter set contains letters and marks
+    if (CFCharacterSetIsLongCharacterMember(CFCharacterSetGetPredefined(kCFCharacterSetLetter), character) ||
+        CFCharacterSetIsLongCharacterMember(CFCharacterSetGetPredefined(kCFCharacterSetDecimalDigit), character)) {
+        return TWTRegularExpressionMembershipYes;
+    }
+
+    // The only alphabetic symbols are circled and squared Latin letters
+    if (CFCharacterSetIsLongCharacterMember(CFCharacterSetGetPredefined(kCFCharacterSetSymbol), character)) {
+        return TWTRegularExpressionMembershipMake((character >= 0x24B6 && character <= 0x24E9) || (character >= 0x1F130 && character <= 0x1F149) ||
+                                                  (character >= 0x1F150 && character <= 0x1F169) || (character >= 0x1F170 && character <= 0x1F189));
+    }
+
+    // No punctuation, whitespace, or control characters are alphabetic
+    if (CFCharacterSetIsLongCharacterMember(CFCharacterSetGetPredefined(kCFCharacterSetPunctuation), character) ||
+        CFCharacterSetIsLongCharacterMember(CFCharacterSetGetPredefined(kCFCharacterSetWhitespaceAndNewline), character) ||
+        CFCharacterSetIsLongCharacterMember(CFCharacterSetGetPredefined(kCFCharacterSetControl), character)) {
+        return TWTRegularExpressionMembershipNo;
+    }
+
+    return TWTRegularExpressionMembershipUnknown;
+}
+
+
+/*!
+ @abstract Returns whether the specified character is in a character class.
+ @param characterClass The character class.
+ @param ranges The ranges of the compiled pattern that contains the character class.
+ @param character The character.
+ @result Whether the character is in the character class.
+ */
+static TWTRegularExpressionMembership TWTRegularExpressionCharacterClassMembership(const TWTRegularExpressionCharacterClass *characterClass,
+                                                                                   const UTF32Char *ranges,
+                                                                                   UTF32Char character)
+{
+    TWTRegularExpressionMembership membership = TWTRegularExpressionMembershipNo;
+
+    const UTF32Char *range = ranges + characterClass->rangeIndex * 2;
+    for (NSUInteger i = 0; i < characterClass->rangeCount; ++i, range += 2) {
+        if (character >= range[0] && character <= range[1]) {
+            membership = TWTRegularExpressionMembershipYes;
+            break;
+        }
+    }
+
+    TWTRegularExpressionClassEscapes escapes = characterClass->escapes;
+    if (membership == TWTRegularExpressionMembershipNo && escapes) {
+        // A known match decides the class, but unknown membership in one escape only matters if no other escape matches
+        TWTRegularExpressionMembership escapeMemberships[6] = {
+            (escapes & TWTRegularExpressionClassEscapeDigit) ? TWTRegularExpressionDigitMembership(character) : TWTRegularExpressionMembershipNo,
+            (escapes & TWTRegularExpressionClassEscapeNonDigit) ? TWTRegularExpressionMembershipInverse(TWTRegularExpressionDigitMembership(character)) : TWTRegularExpressionMembershipNo,
+            (escapes & TWTRegularExpressionClassEscapeWord) ? TWTRegularExpressionWordMembership(character) : TWTRegularExpressionMembershipNo,
+            (escapes & TWTRegularExpressionClassEscapeNonWord) ? TWTRegularExpressionMembershipInverse(TWTRegularExpressionWordMembership(character)) : TWTRegularExpressionMembershipNo,
+            (escapes & TWTRegularExpressionClassEscapeSpace) ? TWTRegularExpressionSpaceMembership(character) : TWTRegularExpressionMembershipNo,
+            (escapes & TWTRegularExpressionClassEscapeNonSpace) ? TWTRegularExpressionMembershipInverse(TWTRegularExpressionSpaceMembership(character)) : TWTRegularExpressionMembershipNo
+        };
+
+        for (NSUInteger i = 0; i < 6; ++i) {
+            if (escapeMemberships[i] == TWTRegularExpressionMembershipYes) {
+                membership = TWTRegularExpressionMembershipYes;
+                break;
+            } else if (escapeMemberships[i] == TWTRegularExpressionMembershipUnknown) {
+                membership = TWTRegularExpressionMembershipUnknown;
+            }
+        }
+    }
+
+    return characterClass->negated ? TWTRegularExpressionMembershipInverse(membership) : membership;
+}
+
+
+#pragma mark - Syntax Trees
+
+/*!
+ TWTRegularExpressionNodeTypes identify the types of nodes in a parsed pattern.
+ */
+typedef NS_ENUM(NSUInteger, TWTRegularExpressionNodeType) {
+    TWTRegularExpressionNodeTypeCharacter,
+    TWTRegularExpressionNodeTypeAnyCharacter,
+    TWTRegularExpressionNodeTypeCharacterClass,
+    TWTRegularExpressionNodeTypeStart,
+    TWTRegularExpressionNodeTypeEnd,
+    TWTRegularExpressionNodeTypeConcatenation,
+    TWTRegularExpressionNodeTypeAlternation,
+    TWTRegularExpressionNodeTypeRepetition
+};
+
+
+/*!
+ The maximum count of a repetition that has no upper bound.
+ */
+static const NSUInteger TWTRegularExpressionNodeUnboundedCount = NSUIntegerMax;
+
+
+/*!
+ TWTRegularExpressionNodes are the nodes of a parsed pattern. Groups don’t have their own nodes, since matchers don’t
+ capture anything.
+ */
+@interface TWTRegularExpressionNode : NSObject
+
+@property (nonatomic, assign) TWTRegularExpressionNodeType type;
+
+// The character of a character node, or the class index of a character class node
+@property (nonatomic, assign) UTF32Char character;
+@property (nonatomic, assign) NSUInteger classIndex;
+
+// The subexpressions of concatenation, alternation, and repetition nodes
+@property (nonatomic, copy) NSArray *children;
+
+// The bounds of a repetition node
+@property (nonatomic, assign) NSUInteger minimumCount;
+@property (nonatomic, assign) NSUInteger maximumCount;
+
+- (instancetype)initWithType:(TWTRegularExpressionNodeType)type;
+
+@end
+
+
+@implementation TWTRegularExpressionNode
+
+- (instancetype)init
+{
+    return [self initWithType:TWTRegularExpressionNodeTypeConcatenation];
+}
+
+
+- (instancetype)initWithType:(TWTRegularExpressionNodeType)type
+{
+    self = [super init];
+    if (self) {
+        _type = type;
+    }
+
+    return self;
+}
+
+@end
+
+
+#pragma mark - Compiler
+
+/*!
+ TWTRegularExpressionCompilers parse a pattern and compile it into instructions and character classes. Parsing
+ stops at the first construct that matchers don’t support.
+ */
+@interface TWTRegularExpressionCompiler : NSObject {
+@public
+    NSMutableData *_instructions;
+    NSMutableData *_characterClasses;
+    NSMutableData *_ranges;
+}
+
+- (instancetype)initWithPattern:(NSString *)pattern dotMatchesLineTerminators:(BOOL)dotMatchesLineTerminators;
+
+/*!
+ @abstract Compiles the receiver’s pattern.
+ @result Whether the pattern is supported. If it is, the receiver’s instructions, character classes, and ranges
+     contain the compiled pattern.
+ */
+- (BOOL)compile;
+
+@end
+
+
+@implementation TWTRegularExpressionCompiler {
+    NSData *_codePoints;
+    NSUInteger _length;
+    NSUInteger _position;
+    NSUInteger _depth;
+    BOOL _dotMatchesLineTerminators;
+}
+
+- (instancetype)init
+{
+    return [self initWithPattern:nil dotMatchesLineTerminators:NO];
+}
+
+
+- (instancetype)initWithPattern:(NSString *)pattern dotMatchesLineTerminators:(BOOL)dotMatchesLineTerminators
+{
+    self = [super init];
+    if (self) {
+        // Parse code points rather than UTF-16 code units so that characters outside the BMP are single literals
+        NSMutableData *codePoints = [[NSMutableData alloc] initWithCapacity:pattern.length * sizeof(UTF32Char)];
+        NSUInteger patternLength = pattern.length;
+        for (NSUInteger i = 0; i < patternLength; ++i) {
+            UTF32Char character = [pattern characterAtIndex:i];
+            if (CFStringIsSurrogateHighCharacter(character) && i + 1 < patternLength &&
+                CFStringIsSurrogateLowCharacter([pattern characterAtIndex:i + 1])) {
+                character = CFStringGetLongCharacterForSurrogatePair(character, [pattern characterAtIndex:i + 1]);
+                ++i;
+            }
+
+            [codePoints appendBytes:&character length:sizeof(character)];
+        }
+
+        _codePoints = [codePoints copy];
+        _length = _codePoints.length / sizeof(UTF32Char);
+        _dotMatchesLineTerminators = dotMatchesLineTerminators;
+        _instructions = [[NSMutableData alloc] init];
+        _characterClasses = [[NSMutableData alloc] init];
+        _ranges = [[NSMutableData alloc] init];
+    }
+
+    return self;
+}
+
+
+- (BOOL)compile
+{
+    TWTRegularExpressionNode *node = [self parseAlternation];
+    if (!node || _position != _length) {
+        return NO;
+    }
+
+    return [self emitNode:node] && [self emitInstructionWithOpcode:TWTRegularExpressionOpcodeMatch] != NSNotFound;
+}
+
+
+#pragma mark - Parsing
+
+- (BOOL)hasCharacter
+{
+    return _position < _length;
+}
+
+
+- (UTF32Char)peekCharacter
+{
+    return ((const UTF32Char *)_codePoints.bytes)[_position];
+}
+
+
+- (UTF32Char)peekCharacterAtOffset:(NSUInteger)offset
+{
+    return _position + offset < _length ? ((const UTF32Char *)_codePoints.bytes)[_position + offset] : 0;
+}
+
+
+- (TWTRegularExpressionNode *)parseAlternation
+{
+    if (++_depth > TWTRegularExpressionMatcherNestingLimit) {
+        return nil;
+    }
+
+    NSMutableArray *alternatives = [[NSMutableArray alloc] init];
+    while (YES) {
+        TWTRegularExpressionNode *concatenation = [self parseConcatenation];
+        if (!concatenation) {
+            return nil;
+        }
+
+        [alternatives addObject:concatenation];
+        if (![self hasCharacter] || [self peekCharacter] != '|') {
+            break;
+        }
+
+        ++_position;
+    }
+
+    --_depth;
+    if (alternatives.count == 1) {
+        return alternatives.firstObject;
+    }
+
+    TWTRegularExpressionNode *node = [[TWTRegularExpressionNode alloc] initWithType:TWTRegularExpressionNodeTypeAlternation];
+    node.children = alternatives;
+    return node;
+}
+
+
+- (TWTRegularExpressionNode *)parseConcatenation
+{
+    NSMutableArray *terms = [[NSMutableArray alloc] init];
+    while ([self hasCharacter] && [self peekCharacter] != '|' && [self peekCharacter] != ')') {
+        TWTRegularExpressionNode *term = [self parseAtom];
+        if (!term || ![self parseQuantifiersOfNode:&term]) {
+            return nil;
+        }
+
+        [terms addObject:term];
+    }
+
+    TWTRegularExpressionNode *node = [[TWTRegularExpressionNode alloc] initWithType:TWTRegularExpressionNodeTypeConcatenation];
+    node.children = terms;
+    return node;
+}
+
+
+/*!
+ @abstract Parses any quantifier that follows an atom, replacing the atom with a repetition node.
+ @result Whether any quantifier is supported.
+ */
+- (BOOL)parseQuantifiersOfNode:(TWTRegularExpressionNode *__strong *)node
+{
+    if (![self hasCharacter]) {
+        return YES;
+    }
+
+    NSUInteger minimumCount = 0;
+    NSUInteger maximumCount = 0;
+    switch ([self peekCharacter]) {
+        case '*':
+            minimumCount = 0;
+            maximumCount = TWTRegularExpressionNodeUnboundedCount;
+            ++_position;
+            break;
+        case '+':
+            minimumCount = 1;
+            maximumCount = TWTRegularExpressionNodeUnboundedCount;
+            ++_position;
+            break;
+        case '?':
+            minimumCount = 0;
+            maximumCount = 1;
+            ++_position;
+            break;
+        case '{':
+            if (![self parseIntervalWithMinimumCount:&minimumCount maximumCount:&maximumCount]) {
+                return NO;
+            }
+            break;
+        default:
+            return YES;
+    }
+
+    // Anchors can’t be repeated, and ICU’s possessive quantifiers and stacked quantifiers aren’t supported. Lazy
+    // quantifiers match the same strings as greedy ones, so they are treated the same
+    TWTRegularExpressionNodeType type = (*node).type;
+    if (type == TWTRegularExpressionNodeTypeStart || type == TWTRegularExpressionNodeTypeEnd) {
+        return NO;
+    } else if ([self hasCharacter] && [self peekCharacter] == '?') {
+        ++_position;
+    }
+
+    if ([self hasCharacter]) {
+        UTF32Char character = [self peekCharacter];
+        if (character == '*' || character == '+' || character == '?' || character == '{') {
+            return NO;
+        }
+    }
+
+    TWTRegularExpressionNode *repetition = [[TWTRegularExpressionNode alloc] initWithType:TWTRegularExpressionNodeTypeRepetition];
+    repetition.children = @[ *node ];
+    repetition.minimumCount = minimumCount;
+    repetition.maximumCount = maximumCount;
+    *node = repetition;
+    return YES;
+}
+
+
+- (BOOL)parseIntervalWithMinimumCount:(NSUInteger *)outMinimumCount maximumCount:(NSUInteger *)outMaximumCount
+{
+    // Skip the {
+    ++_position;
+
+    NSUInteger minimumCount = 0;
+    if (![self parseDecimalInteger:&minimumCount]) {
+        return NO;
+    }
+
+    NSUInteger maximumCount = minimumCount;
+    if ([self hasCharacter] && [self peekCharacter] == ',') {
+        ++_position;
+        if ([self hasCharacter] && [self peekCharacter] == '}') {
+            maximumCount = TWTRegularExpressionNodeUnboundedCount;
+        } else if (![self parseDecimalInteger:&maximumCount]) {
+            return NO;
+        }
+    }
+
+    if (![self hasCharacter] || [self peekCharacter] != '}' || minimumCount > maximumCount) {
+        return NO;
+    }
+
+    ++_position;
+    *outMinimumCount = minimumCount;
+    *outMaximumCount = maximumCount;
+    return YES;
+}
+
+
+- (BOOL)parseDecimalInteger:(NSUInteger *)outInteger
+{
+    NSUInteger integer = 0;
+    NSUInteger digitCount = 0;
+    while ([self hasCharacter] && [self peekCharacter] >= '0' && [self peekCharacter] <= '9') {
+        integer = integer * 10 + ([self peekCharacter] - '0');
+        if (integer > TWTRegularExpressionMatcherRepetitionLimit) {
+            return NO;
+        }
+
+        ++digitCount;
+        ++_position;
+    }
+
+    *outInteger = integer;
+    return digitCount > 0;
+}
+
+
+- (TWTRegularExpressionNode *)parseAtom
+{
+    UTF32Char character = [self peekCharacter];
+    ++_position;
+
+    switch (character) {
+        case '(': {
+            // Only non-capturing groups are supported among the (? constructs
+            if ([self hasCharacter] && [self peekCharacter] == '?') {
+                if ([self peekCharacterAtOffset:1] != ':') {
+                    return nil;
+                }
+
+                _position += 2;
+            }
+
+            TWTRegularExpressionNode *node = [self parseAlternation];
+            if (!node || ![self hasCharacter] || [self peekCharacter] != ')') {
+                return nil;
+            }
+
+            ++_position;
+            return node;
+        }
+        case '[':
+            return [self parseCharacterClass];
+        case '.':
+            return [[TWTRegularExpressionNode alloc] initWithType:TWTRegularExpressionNodeTypeAnyCharacter];
+        case '^':
+            return [[TWTRegularExpressionNode alloc] initWithType:TWTRegularExpressionNodeTypeStart];
+        case '$':
+            return [[TWTRegularExpressionNode alloc] initWithType:TWTRegularExpressionNodeTypeEnd];
+        case '\\': {
+            TWTRegularExpressionClassEscapes escape = 0;
+            UTF32Char escapedCharacter = 0;
+            if (![self parseEscapeWithCharacter:&escapedCharacter classEscape:&escape]) {
+                return nil;
+            } else if (escape) {
+                return [self characterClassNodeWithRanges:NULL rangeCount:0 escapes:escape negated:NO];
+            }
+
+            return [self characterNodeWithCharacter:escapedCharacter];
+        }
+        case '*':
+        case '+':
+        case '?':
+        case '{':
+        case '}':
+        case ']':
+            // Quantifiers without atoms are errors, and we don’t guess how ICU treats unbalanced brackets
+            return nil;
+        default:
+            return [self characterNodeWithCharacter:character];
+    }
+}
+
+
+/*!
+ @abstract Parses the escape sequence after a backslash.
+ @param outCharacter On return, the escaped character if the escape sequence is not a class escape.
+ @param outClassEscape On return, the class escape if the escape sequence is one, and 0 otherwise.
+ @result Whether the escape sequence is supported.
+ */
+- (BOOL)parseEscapeWithCharacter:(UTF32Char *)outCharacter classEscape:(TWTRegularExpressionClassEscapes *)outClassEscape
+{
+    if (![self hasCharacter]) {
+        return NO;
+    }
+
+    UTF32Char character = [self peekCharacter];
+    ++_position;
+
+    *outClassEscape = 0;
+    switch (character) {
+        case 'd':
+            *outClassEscape = TWTRegularExpressionClassEscapeDigit;
+            return YES;
+        case 'D':
+            *outClassEscape = TWTRegularExpressionClassEscapeNonDigit;
+            return YES;
+        case 'w':
+            *outClassEscape = TWTRegularExpressionClassEscapeWord;
+            return YES;
+        case 'W':
+            *outClassEscape = TWTRegularExpressionClassEscapeNonWord;
+            return YES;
+        case 's':
+            *outClassEscape = TWTRegularExpressionClassEscapeSpace;
+            return YES;
+        case 'S':
+            *outClassEscape = TWTRegularExpressionClassEscapeNonSpace;
+            return YES;
+        case 't':
+            *outCharacter = '\t';
+            return YES;
+        case 'n':
+            *outCharacter = '\n';
+            return YES;
+        case 'r':
+            *outCharacter = '\r';
+            return YES;
+        case 'f':
+            *outCharacter = '\f';
+            return YES;
+        case 'a':
+            *outCharacter = 0x07;
+            return YES;
+        case 'e':
+            *outCharacter = 0x1B;
+            return YES;
+        case 'x':
+            return [self parseHexadecimalCharacter:outCharacter digitCount:2];
+        case 'u':
+            return [self parseHexadecimalCharacter:outCharacter digitCount:4];
+        default:
+            // Other letters and digits have special meanings, e.g., \b and backreferences, but ASCII punctuation is
+            // always literal
+            if (character < 0x80 && ispunct((int)character)) {
+                *outCharacter = character;
+                return YES;
+            }
+
+            return NO;
+    }
+}
+
+
+- (BOOL)parseHexadecimalCharacter:(UTF32Char *)outCharacter digitCount:(NSUInteger)digitCount
+{
+    UTF32Char character = 0;
+    for (NSUInteger i = 0; i < digitCount; ++i) {
+        if (![self hasCharacter] || [self peekCharacter] >= 0x80 || !isxdigit((int)[self peekCharacter])) {
+            return NO;
+        }
+
+        UTF32Char digit = [self peekCharacter];
+        character = character * 16 + (isdigit((int)digit) ? digit - '0' : (tolower((int)digit) - 'a' + 10));
+        ++_position;
+    }
+
+    *outCharacter = character;
+    return YES;
+}
+
+
+- (TWTRegularExpressionNode *)parseCharacterClass
+{
+    BOOL negated = NO;
+    if ([self hasCharacter] && [self peekCharacter] == '^') {
+        negated = YES;
+        ++_position;
+    }
+
+    // We don’t guess how ICU treats a ] at the start of a class
+    if ([self hasCharacter] && [self peekCharacter] == ']') {
+        return nil;
+    }
+
+    NSMutableData *ranges = [[NSMutableData alloc] init];
+    TWTRegularExpressionClassEscapes escapes = 0;
+    while ([self hasCharacter] && [self peekCharacter] != ']') {
+        UTF32Char character = [self peekCharacter];
+
+        // ICU supports nested classes, POSIX-style classes, and set operations, none of which are supported here
+        if (character == '[' || (character == '&' && [self peekCharacterAtOffset:1] == '&') ||
+            (character == '-' && [self peekCharacterAtOffset:1] == '-')) {
+            return nil;
+        }
+
+        TWTRegularExpressionClassEscapes escape = 0;
+        UTF32Char first = 0;
+        if (![self parseClassAtomWithCharacter:&first classEscape:&escape]) {
+            return nil;
+        }
+
+        BOOL isRange = [self hasCharacter] && [self peekCharacter] == '-' && [self peekCharacterAtOffset:1] != ']' &&
+            _position + 1 < _length;
+        if (escape) {
+            // Class escapes can’t be the ends of ranges
+            if (isRange) {
+                return nil;
+            }
+
+            escapes |= escape;
+            continue;
+        }
+
+        UTF32Char last = first;
+        if (isRange) {
+            ++_position;
+            if ([self peekCharacter] == '[' || ![self parseClassAtomWithCharacter:&last classEscape:&escape] || escape || last < first) {
+                return nil;
+            }
+        }
+
+        UTF32Char range[2] = { first, last };
+        [ranges appendBytes:range length:sizeof(range)];
+    }
+
+    if (![self hasCharacter]) {
+        return nil;
+    }
+
+    // Skip the ]
+    ++_position;
+    return [self characterClassNodeWithRanges:ranges.bytes rangeCount:ranges.length / (2 * sizeof(UTF32Char)) escapes:escapes negated:negated];
+}
+
+
+- (BOOL)parseClassAtomWithCharacter:(UTF32Char *)outCharacter classEscape:(TWTRegularExpressionClassEscapes *)outClassEscape
+{
+    if (![self hasCharacter]) {
+        return NO;
+    }
+
+    UTF32Char character = [self peekCharacter];
+    ++_position;
+
+    if (character == '\\') {
+        return [self parseEscapeWithCharacter:outCharacter classEscape:outClassEscape];
+    }
+
+    *outCharacter = character;
+    *outClassEscape = 0;
+    return YES;
+}
+
+
+- (TWTRegularExpressionNode *)characterNodeWithCharacter:(UTF32Char)character
+{
+    TWTRegularExpressionNode *node = [[TWTRegularExpressionNode alloc] initWithType:TWTRegularExpressionNodeTypeCharacter];
+    node.character = character;
+    return node;
+}
+
+
+- (TWTRegularExpressionNode *)characterClassNodeWithRanges:(const UTF32Char *)ranges
+                                                rangeCount:(NSUInteger)rangeCount
+                                                   escapes:(TWTRegularExpressionClassEscapes)escapes
+                                                   negated:(BOOL)negated
+{
+    TWTRegularExpressionCharacterClass characterClass = {
+        .rangeIndex = _ranges.length / (2 * sizeof(UTF32Char)),
+        .rangeCount = rangeCount,
+        .escapes = escapes,
+        .negated = negated
+    };
+
+    [_ranges appendBytes:ranges length:rangeCount * 2 * sizeof(UTF32Char)];
+    [_characterClasses appendBytes:&characterClass length:sizeof(characterClass)];
+
+    TWTRegularExpressionNode *node = [[TWTRegularExpressionNode alloc] initWithType:TWTRegularExpressionNodeTypeCharacterClass];
+    node.classIndex = _characterClasses.length / sizeof(TWTRegularExpressionCharacterClass) - 1;
+    return node;
+}
+
+
+#pragma mark - Code Generation
+
+- (NSUInteger)instructionCount
+{
+    return _instructions.length / sizeof(TWTRegularExpressionInstruction);
+}
+
+
+- (TWTRegularExpressionInstruction *)instructionAtIndex:(NSUInteger)index
+{
+    return (TWTRegularExpressionInstruction *)_instructions.mutableBytes + index;
+}
+
+
+/*!
+ @abstract Appends an instruction with the specified opcode to the receiver’s instructions.
+ @result The index of the new instruction, or NSNotFound if the program has too many instructions.
+ */
+- (NSUInteger)emitInstructionWithOpcode:(TWTRegularExpressionOpcode)opcode
+{
+    NSUInteger index = self.instructionCount;
+    if (index >= TWTRegularExpressionMatcherInstructionLimit) {
+        return NSNotFound;
+    }
+
+    TWTRegularExpressionInstruction instruction = { .opcode = opcode };
+    [_instructions appendBytes:&instruction length:sizeof(instruction)];
+    return index;
+}
+
+
+- (BOOL)emitNode:(TWTRegularExpressionNode *)node
+{
+    NSUInteger index = NSNotFound;
+    switch (node.type) {
+        case TWTRegularExpressionNodeTypeCharacter:
+            index = [self emitInstructionWithOpcode:TWTRegularExpressionOpcodeCharacter];
+            if (index != NSNotFound) {
+                [self instructionAtIndex:index]->character = node.character;
+            }
+            return index != NSNotFound;
+        case TWTRegularExpressionNodeTypeAnyCharacter:
+            return [self emitInstructionWithOpcode:(_dotMatchesLineTerminators ? TWTRegularExpressionOpcodeAnyCharacter
+                                                                                : TWTRegularExpressionOpcodeAnyCharacterExceptLineTerminator)] != NSNotFound;
+        case TWTRegularExpressionNodeTypeCharacterClass:
+            index = [self emitInstructionWithOpcode:TWTRegularExpressionOpcodeCharacterClass];
+            if (index != NSNotFound) {
+                [self instructionAtIndex:index]->target1 = (uint32_t)node.classIndex;
+            }
+            return index != NSNotFound;
+        case TWTRegularExpressionNodeTypeStart:
+            return [self emitInstructionWithOpcode:TWTRegularExpressionOpcodeAssertStart] != NSNotFound;
+        case TWTRegularExpressionNodeTypeEnd:
+            return [self emitInstructionWithOpcode:TWTRegularExpressionOpcodeAssertEnd] != NSNotFound;
+        case TWTRegularExpressionNodeTypeConcatenation:
+            for (TWTRegularExpressionNode *child in node.children) {
+                if (![self emitNode:child]) {
+                    return NO;
+                }
+            }
+            return YES;
+        case TWTRegularExpressionNodeTypeAlternation:
+            return [self emitAlternationNode:node];
+        case TWTRegularExpressionNodeTypeRepetition:
+            return [self emitRepetitionNode:node];
+    }
+}
+
+
+- (BOOL)emitAlternationNode:(TWTRegularExpressionNode *)node
+{
+    // Each alternative but the last is preceded by a split to it and the next alternative, and followed by a jump to
+    // the end of the alternation
+    NSMutableArray *jumpIndexes = [[NSMutableArray alloc] initWithCapacity:node.children.count];
+    NSUInteger lastChildIndex = node.children.count - 1;
+    for (NSUInteger i = 0; i < lastChildIndex; ++i) {
+        NSUInteger splitIndex = [self emitInstructionWithOpcode:TWTRegularExpressionOpcodeSplit];
+        if (splitIndex == NSNotFound || ![self emitNode:node.children[i]]) {
+            return NO;
+        }
+
+        NSUInteger jumpIndex = [self emitInstructionWithOpcode:TWTRegularExpressionOpcodeJump];
+        if (jumpIndex == NSNotFound) {
+            return NO;
+        }
+
+        [jumpIndexes addObject:@(jumpIndex)];
+        [self instructionAtIndex:splitIndex]->target1 = (uint32_t)(splitIndex + 1);
+        [self instructionAtIndex:splitIndex]->target2 = (uint32_t)self.instructionCount;
+    }
+
+    if (![self emitNode:node.children[lastChildIndex]]) {
+        return NO;
+    }
+
+    for (NSNumber *jumpIndex in jumpIndexes) {
+        [self instructionAtIndex:jumpIndex.unsignedIntegerValue]->target1 = (uint32_t)self.instructionCount;
+    }
+
+    return YES;
+}
+
+
+- (BOOL)emitRepetitionNode:(TWTRegularExpressionNode *)node
+{
+    TWTRegularExpressionNode *child = node.children.firstObject;
+    for (NSUInteger i = 0; i < node.minimumCount; ++i) {
+        if (![self emitNode:child]) {
+            return NO;
+        }
+    }
+
+    if (node.maximumCount == TWTRegularExpressionNodeUnboundedCount) {
+        // A loop that either runs the child again or exits
+        NSUInteger splitIndex = [self emitInstructionWithOpcode:TWTRegularExpressionOpcodeSplit];
+        if (splitIndex == NSNotFound || ![self emitNode:child]) {
+            return NO;
+        }
+
+        NSUInteger jumpIndex = [self emitInstructionWithOpcode:TWTRegularExpressionOpcodeJump];
+        if (jumpIndex == NSNotFound) {
+            return NO;
+        }
+
+        [self instructionAtIndex:jumpIndex]->target1 = (uint32_t)splitIndex;
+        [self instructionAtIndex:splitIndex]->target1 = (uint32_t)(splitIndex + 1);
+        [self instructionAtIndex:splitIndex]->target2 = (uint32_t)self.instructionCount;
+        return YES;
+    }
+
+    // Optional copies of the child, any of which may skip to the end of the repetition
+    NSMutableArray *splitIndexes = [[NSMutableArray alloc] initWithCapacity:node.maximumCount - node.minimumCount];
+    for (NSUInteger i = node.minimumCount; i < node.maximumCount; ++i) {
+        NSUInteger splitIndex = [self emitInstructionWithOpcode:TWTRegularExpressionOpcodeSplit];
+        if (splitIndex == NSNotFound) {
+            return NO;
+        }
+
+        [self instructionAtIndex:splitIndex]->target1 = (uint32_t)(splitIndex + 1);
+        [splitIndexes addObject:@(splitIndex)];
+        if (![self emitNode:child]) {
+            return NO;
+        }
+    }
+
+    for (NSNumber *splitIndex in splitIndexes) {
+        [self instructionAtIndex:splitIndex.unsignedIntegerValue]->target2 = (uint32_t)self.instructionCount;
+    }
+
+    return YES;
+}
+
+@end
+
+
+#pragma mark - Matching
+
+/*!
+ TWTRegularExpressionThreadLists are sparse sets of instruction indexes, which can be cleared in constant time and
+ iterated in insertion order.
+ */
+typedef struct _TWTRegularExpressionThreadList {
+    uint32_t *dense;
+    uint32_t *sparse;
+    NSUInteger count;
+} TWTRegularExpressionThreadList;
+
+
+static inline BOOL TWTRegularExpressionThreadListContains(const TWTRegularExpressionThreadList *list, uint32_t index)
+{
+    uint32_t denseIndex = list->sparse[index];
+    return denseIndex < list->count && list->dense[denseIndex] == index;
+}
+
+
+static inline void TWTRegularExpressionThreadListInsert(TWTRegularExpressionThreadList *list, uint32_t index)
+{
+    list->sparse[index] = (uint32_t)list->count;
+    list->dense[list->count++] = index;
+}
+
+
+/*!
+ @abstract Returns whether a position in a string is at its end or before a line terminator that ends it.
+ */
+static inline BOOL TWTRegularExpressionIsAtEnd(CFStringInlineBuffer *buffer, CFIndex length, CFIndex position)
+{
+    if (position == length) {
+        return YES;
+    } else if (position == length - 1) {
+        return TWTRegularExpressionIsLineTerminator(CFStringGetCharacterFromInlineBuffer(buffer, position));
+    }
+
+    return position == length - 2 && CFStringGetCharacterFromInlineBuffer(buffer, position) == '\r' &&
+        CFStringGetCharacterFromInlineBuffer(buffer, position + 1) == '\n';
+}
+
+
+/*!
+ @abstract Adds an instruction and every instruction reachable from it without consuming a character to a thread
+     list.
+ @param program The program’s instructions.
+ @param list The thread list.
+ @param stack Scratch space for at least twice as many instruction indexes as there are instructions in the program.
+ @param index The index of the instruction to add.
+ @param buffer The string being matched.
+ @param length The length of the string.
+ @param position The position in the string at which the instructions will run.
+ @result Whether a match instruction was reached.
+ */
+static BOOL TWTRegularExpressionThreadListAddClosure(const TWTRegularExpressionInstruction *program,
+                                                     TWTRegularExpressionThreadList *list,
+                                                     uint32_t *stack,
+                                                     uint32_t index,
+                                                     CFStringInlineBuffer *buffer,
+                                                     CFIndex length,
+                                                     CFIndex position)
+{
+    NSUInteger stackCount = 0;
+    stack[stackCount++] = index;
+
+    while (stackCount) {
+        uint32_t instructionIndex = stack[--stackCount];
+        if (TWTRegularExpressionThreadListContains(list, instructionIndex)) {
+            continue;
+        }
+
+        TWTRegularExpressionThreadListInsert(list, instructionIndex);
+
+        const TWTRegularExpressionInstruction *instruction = &program[instructionIndex];
+        switch (instruction->opcode) {
+            case TWTRegularExpressionOpcodeMatch:
+                return YES;
+            case TWTRegularExpressionOpcodeJump:
+                stack[stackCount++] = instruction->target1;
+                break;
+            case TWTRegularExpressionOpcodeSplit:
+                stack[stackCount++] = instruction->target2;
+                stack[stackCount++] = instruction->target1;
+                break;
+            case TWTRegularExpressionOpcodeAssertStart:
+                if (position == 0) {
+                    stack[stackCount++] = instructionIndex + 1;
+                }
+                break;
+            case TWTRegularExpressionOpcodeAssertEnd:
+                if (TWTRegularExpressionIsAtEnd(buffer, length, position)) {
+                    stack[stackCount++] = instructionIndex + 1;
+                }
+                break;
+            default:
+                // Instructions that consume characters run when the list is stepped
+                break;
+        }
+    }
+
+    return NO;
+}
+
+
+#pragma mark
+
+@interface TWTRegularExpressionMatcher ()
+
+@property (nonatomic, copy, readwrite) NSString *pattern;
+
+@end
+
+
+@implementation TWTRegularExpressionMatcher {
+    // The compiled pattern, which is never mutated after initialization
+    NSData *_instructions;
+    NSData *_characterClasses;
+    NSData *_ranges;
+    NSUInteger _instructionCount;
+    BOOL _anchored;
+}
+
+- (instancetype)init
+{
+    return [self initWithRegularExpression:nil matchingOptions:0];
+}
+
+
+- (instancetype)initWithRegularExpression:(NSRegularExpression *)regularExpression matchingOptions:(NSMatchingOptions)options
+{
+    NSParameterAssert(regularExpression);
+
+    // Only the dot-all option changes how supported patterns match. Matching options that only affect how matches are
+    // reported don’t matter, and transparent bounds don’t matter when the entire string is searched
+    NSRegularExpressionOptions supportedExpressionOptions = NSRegularExpressionDotMatchesLineSeparators;
+    NSMatchingOptions supportedMatchingOptions = NSMatchingReportProgress | NSMatchingReportCompletion | NSMatchingAnchored |
+        NSMatchingWithTransparentBounds;
+    if ((regularExpression.options & ~supportedExpressionOptions) || (options & ~supportedMatchingOptions)) {
+        return nil;
+    }
+
+    BOOL dotMatchesLineTerminators = (regularExpression.options & NSRegularExpressionDotMatchesLineSeparators) != 0;
+    TWTRegularExpressionCompiler *compiler = [[TWTRegularExpressionCompiler alloc] initWithPattern:regularExpression.pattern
+                                                                            dotMatchesLineTerminators:dotMatchesLineTerminators];
+    if (![compiler compile]) {
+        return nil;
+    }
+
+    self = [super init];
+    if (self) {
+        _pattern = [regularExpression.pattern copy];
+        _instructions = [compiler->_instructions copy];
+        _characterClasses = [compiler->_characterClasses copy];
+        _ranges = [compiler->_ranges copy];
+        _instructionCount = _instructions.length / sizeof(TWTRegularExpressionInstruction);
+        _anchored = (options & NSMatchingAnchored) != 0;
+    }
+
+    return self;
+}
+
+
+- (TWTRegularExpressionMatchResult)resultOfMatchingString:(NSString *)string
+{
+    NSParameterAssert(string);
+
+    // Two thread lists, each with dense and sparse arrays, and a stack with room for two entries per instruction plus
+    // the first one
+    NSUInteger scratchCount = _instructionCount * 6 + 1;
+    uint32_t stackScratch[TWTRegularExpressionMatcherStackInstructionCount * 6 + 1];
+    uint32_t *scratch = stackScratch;
+    if (_instructionCount > TWTRegularExpressionMatcherStackInstructionCount) {
+        scratch = malloc(scratchCount * sizeof(uint32_t));
+    }
+
+    // Sparse arrays are zeroed so that membership checks never read uninitialized memory
+    TWTRegularExpressionThreadList lists[2] = {
+        { .dense = scratch, .sparse = scratch + _instructionCount, .count = 0 },
+        { .dense = scratch + _instructionCount * 2, .sparse = scratch + _instructionCount * 3, .count = 0 }
+    };
+
+    memset(lists[0].sparse, 0, _instructionCount * sizeof(uint32_t));
+    memset(lists[1].sparse, 0, _instructionCount * sizeof(uint32_t));
+    uint32_t *stack = scratch + _instructionCount * 4;
+
+    TWTRegularExpressionMatchResult result = [self resultOfMatchingString:string lists:lists stack:stack];
+
+    if (scratch != stackScratch) {
+        free(scratch);
+    }
+
+    return result;
+}
+
+
+- (TWTRegularExpressionMatchResult)resultOfMatchingString:(NSString *)string
+                                                    lists:(TWTRegularExpressionThreadList *)lists
+                                                    stack:(uint32_t *)stack
+{
+    const TWTRegularExpressionInstruction *program = _instructions.bytes;
+    const TWTRegularExpressionCharacterClass *characterClasses = _characterClasses.bytes;
+    const UTF32Char *ranges = _ranges.bytes;
+
+    CFStringRef cfString = (__bridge CFStringRef)string;
+    CFIndex length = CFStringGetLength(cfString);
+    CFStringInlineBuffer buffer;
+    CFStringInitInlineBuffer(cfString, &buffer, CFRangeMake(0, length));
+
+    TWTRegularExpressionThreadList *currentList = &lists[0];
+    TWTRegularExpressionThreadList *nextList = &lists[1];
+    if (TWTRegularExpressionThreadListAddClosure(program, currentList, stack, 0, &buffer, length, 0)) {
+        return TWTRegularExpressionMatchResultMatch;
+    }
+
+    CFIndex position = 0;
+    while (position < length && currentList->count) {
+        // Decode the next code point, treating unpaired surrogates as characters in their own right
+        UTF32Char character = CFStringGetCharacterFromInlineBuffer(&buffer, position);
+        CFIndex nextPosition = position + 1;
+        if (CFStringIsSurrogateHighCharacter(character) && nextPosition < length) {
+            UniChar lowSurrogate = CFStringGetCharacterFromInlineBuffer(&buffer, nextPosition);
+            if (CFStringIsSurrogateLowCharacter(lowSurrogate)) {
+                character = CFStringGetLongCharacterForSurrogatePair(character, lowSurrogate);
+                ++nextPosition;
+            }
+        }
+
+        nextList->count = 0;
+        for (NSUInteger i = 0; i < currentList->count; ++i) {
+            uint32_t instructionIndex = currentList->dense[i];
+            const TWTRegularExpressionInstruction *instruction = &program[instructionIndex];
+
+            BOOL consumes = NO;
+            switch (instruction->opcode) {
+                case TWTRegularExpressionOpcodeCharacter:
+                    consumes = instruction->character == character;
+                    break;
+                case TWTRegularExpressionOpcodeAnyCharacterExceptLineTerminator:
+                    consumes = !TWTRegularExpressionIsLineTerminator(character);
+                    break;
+                case TWTRegularExpressionOpcodeAnyCharacter:
+                    consumes = YES;
+                    break;
+                case TWTRegularExpressionOpcodeCharacterClass: {
+                    TWTRegularExpressionMembership membership = TWTRegularExpressionCharacterClassMembership(&characterClasses[instruction->target1], ranges, character);
+                    if (membership == TWTRegularExpressionMembershipUnknown) {
+                        return TWTRegularExpressionMatchResultUndecided;
+                    }
+
+                    consumes = membership == TWTRegularExpressionMembershipYes;
+                    break;
+                }
+                default:
+                    break;
+            }
+
+            if (consumes && TWTRegularExpressionThreadListAddClosure(program, nextList, stack, instructionIndex + 1, &buffer, length, nextPosition)) {
+                return TWTRegularExpressionMatchResultMatch;
+            }
+        }
+
+        // Unless matches must start at the beginning of the string, a match may start at any position
+        if (!_anchored && TWTRegularExpressionThreadListAddClosure(program, nextList, stack, 0, &buffer, length, nextPosition)) {
+            return TWTRegularExpressionMatchResultMatch;
+        }
+
+        TWTRegularExpressionThreadList *list = currentList;
+        currentList = nextList;
+        nextList = list;
+        position = nextPosition;
+    }
+
+    return TWTRegularExpressionMatchResultNoMatch;
+}
+
+@end
@@ -28,7 +28,8 @@
 
 @class TWTBoundedLengthStringValidator, TWTBoundedComposedCharacterLengthStringValidator,
        TWTRegularExpressionStringValidator, TWTPrefixStringValidator, TWTSuffixStringValidator,
-       TWTSubstringStringValidator, TWTWildcardPatternStringValidator, TWTCharacterSetStringValidator;
+       TWTSubstringStringValidator, TWTWildcardPatternStringValidator, TWTCharacterSetStringValidator,
+       TWTBoundedLengthCharacterSetStringValidator;
 
 
 /*!
@@ -137,6 +138,20 @@
  */
 + (TWTCharacterSetStringValidator *)stringValidatorWithCharacterSet:(NSCharacterSet *)characterSet;
 
+/*!
+ @abstract Creates and returns a new bounded length character set string validator with the specified character set
+     and minimum and maximum lengths.
+ @param characterSet The set of characters that can result in a valid string.
+ @param minimumLength The minimum string length that the validator considers valid. 0 indicates no minimum length.
+ @param maximumLength The maximum string length that the validator considers valid. NSUIntegerMax indicates no maximum
+     length.
+ @result A newly created string validator that validates that strings have only characters in the specified character
+     set and lengths within the specified bounds.
+ */
++ (TWTBoundedLengthCharacterSetStringValidator *)stringValidatorWithCharacterSet:(NSCharacterSet *)characterSet
+                                                                    minimumLength:(NSUInteger)minimumLength
+                                                                    maximumLength:(NSUInteger)maximumLength;
+
 @end
 
 
@@ -341,3 +356,43 @@
 - (instancetype)initWithCharacterSet:(NSCharacterSet *)characterSet;
 
 @end
+
+
+/*!
+ TWTBoundedLengthCharacterSetStringValidators validate that strings have only characters from a character set and
+ lengths within minimum and maximum values, i.e., that strings match regular expressions like ^[0-9a-f]{32}$. Lengths
+ are measured in UTF-16 code units, so they’re equal to the number of characters when the character set contains only
+ characters in the Basic Multilingual Plane. There is no need to create instances of this class directly. Instead, use
+ the appropriate factory method on TWTStringValidator. This class is exposed so that it may be easily subclassed if
+ necessary.
+ */
+@interface TWTBoundedLengthCharacterSetStringValidator : TWTCharacterSetStringValidator
+
+/*!
+ @abstract The minimum length that the validator considers valid.
+ @discussion The default is 0, which indicates no minimum length.
+ */
+@property (nonatomic, assign, readonly) NSUInteger minimumLength;
+
+/*!
+ @abstract The maximum length that the validator considers valid.
+ @discussion The default is NSUIntegerMax, which indicates no maximum length.
+ */
+@property (nonatomic, assign, readonly) NSUInteger maximumLength;
+
+/*!
+ @abstract Initializes a new bounded length character set string validator with the specified character set and
+     minimum and maximum lengths.
+ @discussion This is the class’s designated initializer.
+ @param characterSet The set of characters that can result in a valid string. If nil, only the string’s length is
+     validated.
+ @param minimumLength The minimum string length that the validator considers valid. 0 indicates no minimum length.
+ @param maximumLength The maximum string length that the validator considers valid. NSUIntegerMax indicates no maximum
+     length.
+ @result An initialized bounded length character set string validator.
+ */
+- (instancetype)initWithCharacterSet:(NSCharacterSet *)characterSet
+                       minimumLength:(NSUInteger)minimumLength
+                       maximumLength:(NSUInteger)maximumLength;
+
+@end
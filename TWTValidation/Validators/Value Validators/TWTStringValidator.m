@@ -26,8 +26,10 @@
 
 #import <TWTValidation/TWTStringValidator.h>
 
+#import <TWTValidation/TWTRegularExpressionMatcher.h>
 #import <TWTValidation/TWTValidationErrors.h>
 #import <TWTValidation/TWTValidationLocalization.h>
+#import <TWTValidation/TWTWildcardPatternMatcher.h>
 
 
 @interface TWTBoundedLengthStringValidator ()
@@ -45,6 +47,9 @@
 @property (nonatomic, strong, readwrite) NSRegularExpression *regularExpression;
 @property (nonatomic, assign, readwrite) NSMatchingOptions options;
 
+// Matches strings in linear time if the regular expression is supported by TWTRegularExpressionMatcher. nil otherwise
+@property (nonatomic, strong) TWTRegularExpressionMatcher *matcher;
+
 @end
 
 #pragma mark
@@ -80,22 +85,68 @@
 
 @interface TWTWildcardPatternStringValidator ()
 
-@property (nonatomic, strong) NSPredicate *predicate;
 @property (nonatomic, copy, readwrite) NSString *pattern;
 @property (nonatomic, assign, readwrite, getter = isCaseSensitive) BOOL caseSensitive;
 
+// Matches strings without NSPredicate if the pattern is supported by TWTWildcardPatternMatcher. nil otherwise
+@property (nonatomic, strong) TWTWildcardPatternMatcher *matcher;
+
+// Matches strings that the matcher can’t. Created with the matcher so that validators are immutable once initialized
+@property (nonatomic, strong) NSPredicate *predicate;
+
 @end
 
 #pragma mark
 
+/*!
+ TWTCharacterSetASCIIBitmaps describe the ASCII characters in a character set. If the set has only ASCII characters,
+ strings can be checked against the bitmap without consulting the set at all.
+ */
+typedef struct _TWTCharacterSetASCIIBitmap {
+    uint64_t bits[2];
+
+    // Whether the character set contains only ASCII characters, i.e., whether the bitmap describes it completely
+    BOOL isComplete;
+} TWTCharacterSetASCIIBitmap;
+
+
 @interface TWTCharacterSetStringValidator ()
 
 @property (nonatomic, copy, readwrite) NSCharacterSet *characterSet;
+
+// Both of these are derived from the character set when the validator is initialized, so that they are never
+// computed while validating, possibly on several threads at once
 @property (nonatomic, copy) NSCharacterSet *invertedCharacterSet;
+@property (nonatomic, assign) TWTCharacterSetASCIIBitmap ASCIIBitmap;
 
 @end
 
 
+#pragma mark
+
+@interface TWTBoundedLengthCharacterSetStringValidator ()
+
+@property (nonatomic, assign, readwrite) NSUInteger minimumLength;
+@property (nonatomic, assign, readwrite) NSUInteger maximumLength;
+
+@end
+
+
+/*!
+ @abstract Returns whether the specified validator uses the specified class’s implementation of -validateValue:error:.
+ @discussion String validator subclasses use this to determine if their batch validation fast paths are equivalent to
+     validating each value with -validateValue:error:. If a subclass overrides -validateValue:error:, they are not.
+ @param validator The validator.
+ @param class The class whose implementation should be checked.
+ @result Whether the validator uses the class’s implementation of -validateValue:error:.
+ */
+static inline BOOL TWTStringValidatorUsesValidationImplementationOfClass(TWTValidator *validator, Class class)
+{
+    SEL selector = @selector(validateValue:error:);
+    return [validator methodForSelector:selector] == [class instanceMethodForSelector:selector];
+}
+
+
 #pragma mark
 
 @implementation TWTStringValidator
@@ -164,6 +215,14 @@
     return [[TWTCharacterSetStringValidator alloc] initWithCharacterSet:characterSet];
 }
 
+
++ (TWTBoundedLengthCharacterSetStringValidator *)stringValidatorWithCharacterSet:(NSCharacterSet *)characterSet
+                                                                    minimumLength:(NSUInteger)minimumLength
+                                                                    maximumLength:(NSUInteger)maximumLength
+{
+    return [[TWTBoundedLengthCharacterSetStringValidator alloc] initWithCharacterSet:characterSet minimumLength:minimumLength maximumLength:maximumLength];
+}
+
 @end
 
 
@@ -239,21 +298,17 @@
     }
 
     if (outError) {
-        NSString *description = nil;
-        switch (errorCode) {
-            case TWTValidationErrorCodeLengthLessThanMinimum: {
-                NSString *descriptionFormat = TWTLocalizedString(@"TWTBoundedLengthStringValidator.lengthLessThanMinimum.validationError.format");
-                description = [NSString stringWithFormat:descriptionFormat, (unsigned long)length, (unsigned long)self.minimumLength];
-                break;
+        NSUInteger minimumLength = self.minimumLength;
+        *outError = [NSError twt_validationErrorWithCode:errorCode failingValidator:self value:value localizedDescriptionBlock:^NSString *{
+            NSString *descriptionFormat = nil;
+            if (errorCode == TWTValidationErrorCodeLengthLessThanMinimum) {
+                descriptionFormat = TWTLocalizedString(@"TWTBoundedLengthStringValidator.lengthLessThanMinimum.validationError.format");
+            } else {
+                descriptionFormat = TWTLocalizedString(@"TWTBoundedLengthStringValidator.lengthGreaterThanMaximum.validationError.format");
             }
-            case TWTValidationErrorCodeLengthGreaterThanMaximum: {
-                NSString *descriptionFormat = TWTLocalizedString(@"TWTBoundedLengthStringValidator.lengthGreaterThanMaximum.validationError.format");
-                description = [NSString stringWithFormat:descriptionFormat, (unsigned long)length, (unsigned long)self.minimumLength];
-                break;
-            }
-        }
 
-        *outError = [NSError twt_validationErrorWithCode:errorCode failingValidator:self value:value localizedDescription:description];
+            return [NSString stringWithFormat:descriptionFormat, (unsigned long)length, (unsigned long)minimumLength];
+        }];
     }
     
     return NO;
@@ -265,6 +320,22 @@
     return [string length];
 }
 
+
+- (BOOL)validateValues:(NSArray *)values results:(out NSIndexSet *__autoreleasing *)outInvalidIndexes
+{
+    if (!TWTStringValidatorUsesValidationImplementationOfClass(self, [TWTBoundedLengthStringValidator class])) {
+        return [super validateValues:values results:outInvalidIndexes];
+    }
+
+    NSUInteger minimumLength = self.minimumLength;
+    NSUInteger maximumLength = self.maximumLength;
+
+    return [self validateValues:values results:outInvalidIndexes passingTest:^BOOL(id value) {
+        NSUInteger length = [self lengthOfString:value];
+        return length >= minimumLength && length <= maximumLength;
+    }];
+}
+
 @end
 
 
@@ -274,7 +345,22 @@
 
 - (NSUInteger)lengthOfString:(NSString *)string
 {
-    return [string lengthOfBytesUsingEncoding:NSUTF32StringEncoding] / 4;
+    // Count code points directly, skipping the low half of each surrogate pair, rather than measuring the string’s
+    // UTF-32 encoding, which converts the entire string
+    CFStringRef cfString = (__bridge CFStringRef)string;
+    CFIndex length = CFStringGetLength(cfString);
+    CFStringInlineBuffer buffer;
+    CFStringInitInlineBuffer(cfString, &buffer, CFRangeMake(0, length));
+
+    NSUInteger codePointCount = 0;
+    for (CFIndex i = 0; i < length; ++i, ++codePointCount) {
+        if (CFStringIsSurrogateHighCharacter(CFStringGetCharacterFromInlineBuffer(&buffer, i)) && i + 1 < length &&
+            CFStringIsSurrogateLowCharacter(CFStringGetCharacterFromInlineBuffer(&buffer, i + 1))) {
+            ++i;
+        }
+    }
+
+    return codePointCount;
 }
 
 @end
@@ -282,6 +368,28 @@
 
 #pragma mark
 
+/*!
+ @abstract Returns whether a string contains a match for a regular expression.
+ @discussion Uses the matcher if possible, and otherwise stops the regular expression at the first match rather than
+     counting every match.
+ @param regularExpression The regular expression. May not be nil.
+ @param options The matching options for the regular expression.
+ @param matcher The matcher for the regular expression. May be nil if the regular expression isn’t supported.
+ @param string The string.
+ @result Whether the string contains a match.
+ */
+static BOOL TWTRegularExpressionStringValidatorMatchesString(NSRegularExpression *regularExpression, NSMatchingOptions options,
+                                                              TWTRegularExpressionMatcher *matcher, NSString *string)
+{
+    TWTRegularExpressionMatchResult result = matcher ? [matcher resultOfMatchingString:string] : TWTRegularExpressionMatchResultUndecided;
+    if (result != TWTRegularExpressionMatchResultUndecided) {
+        return result == TWTRegularExpressionMatchResultMatch;
+    }
+
+    return [regularExpression rangeOfFirstMatchInString:string options:options range:NSMakeRange(0, string.length)].location != NSNotFound;
+}
+
+
 @implementation TWTRegularExpressionStringValidator
 
 - (instancetype)init
@@ -296,6 +404,7 @@
     if (self) {
         _regularExpression = regularExpression;
         _options = options;
+        _matcher = regularExpression ? [[TWTRegularExpressionMatcher alloc] initWithRegularExpression:regularExpression matchingOptions:options] : nil;
     }
 
     return self;
@@ -307,6 +416,7 @@
     typeof(self) copy = [super copyWithZone:zone];
     copy.regularExpression = self.regularExpression;
     copy.options = self.options;
+    copy.matcher = self.matcher;
     return copy;
 }
 
@@ -334,23 +444,41 @@
     if (![super validateValue:value error:outError]) {
         return NO;
     } else if (TWTValidatorValueIsNilOrNull(value) || !self.regularExpression ||
-               [self.regularExpression numberOfMatchesInString:value options:self.options range:NSMakeRange(0, [value length])]) {
+               TWTRegularExpressionStringValidatorMatchesString(self.regularExpression, self.options, self.matcher, value)) {
         // If nil/null weren't allowed, super’s -validateValue:error: would have failed
         return YES;
     }
 
     if (outError) {
-        NSString *descriptionFormat = TWTLocalizedString(@"TWTRegularExpressionStringValidator.validationError.format");
-        NSString *description = [NSString stringWithFormat:descriptionFormat, [self.regularExpression pattern]];
+        NSString *pattern = [self.regularExpression pattern];
         *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueDoesNotMatchFormat
                                         failingValidator:self
                                                    value:value
-                                    localizedDescription:description];
+                               localizedDescriptionBlock:^{
+                                   NSString *descriptionFormat = TWTLocalizedString(@"TWTRegularExpressionStringValidator.validationError.format");
+                                   return [NSString stringWithFormat:descriptionFormat, pattern];
+                               }];
     }
 
     return NO;
 }
 
+
+- (BOOL)validateValues:(NSArray *)values results:(out NSIndexSet *__autoreleasing *)outInvalidIndexes
+{
+    if (!TWTStringValidatorUsesValidationImplementationOfClass(self, [TWTRegularExpressionStringValidator class])) {
+        return [super validateValues:values results:outInvalidIndexes];
+    }
+
+    NSRegularExpression *regularExpression = self.regularExpression;
+    NSMatchingOptions options = self.options;
+    TWTRegularExpressionMatcher *matcher = self.matcher;
+
+    return [self validateValues:values results:outInvalidIndexes passingTest:!regularExpression ? nil : ^BOOL(id value) {
+        return TWTRegularExpressionStringValidatorMatchesString(regularExpression, options, matcher, value);
+    }];
+}
+
 @end
 
 #pragma mark
@@ -418,16 +546,33 @@
     }
 
     if (outError) {
-        NSString *description = [NSString stringWithFormat:TWTLocalizedString(@"TWTPrefixStringValidator.validationError.format"), self.prefix];
+        NSString *prefix = self.prefix;
         *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueDoesNotMatchFormat
                                         failingValidator:self
                                                    value:value
-                                    localizedDescription:description];
+                               localizedDescriptionBlock:^{
+                                   return [NSString stringWithFormat:TWTLocalizedString(@"TWTPrefixStringValidator.validationError.format"), prefix];
+                               }];
     }
     
     return NO;
 }
 
+
+- (BOOL)validateValues:(NSArray *)values results:(out NSIndexSet *__autoreleasing *)outInvalidIndexes
+{
+    if (!TWTStringValidatorUsesValidationImplementationOfClass(self, [TWTPrefixStringValidator class])) {
+        return [super validateValues:values results:outInvalidIndexes];
+    }
+
+    NSString *prefix = self.prefix;
+    NSStringCompareOptions options = (self.isCaseSensitive ? 0 : NSCaseInsensitiveSearch) | NSAnchoredSearch;
+
+    return [self validateValues:values results:outInvalidIndexes passingTest:!prefix ? nil : ^BOOL(id value) {
+        return [value rangeOfString:prefix options:options].location != NSNotFound;
+    }];
+}
+
 @end
 
 
@@ -496,16 +641,33 @@
     }
     
     if (outError) {
-        NSString *description = [NSString stringWithFormat:TWTLocalizedString(@"TWTSuffixStringValidator.validationError.format"), self.suffix];
+        NSString *suffix = self.suffix;
         *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueDoesNotMatchFormat
                                         failingValidator:self
                                                    value:value
-                                    localizedDescription:description];
+                               localizedDescriptionBlock:^{
+                                   return [NSString stringWithFormat:TWTLocalizedString(@"TWTSuffixStringValidator.validationError.format"), suffix];
+                               }];
     }
     
     return NO;
 }
 
+
+- (BOOL)validateValues:(NSArray *)values results:(out NSIndexSet *__autoreleasing *)outInvalidIndexes
+{
+    if (!TWTStringValidatorUsesValidationImplementationOfClass(self, [TWTSuffixStringValidator class])) {
+        return [super validateValues:values results:outInvalidIndexes];
+    }
+
+    NSString *suffix = self.suffix;
+    NSStringCompareOptions options = (self.isCaseSensitive ? 0 : NSCaseInsensitiveSearch) | NSAnchoredSearch | NSBackwardsSearch;
+
+    return [self validateValues:values results:outInvalidIndexes passingTest:!suffix ? nil : ^BOOL(id value) {
+        return [value rangeOfString:suffix options:options].location != NSNotFound;
+    }];
+}
+
 @end
 
 
@@ -574,21 +736,57 @@
     }
     
     if (outError) {
-        NSString *description = [NSString stringWithFormat:TWTLocalizedString(@"TWTSubstringStringValidator.validationError.format"), self.substring];
+        NSString *substring = self.substring;
         *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueDoesNotMatchFormat
                                         failingValidator:self
                                                    value:value
-                                    localizedDescription:description];
+                               localizedDescriptionBlock:^{
+                                   return [NSString stringWithFormat:TWTLocalizedString(@"TWTSubstringStringValidator.validationError.format"), substring];
+                               }];
     }
     
     return NO;
 }
 
+
+- (BOOL)validateValues:(NSArray *)values results:(out NSIndexSet *__autoreleasing *)outInvalidIndexes
+{
+    if (!TWTStringValidatorUsesValidationImplementationOfClass(self, [TWTSubstringStringValidator class])) {
+        return [super validateValues:values results:outInvalidIndexes];
+    }
+
+    NSString *substring = self.substring;
+    NSStringCompareOptions options = self.isCaseSensitive ? 0 : NSCaseInsensitiveSearch;
+
+    return [self validateValues:values results:outInvalidIndexes passingTest:!substring ? nil : ^BOOL(id value) {
+        return [value rangeOfString:substring options:options].location != NSNotFound;
+    }];
+}
+
 @end
 
 
 #pragma mark
 
+/*!
+ @abstract Returns whether a string matches a wildcard pattern.
+ @discussion Uses the matcher if possible, and otherwise evaluates the LIKE predicate.
+ @param matcher The matcher for the pattern. May be nil if the pattern isn’t supported.
+ @param predicate The LIKE predicate for the pattern. May not be nil.
+ @param string The string.
+ @result Whether the string matches the pattern.
+ */
+static BOOL TWTWildcardPatternStringValidatorMatchesString(TWTWildcardPatternMatcher *matcher, NSPredicate *predicate, NSString *string)
+{
+    TWTWildcardPatternMatchResult result = matcher ? [matcher resultOfMatchingString:string] : TWTWildcardPatternMatchResultUndecided;
+    if (result != TWTWildcardPatternMatchResultUndecided) {
+        return result == TWTWildcardPatternMatchResultMatch;
+    }
+
+    return [predicate evaluateWithObject:string];
+}
+
+
 @implementation TWTWildcardPatternStringValidator
 
 - (instancetype)init
@@ -603,6 +801,12 @@
     if (self) {
         _pattern = [pattern copy];
         _caseSensitive = caseSensitive;
+
+        if (pattern) {
+            _matcher = [[TWTWildcardPatternMatcher alloc] initWithPattern:pattern caseSensitive:caseSensitive];
+            NSString *predicateString = [NSString stringWithFormat:@"SELF LIKE%@ %%@", caseSensitive ? @"" : @"[c]"];
+            _predicate = [NSPredicate predicateWithFormat:predicateString, pattern];
+        }
     }
     return self;
 }
@@ -613,6 +817,8 @@
     typeof(self) copy = [super copyWithZone:zone];
     copy.pattern = self.pattern;
     copy.caseSensitive = self.isCaseSensitive;
+    copy.matcher = self.matcher;
+    copy.predicate = self.predicate;
     return copy;
 }
 
@@ -623,17 +829,6 @@
 }
 
 
-- (NSPredicate *)predicate
-{
-    if (self.pattern && !_predicate) {
-        NSString *predicateString = [NSString stringWithFormat:@"SELF LIKE%@ %%@", self.isCaseSensitive ? @"" : @"[c]"];
-        self.predicate = [NSPredicate predicateWithFormat:predicateString, self.pattern];
-    }
-
-    return _predicate;
-}
-
-
 - (BOOL)isEqual:(id)object
 {
     if (![super isEqual:object]) {
@@ -656,26 +851,180 @@
         return YES;
     }
     
-    if ([self.predicate evaluateWithObject:value]) {
+    if (TWTWildcardPatternStringValidatorMatchesString(self.matcher, self.predicate, value)) {
         return YES;
     }
 
     if (outError) {
-        NSString *description = [NSString stringWithFormat:TWTLocalizedString(@"TWTWildcardPatternStringValidatator.validationError.format"), self.pattern];
+        NSString *pattern = self.pattern;
         *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueDoesNotMatchFormat
                                         failingValidator:self
                                                    value:value
-                                    localizedDescription:description];
+                               localizedDescriptionBlock:^{
+                                   return [NSString stringWithFormat:TWTLocalizedString(@"TWTWildcardPatternStringValidatator.validationError.format"), pattern];
+                               }];
     }
     
     return NO;
 }
 
+
+- (BOOL)validateValues:(NSArray *)values results:(out NSIndexSet *__autoreleasing *)outInvalidIndexes
+{
+    if (!TWTStringValidatorUsesValidationImplementationOfClass(self, [TWTWildcardPatternStringValidator class])) {
+        return [super validateValues:values results:outInvalidIndexes];
+    }
+
+    TWTWildcardPatternMatcher *matcher = self.matcher;
+    NSPredicate *predicate = self.predicate;
+
+    return [self validateValues:values results:outInvalidIndexes passingTest:!predicate ? nil : ^BOOL(id value) {
+        return TWTWildcardPatternStringValidatorMatchesString(matcher, predicate, value);
+    }];
+}
+
 @end
 
 
 #pragma mark
 
+static TWTCharacterSetASCIIBitmap TWTCharacterSetASCIIBitmapMake(NSCharacterSet *characterSet)
+{
+    TWTCharacterSetASCIIBitmap bitmap = { { 0, 0 }, NO };
+    if (!characterSet) {
+        return bitmap;
+    }
+
+    NSMutableCharacterSet *ASCIICharacterSet = [[NSMutableCharacterSet alloc] init];
+    for (unichar character = 0; character < 128; ++character) {
+        if ([characterSet characterIsMember:character]) {
+            bitmap.bits[character >> 6] |= 1ULL << (character & 63);
+            [ASCIICharacterSet addCharactersInRange:NSMakeRange(character, 1)];
+        }
+    }
+
+    bitmap.isComplete = [ASCIICharacterSet isSupersetOfSet:characterSet];
+    return bitmap;
+}
+
+
+static inline uint64_t TWTCharacterSetASCIIBitmapMembership(const TWTCharacterSetASCIIBitmap *bitmap, uint8_t character)
+{
+    return (bitmap->bits[character >> 6] >> (character & 63)) & 1;
+}
+
+
+/*!
+ @abstract Returns whether every UTF-16 character in a buffer is in a complete ASCII bitmap.
+ @discussion Characters are checked four at a time. Each chunk of four is first checked for non-ASCII characters with a
+     single mask, and its characters are then looked up in the bitmap without branching.
+ */
+static BOOL TWTCharacterSetASCIIBitmapContainsCharacters(const TWTCharacterSetASCIIBitmap *bitmap, const UniChar *characters, NSUInteger count)
+{
+    NSUInteger i = 0;
+    for (; i + 4 <= count; i += 4) {
+        uint64_t chunk;
+        memcpy(&chunk, &characters[i], sizeof(chunk));
+        if (chunk & 0xFF80FF80FF80FF80ULL) {
+            return NO;
+        }
+
+        uint64_t membership = TWTCharacterSetASCIIBitmapMembership(bitmap, characters[i]) & TWTCharacterSetASCIIBitmapMembership(bitmap, characters[i + 1]) &
+            TWTCharacterSetASCIIBitmapMembership(bitmap, characters[i + 2]) & TWTCharacterSetASCIIBitmapMembership(bitmap, characters[i + 3]);
+        if (!membership) {
+            return NO;
+        }
+    }
+
+    for (; i < count; ++i) {
+        if (characters[i] > 0x7F || !TWTCharacterSetASCIIBitmapMembership(bitmap, characters[i])) {
+            return NO;
+        }
+    }
+
+    return YES;
+}
+
+
+/*!
+ @abstract Returns whether every byte in an 8-bit string buffer is an ASCII character in a complete ASCII bitmap.
+ @discussion This is the same as TWTCharacterSetASCIIBitmapContainsCharacters(), but checks eight bytes at a time.
+ */
+static BOOL TWTCharacterSetASCIIBitmapContainsBytes(const TWTCharacterSetASCIIBitmap *bitmap, const uint8_t *bytes, NSUInteger count)
+{
+    NSUInteger i = 0;
+    for (; i + 8 <= count; i += 8) {
+        uint64_t chunk;
+        memcpy(&chunk, &bytes[i], sizeof(chunk));
+        if (chunk & 0x8080808080808080ULL) {
+            return NO;
+        }
+
+        uint64_t membership = 1;
+        for (NSUInteger j = 0; j < 8; ++j) {
+            membership &= TWTCharacterSetASCIIBitmapMembership(bitmap, bytes[i + j]);
+        }
+
+        if (!membership) {
+            return NO;
+        }
+    }
+
+    for (; i < count; ++i) {
+        if (bytes[i] > 0x7F || !TWTCharacterSetASCIIBitmapMembership(bitmap, bytes[i])) {
+            return NO;
+        }
+    }
+
+    return YES;
+}
+
+
+/*!
+ @abstract Returns whether a string contains only characters in a character set.
+ @discussion If the set’s ASCII bitmap is complete, the string’s characters are checked against the bitmap directly
+     from the string’s UTF-16 or 8-bit buffer, or in chunks copied out of the string if it has neither. Otherwise, the
+     string is searched for a character in the inverted character set.
+ @param invertedCharacterSet The inverse of the character set. May not be nil.
+ @param bitmap The character set’s ASCII bitmap.
+ @param string The string.
+ @result Whether the string contains only characters in the character set.
+ */
+static BOOL TWTCharacterSetStringValidatorStringHasOnlyCharacters(NSCharacterSet *invertedCharacterSet, const TWTCharacterSetASCIIBitmap *bitmap,
+                                                                   NSString *string)
+{
+    if (!bitmap->isComplete) {
+        return [string rangeOfCharacterFromSet:invertedCharacterSet].location == NSNotFound;
+    }
+
+    CFStringRef cfString = (__bridge CFStringRef)string;
+    CFIndex length = CFStringGetLength(cfString);
+
+    const UniChar *characters = CFStringGetCharactersPtr(cfString);
+    if (characters) {
+        return TWTCharacterSetASCIIBitmapContainsCharacters(bitmap, characters, length);
+    }
+
+    // An 8-bit buffer is only returned if the string is stored in an encoding that’s a superset of ASCII, so each byte is
+    // one character, and non-ASCII characters have bytes above 0x7F
+    const char *bytes = CFStringGetCStringPtr(cfString, kCFStringEncodingUTF8);
+    if (bytes) {
+        return TWTCharacterSetASCIIBitmapContainsBytes(bitmap, (const uint8_t *)bytes, length);
+    }
+
+    UniChar buffer[64];
+    for (CFIndex location = 0; location < length; location += 64) {
+        CFIndex count = MIN(length - location, 64);
+        CFStringGetCharacters(cfString, CFRangeMake(location, count), buffer);
+        if (!TWTCharacterSetASCIIBitmapContainsCharacters(bitmap, buffer, count)) {
+            return NO;
+        }
+    }
+
+    return YES;
+}
+
+
 @implementation TWTCharacterSetStringValidator
 
 - (instancetype)init
@@ -688,7 +1037,9 @@
 {
     self = [super init];
     if (self) {
-        _characterSet = characterSet;
+        _characterSet = [characterSet copy];
+        _invertedCharacterSet = characterSet.invertedSet;
+        _ASCIIBitmap = TWTCharacterSetASCIIBitmapMake(characterSet);
     }
     return self;
 }
@@ -698,6 +1049,8 @@
 {
     typeof(self) copy = [super copyWithZone:zone];
     copy.characterSet = self.characterSet;
+    copy.invertedCharacterSet = self.invertedCharacterSet;
+    copy.ASCIIBitmap = self.ASCIIBitmap;
     return copy;
 }
 
@@ -721,16 +1074,6 @@
 }
 
 
-- (NSCharacterSet *)invertedCharacterSet
-{
-    if (!_invertedCharacterSet) {
-        self.invertedCharacterSet = self.characterSet.invertedSet;
-    }
-
-    return _invertedCharacterSet;
-}
-
-
 - (BOOL)validateValue:(id)value error:(out NSError *__autoreleasing *)outError
 {
     if (![super validateValue:value error:outError]) {
@@ -740,20 +1083,143 @@
         return YES;
     }
     
-    NSRange range = [value rangeOfCharacterFromSet:self.invertedCharacterSet];
-    if (range.location == NSNotFound) {
+    TWTCharacterSetASCIIBitmap bitmap = self.ASCIIBitmap;
+    if (TWTCharacterSetStringValidatorStringHasOnlyCharacters(self.invertedCharacterSet, &bitmap, value)) {
         return YES;
     }
     
     if (outError) {
-        NSString *description = TWTLocalizedString(@"TWTCharacterSetStringValidator.validationError");
         *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueDoesNotMatchFormat
                                         failingValidator:self
                                                    value:value
-                                    localizedDescription:description];
+                               localizedDescriptionBlock:^{ return TWTLocalizedString(@"TWTCharacterSetStringValidator.validationError"); }];
     }
     
     return NO;
 }
 
+
+- (BOOL)validateValues:(NSArray *)values results:(out NSIndexSet *__autoreleasing *)outInvalidIndexes
+{
+    if (!TWTStringValidatorUsesValidationImplementationOfClass(self, [TWTCharacterSetStringValidator class])) {
+        return [super validateValues:values results:outInvalidIndexes];
+    }
+
+    NSCharacterSet *invertedCharacterSet = self.characterSet ? self.invertedCharacterSet : nil;
+    TWTCharacterSetASCIIBitmap bitmap = self.ASCIIBitmap;
+
+    return [self validateValues:values results:outInvalidIndexes passingTest:!invertedCharacterSet ? nil : ^BOOL(id value) {
+        return TWTCharacterSetStringValidatorStringHasOnlyCharacters(invertedCharacterSet, &bitmap, value);
+    }];
+}
+
+@end
+
+
+#pragma mark
+
+@implementation TWTBoundedLengthCharacterSetStringValidator
+
+- (instancetype)initWithCharacterSet:(NSCharacterSet *)characterSet
+{
+    return [self initWithCharacterSet:characterSet minimumLength:0 maximumLength:NSUIntegerMax];
+}
+
+
+- (instancetype)initWithCharacterSet:(NSCharacterSet *)characterSet minimumLength:(NSUInteger)minimumLength maximumLength:(NSUInteger)maximumLength
+{
+    NSParameterAssert(minimumLength <= maximumLength);
+    self = [super initWithCharacterSet:characterSet];
+    if (self) {
+        _minimumLength = minimumLength;
+        _maximumLength = maximumLength;
+    }
+
+    return self;
+}
+
+
+- (instancetype)copyWithZone:(NSZone *)zone
+{
+    typeof(self) copy = [super copyWithZone:zone];
+    copy.minimumLength = self.minimumLength;
+    copy.maximumLength = self.maximumLength;
+    return copy;
+}
+
+
+- (NSUInteger)hash
+{
+    return [super hash] ^ self.minimumLength ^ self.maximumLength;
+}
+
+
+- (BOOL)isEqual:(id)object
+{
+    if (![super isEqual:object]) {
+        return NO;
+    } else if (self == object) {
+        return YES;
+    }
+
+    typeof(self) other = object;
+    return other.minimumLength == self.minimumLength && other.maximumLength == self.maximumLength;
+}
+
+
+- (BOOL)validateValue:(id)value error:(out NSError *__autoreleasing *)outError
+{
+    if (![super validateValue:value error:outError]) {
+        return NO;
+    } else if (TWTValidatorValueIsNilOrNull(value)) {
+        // This will only happen if nil or null is allowed
+        return YES;
+    }
+
+    NSInteger errorCode = -1;
+    NSUInteger length = [value length];
+    if (length < self.minimumLength) {
+        errorCode = TWTValidationErrorCodeLengthLessThanMinimum;
+    } else if (length > self.maximumLength) {
+        errorCode = TWTValidationErrorCodeLengthGreaterThanMaximum;
+    } else {
+        return YES;
+    }
+
+    if (outError) {
+        NSUInteger bound = errorCode == TWTValidationErrorCodeLengthLessThanMinimum ? self.minimumLength : self.maximumLength;
+        *outError = [NSError twt_validationErrorWithCode:errorCode failingValidator:self value:value localizedDescriptionBlock:^NSString *{
+            NSString *descriptionFormat = nil;
+            if (errorCode == TWTValidationErrorCodeLengthLessThanMinimum) {
+                descriptionFormat = TWTLocalizedString(@"TWTBoundedLengthStringValidator.lengthLessThanMinimum.validationError.format");
+            } else {
+                descriptionFormat = TWTLocalizedString(@"TWTBoundedLengthStringValidator.lengthGreaterThanMaximum.validationError.format");
+            }
+
+            return [NSString stringWithFormat:descriptionFormat, (unsigned long)length, (unsigned long)bound];
+        }];
+    }
+
+    return NO;
+}
+
+
+- (BOOL)validateValues:(NSArray *)values results:(out NSIndexSet *__autoreleasing *)outInvalidIndexes
+{
+    if (!TWTStringValidatorUsesValidationImplementationOfClass(self, [TWTBoundedLengthCharacterSetStringValidator class])) {
+        return [super validateValues:values results:outInvalidIndexes];
+    }
+
+    NSCharacterSet *invertedCharacterSet = self.characterSet ? self.invertedCharacterSet : nil;
+    TWTCharacterSetASCIIBitmap bitmap = self.ASCIIBitmap;
+    NSUInteger minimumLength = self.minimumLength;
+    NSUInteger maximumLength = self.maximumLength;
+
+    return [self validateValues:values results:outInvalidIndexes passingTest:^BOOL(id value) {
+        NSUInteger length = [value length];
+        return length >= minimumLength && length <= maximumLength &&
+            (!invertedCharacterSet || TWTCharacterSetStringValidatorStringHasOnlyCharacters(invertedCharacterSet, &bitmap, value));
+    }];
+}
+
 @end
@@ -63,6 +63,24 @@
  */
 + (instancetype)valueValidatorWithClass:(Class)valueClass allowsNil:(BOOL)allowsNil allowsNull:(BOOL)allowsNull;
 
+/*!
+ @abstract Returns whether all the values in the specified array pass the receiver’s null and value class
+     checks as well as the specified test.
+ @discussion This method is provided as a convenience for TWTValueValidator subclasses that override
+     -validateValues:results:. The receiver’s properties are read once for the entire array, and the results
+     of value class checks are reused for consecutive values of the same class. The test is only invoked for
+     values that are not the NSNull instance and are instances of the receiver’s value class.
+ @param values The values to validate. May not be nil.
+ @param outInvalidIndexes On return, contains the indexes of the values that are invalid. If NULL, no
+     indexes are returned.
+ @param test The block to test values that pass the receiver’s null and value class checks. The block returns
+     whether the value is valid. If nil, all values that pass those checks are valid.
+ @result Whether all the values are valid.
+ */
+- (BOOL)validateValues:(NSArray *)values
+               results:(out NSIndexSet *__autoreleasing *)outInvalidIndexes
+           passingTest:(BOOL (^)(id value))test;
+
 @end
 
 
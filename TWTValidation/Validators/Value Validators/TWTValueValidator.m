@@ -93,25 +93,77 @@
     
     // Construct the error based on the code
     if (outError) {
-        NSString *description = nil;
-        switch (errorCode) {
-            case TWTValidationErrorCodeValueNil:
-                description = TWTLocalizedString(@"TWTValidator.valueNil.validationError");
-                break;
-            case TWTValidationErrorCodeValueNull:
-                description = TWTLocalizedString(@"TWTValidator.valueNull.validationError");
-                break;
-            case TWTValidationErrorCodeValueHasIncorrectClass: {
-                NSString *descriptionFormat = TWTLocalizedString(@"TWTValueValidator.valueHasIncorrectClass.validationError.format");
-                description = [NSString stringWithFormat:descriptionFormat, [value class], self.valueClass];
-                break;
+        Class valueClass = self.valueClass;
+        *outError = [NSError twt_validationErrorWithCode:errorCode failingValidator:self value:value localizedDescriptionBlock:^NSString *{
+            switch (errorCode) {
+                case TWTValidationErrorCodeValueNil:
+                    return TWTLocalizedString(@"TWTValidator.valueNil.validationError");
+                case TWTValidationErrorCodeValueNull:
+                    return TWTLocalizedString(@"TWTValidator.valueNull.validationError");
+                default: {
+                    NSString *descriptionFormat = TWTLocalizedString(@"TWTValueValidator.valueHasIncorrectClass.validationError.format");
+                    return [NSString stringWithFormat:descriptionFormat, [value class], valueClass];
+                }
             }
-        }
-
-        *outError = [NSError twt_validationErrorWithCode:errorCode failingValidator:self value:value localizedDescription:description];
+        }];
     }
     
     return NO;
 }
 
+
+- (BOOL)validateValues:(NSArray *)values results:(out NSIndexSet *__autoreleasing *)outInvalidIndexes
+{
+    // Subclasses that override -validateValue:error: may perform additional checks that we don’t know about
+    if ([self methodForSelector:@selector(validateValue:error:)] != [TWTValueValidator instanceMethodForSelector:@selector(validateValue:error:)]) {
+        return [super validateValues:values results:outInvalidIndexes];
+    }
+
+    return [self validateValues:values results:outInvalidIndexes passingTest:nil];
+}
+
+
+- (BOOL)validateValues:(NSArray *)values results:(out NSIndexSet *__autoreleasing *)outInvalidIndexes passingTest:(BOOL (^)(id))test
+{
+    NSParameterAssert(values);
+
+    // Hoist everything that doesn’t depend on the value out of the loop
+    NSNull *null = [NSNull null];
+    BOOL allowsNull = self.allowsNull;
+    Class valueClass = self.valueClass;
+    Class lastValidClass = Nil;
+
+    NSMutableIndexSet *invalidIndexes = [[NSMutableIndexSet alloc] init];
+    NSUInteger index = 0;
+    for (id value in values) {
+        BOOL validated = YES;
+        if (value == null) {
+            validated = allowsNull;
+        } else {
+            Class class = [value class];
+            if (class != lastValidClass) {
+                if (valueClass && ![class isSubclassOfClass:valueClass]) {
+                    validated = NO;
+                } else {
+                    lastValidClass = class;
+                }
+            }
+
+            validated = validated && (!test || test(value));
+        }
+
+        if (!validated) {
+            [invalidIndexes addIndex:index];
+        }
+
+        ++index;
+    }
+
+    if (outInvalidIndexes) {
+        *outInvalidIndexes = [invalidIndexes copy];
+    }
+
+    return invalidIndexes.count == 0;
+}
+
 @end
@@ -0,0 +1,92 @@
+//
+//  TWTWildcardPatternMatcher.h
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+@import Foundation;
+
+/*!
+ TWTWildcardPatternMatchResults are the results of matching a string with a TWTWildcardPatternMatcher.
+ */
+typedef NS_ENUM(NSInteger, TWTWildcardPatternMatchResult) {
+    /*! Indicates that the string does not match the pattern. */
+    TWTWildcardPatternMatchResultNoMatch,
+
+    /*! Indicates that the string matches the pattern. */
+    TWTWildcardPatternMatchResultMatch,
+
+    /*!
+     Indicates that the matcher could not decide whether the string matches the pattern, because the string contains a
+     character that NSPredicate’s LIKE operator may treat differently than the matcher does. The string should be
+     matched with a LIKE predicate instead.
+     */
+    TWTWildcardPatternMatchResultUndecided
+};
+
+
+/*!
+ TWTWildcardPatternMatchers determine whether strings match wildcard patterns like those used by NSPredicate’s LIKE
+ operator, in which ? matches one character and * matches zero or more characters. Patterns are compiled when the
+ matcher is created, and strings are matched directly against their UTF-16 characters. Case-insensitive matchers fold
+ the pattern’s case ahead of time, so no string is ever case-folded as a whole.
+
+ Matchers backtrack only to the most recent *, so matching takes time proportional to the product of the pattern and
+ string lengths in the worst case, and linear time for most patterns. Matching never allocates memory.
+
+ Strings are undecided when a wildcard would match a surrogate or line terminator, or when a case-insensitive
+ comparison involves a non-ASCII character that folds to ASCII letters, like ß or ﬁ. Patterns that contain
+ backslashes, and case-insensitive patterns that contain non-ASCII characters, are not supported.
+
+ Matchers are immutable and may be used from multiple threads at once.
+ */
+@interface TWTWildcardPatternMatcher : NSObject
+
+/*!
+ @abstract The pattern that the matcher matches.
+ */
+@property (nonatomic, copy, readonly) NSString *pattern;
+
+/*!
+ @abstract Whether the matcher performs case-sensitive comparisons.
+ */
+@property (nonatomic, assign, readonly, getter = isCaseSensitive) BOOL caseSensitive;
+
+/*!
+ @abstract Initializes a newly allocated matcher with the specified pattern.
+ @discussion This is the class’s designated initializer.
+ @param pattern The wildcard pattern. May not be nil.
+ @param caseSensitive Whether the matcher should perform case-sensitive comparisons.
+ @result An initialized matcher, or nil if the pattern is not supported.
+ */
+- (instancetype)initWithPattern:(NSString *)pattern caseSensitive:(BOOL)caseSensitive;
+
+/*!
+ @abstract Returns whether the specified string matches the receiver’s pattern.
+ @param string The string. May not be nil.
+ @result Whether the string matches the pattern. If the result is TWTWildcardPatternMatchResultUndecided, the string
+     should be matched with a LIKE predicate for the receiver’s pattern.
+ */
+- (TWTWildcardPatternMatchResult)resultOfMatchingString:(NSString *)string;
+
+@end
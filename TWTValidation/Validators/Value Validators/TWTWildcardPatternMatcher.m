@@ -0,0 +1,224 @@
+//
+//  TWTWildcardPatternMatcher.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <TWTValidation/TWTWildcardPatternMatcher.h>
+
+
+/*!
+ TWTWildcardPatternTokenKinds indicate what a token in a compiled wildcard pattern matches.
+ */
+typedef NS_ENUM(uint8_t, TWTWildcardPatternTokenKind) {
+    // Matches the token’s character or its alternate
+    TWTWildcardPatternTokenKindCharacter,
+
+    // Matches any one character (?)
+    TWTWildcardPatternTokenKindAnyCharacter,
+
+    // Matches zero or more characters (*). Runs of * are compiled into a single token.
+    TWTWildcardPatternTokenKindAnyString
+};
+
+
+typedef struct _TWTWildcardPatternToken {
+    TWTWildcardPatternTokenKind kind;
+    unichar character;
+
+    // The character with its case changed if the matcher is case-insensitive, and the character itself otherwise
+    unichar alternateCharacter;
+} TWTWildcardPatternToken;
+
+
+#pragma mark - Characters
+
+/*!
+ @abstract Returns whether a wildcard matching the character might not match it with a LIKE predicate.
+ @discussion Wildcards may match surrogate pairs as a single character and may not match line terminators at all.
+ */
+static inline BOOL TWTWildcardPatternCharacterIsAmbiguousForWildcards(unichar character)
+{
+    return (character >= '\n' && character <= '\r') || character == 0x85 || character == 0x2028 || character == 0x2029 ||
+        CFStringIsSurrogateHighCharacter(character) || CFStringIsSurrogateLowCharacter(character);
+}
+
+
+/*!
+ @abstract Returns whether a non-ASCII character’s full case folding consists entirely of ASCII letters.
+ @discussion These are the only non-ASCII characters that can be equal to ASCII pattern characters when case is ignored:
+     ß and ẞ (ss), ſ (s), the Kelvin sign (k), and the Latin ligatures ﬀ through ﬆ.
+ */
+static inline BOOL TWTWildcardPatternCharacterFoldsToASCII(unichar character)
+{
+    return character == 0xDF || character == 0x17F || character == 0x1E9E || character == 0x212A || (character >= 0xFB00 && character <= 0xFB06);
+}
+
+
+static inline unichar TWTWildcardPatternASCIICharacterWithOtherCase(unichar character)
+{
+    if (character >= 'a' && character <= 'z') {
+        return character - 'a' + 'A';
+    } else if (character >= 'A' && character <= 'Z') {
+        return character - 'A' + 'a';
+    }
+
+    return character;
+}
+
+
+#pragma mark
+
+@interface TWTWildcardPatternMatcher ()
+
+@property (nonatomic, copy, readwrite) NSString *pattern;
+@property (nonatomic, assign, readwrite, getter = isCaseSensitive) BOOL caseSensitive;
+
+@end
+
+
+@implementation TWTWildcardPatternMatcher {
+    NSData *_tokens;
+    NSUInteger _tokenCount;
+}
+
+- (instancetype)init
+{
+    return [self initWithPattern:nil caseSensitive:YES];
+}
+
+
+- (instancetype)initWithPattern:(NSString *)pattern caseSensitive:(BOOL)caseSensitive
+{
+    NSParameterAssert(pattern);
+
+    self = [super init];
+    if (self) {
+        NSUInteger length = pattern.length;
+        NSMutableData *tokens = [[NSMutableData alloc] initWithLength:length * sizeof(TWTWildcardPatternToken)];
+        TWTWildcardPatternToken *token = tokens.mutableBytes;
+        NSUInteger tokenCount = 0;
+
+        for (NSUInteger i = 0; i < length; ++i) {
+            unichar character = [pattern characterAtIndex:i];
+            if (character == '\\' || (!caseSensitive && character > 0x7F)) {
+                return nil;
+            }
+
+            if (character == '*') {
+                if (tokenCount && token[-1].kind == TWTWildcardPatternTokenKindAnyString) {
+                    continue;
+                }
+
+                *token = (TWTWildcardPatternToken){ .kind = TWTWildcardPatternTokenKindAnyString };
+            } else if (character == '?') {
+                *token = (TWTWildcardPatternToken){ .kind = TWTWildcardPatternTokenKindAnyCharacter };
+            } else {
+                unichar alternateCharacter = caseSensitive ? character : TWTWildcardPatternASCIICharacterWithOtherCase(character);
+                *token = (TWTWildcardPatternToken){ .kind = TWTWildcardPatternTokenKindCharacter, .character = character, .alternateCharacter = alternateCharacter };
+            }
+
+            ++token;
+            ++tokenCount;
+        }
+
+        tokens.length = tokenCount * sizeof(TWTWildcardPatternToken);
+        _tokens = [tokens copy];
+        _tokenCount = tokenCount;
+        _pattern = [pattern copy];
+        _caseSensitive = caseSensitive;
+    }
+
+    return self;
+}
+
+
+- (TWTWildcardPatternMatchResult)resultOfMatchingString:(NSString *)string
+{
+    NSParameterAssert(string);
+
+    const TWTWildcardPatternToken *tokens = _tokens.bytes;
+    NSUInteger tokenCount = _tokenCount;
+    BOOL caseSensitive = _caseSensitive;
+
+    CFStringRef cfString = (__bridge CFStringRef)string;
+    CFIndex length = CFStringGetLength(cfString);
+    CFStringInlineBuffer buffer;
+    CFStringInitInlineBuffer(cfString, &buffer, CFRangeMake(0, length));
+
+    // The token after the most recent * and the position in the string at which it’s being tried. When a character
+    // doesn’t match, the * consumes one more character and matching resumes from there. Earlier *s never need to be
+    // retried, because anything they could consume, the most recent * can consume instead.
+    NSUInteger resumeTokenIndex = NSNotFound;
+    CFIndex resumePosition = 0;
+
+    NSUInteger tokenIndex = 0;
+    CFIndex position = 0;
+    while (position < length) {
+        if (tokenIndex < tokenCount) {
+            const TWTWildcardPatternToken *token = &tokens[tokenIndex];
+            if (token->kind == TWTWildcardPatternTokenKindAnyString) {
+                resumeTokenIndex = ++tokenIndex;
+                resumePosition = position;
+                continue;
+            }
+
+            unichar character = CFStringGetCharacterFromInlineBuffer(&buffer, position);
+            if (token->kind == TWTWildcardPatternTokenKindAnyCharacter) {
+                if (TWTWildcardPatternCharacterIsAmbiguousForWildcards(character)) {
+                    return TWTWildcardPatternMatchResultUndecided;
+                }
+
+                ++tokenIndex;
+                ++position;
+                continue;
+            } else if (character == token->character || character == token->alternateCharacter) {
+                ++tokenIndex;
+                ++position;
+                continue;
+            } else if (!caseSensitive && TWTWildcardPatternCharacterFoldsToASCII(character)) {
+                return TWTWildcardPatternMatchResultUndecided;
+            }
+        }
+
+        if (resumeTokenIndex == NSNotFound) {
+            return TWTWildcardPatternMatchResultNoMatch;
+        }
+
+        unichar character = CFStringGetCharacterFromInlineBuffer(&buffer, resumePosition);
+        if (TWTWildcardPatternCharacterIsAmbiguousForWildcards(character)) {
+            return TWTWildcardPatternMatchResultUndecided;
+        }
+
+        tokenIndex = resumeTokenIndex;
+        position = ++resumePosition;
+    }
+
+    while (tokenIndex < tokenCount && tokens[tokenIndex].kind == TWTWildcardPatternTokenKindAnyString) {
+        ++tokenIndex;
+    }
+
+    return tokenIndex == tokenCount ? TWTWildcardPatternMatchResultMatch : TWTWildcardPatternMatchResultNoMatch;
+}
+
+@end
@@ -115,4 +115,28 @@
  */
 + (TWTValidator *)failingValidatorWithError:(NSError *)error;
 
+/*!
+ @abstract Returns the indexes of the values that the specified validator considers invalid.
+ @discussion Each value is validated individually using -validateValue:error:. This is useful for checking
+     the results of -validateValues:results:.
+ @param values The values to validate.
+ @param validator The validator with which to validate the values.
+ @result The indexes of the values that the validator considers invalid.
+ */
+- (NSIndexSet *)indexesOfValues:(NSArray *)values invalidForValidator:(TWTValidator *)validator;
+
+/*!
+ @abstract Returns the number of heap allocations made on the current thread while executing the specified block.
+ @discussion Allocations are counted using malloc’s logging hook, so Objective-C objects, Core Foundation objects,
+     and raw memory are all counted. Allocations made on other threads are not. Code that runs for the first time
+     may fill caches, so the code being measured should generally be executed once before it is measured.
+
+     The hook is private to malloc. If it isn’t available, the block is still executed, but NSNotFound is returned,
+     and callers should skip any checks of the count.
+ @param block The block to execute. May not be nil.
+ @result The number of heap allocations made on the current thread while executing the block, or NSNotFound if
+     allocations can’t be counted.
+ */
+- (NSUInteger)allocationCountOfBlock:(void (^)(void))block;
+
 @end
@@ -26,6 +26,10 @@
 
 #import "TWTRandomizedTestCase.h"
 
+#import <dlfcn.h>
+#import <pthread.h>
+#import <stdatomic.h>
+
 
 #pragma mark Passing Validator
 
@@ -97,6 +101,33 @@
 @end
 
 
+#pragma mark - Allocation Counting
+
+// malloc calls this hook, if set, for every allocation and deallocation. It is the same hook malloc stack logging uses.
+// It isn’t public API, so it is looked up at runtime rather than linked against, and allocations aren’t counted if it
+// can’t be found.
+typedef void (TWTMallocLogger)(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t hotFramesToSkip);
+
+// The flag malloc sets in the type of every allocation it logs, including reallocations
+static const uint32_t TWTMallocLogTypeAllocate = 2;
+
+static TWTMallocLogger *TWTPreviousMallocLogger = NULL;
+static _Atomic(pthread_t) TWTAllocationCountingThread = NULL;
+static NSUInteger TWTAllocationCount = 0;
+
+
+static void TWTAllocationCountingMallocLogger(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t hotFramesToSkip)
+{
+    if ((type & TWTMallocLogTypeAllocate) && pthread_equal(atomic_load_explicit(&TWTAllocationCountingThread, memory_order_relaxed), pthread_self())) {
+        ++TWTAllocationCount;
+    }
+
+    if (TWTPreviousMallocLogger) {
+        TWTPreviousMallocLogger(type, arg1, arg2, arg3, result, hotFramesToSkip + 1);
+    }
+}
+
+
 #pragma mark
 
 @implementation TWTRandomizedTestCase
@@ -207,4 +238,47 @@
     return [[TWTFailingValidator alloc] initWithError:error];
 }
 
+
+- (NSIndexSet *)indexesOfValues:(NSArray *)values invalidForValidator:(TWTValidator *)validator
+{
+    NSMutableIndexSet *invalidIndexes = [[NSMutableIndexSet alloc] init];
+    [values enumerateObjectsUsingBlock:^(id value, NSUInteger index, BOOL *stop) {
+        if (![validator validateValue:value error:NULL]) {
+            [invalidIndexes addIndex:index];
+        }
+    }];
+
+    return invalidIndexes;
+}
+
+
+- (NSUInteger)allocationCountOfBlock:(void (^)(void))block
+{
+    NSParameterAssert(block);
+
+    static TWTMallocLogger **mallocLogger = NULL;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        mallocLogger = dlsym(RTLD_DEFAULT, "malloc_logger");
+    });
+
+    if (!mallocLogger) {
+        block();
+        return NSNotFound;
+    }
+
+    NSAssert(*mallocLogger != TWTAllocationCountingMallocLogger, @"allocations are already being counted");
+
+    TWTAllocationCount = 0;
+    TWTPreviousMallocLogger = *mallocLogger;
+    atomic_store(&TWTAllocationCountingThread, pthread_self());
+    *mallocLogger = TWTAllocationCountingMallocLogger;
+
+    block();
+
+    *mallocLogger = TWTPreviousMallocLogger;
+    atomic_store(&TWTAllocationCountingThread, NULL);
+    return TWTAllocationCount;
+}
+
 @end
@@ -26,6 +26,8 @@
 
 #import "TWTRandomizedTestCase.h"
 
+#import <TWTValidation/TWTValidationLocalization.h>
+
 
 @interface TWTValidationErrorsTests : TWTRandomizedTestCase
 
@@ -33,6 +35,7 @@
 - (void)testValidationErrorWithCodeValueLocalizedDescriptionUnderlyingErrors;
 - (void)testValidationErrorWithCodeFailingValidatorValueLocalizedDescription;
 - (void)testValidationErrorWithCodeFailingValidatorValueLocalizedDescriptionUnderlyingErrors;
+- (void)testValidationErrorWithCodeFailingValidatorValueLocalizedDescriptionBlockUnderlyingErrors;
 
 - (void)testValidatedValue;
 - (void)testUnderlyingErrors;
@@ -43,6 +46,8 @@
 - (void)testValueValidationErrors;
 - (void)testKeyValuePairValidationErrors;
 
+- (void)testLocalization;
+
 @end
 
 
@@ -200,6 +205,56 @@
 }
 
 
+- (void)testValidationErrorWithCodeFailingValidatorValueLocalizedDescriptionBlockUnderlyingErrors
+{
+    NSInteger code = random();
+    id value = [self randomNonNilObject];
+
+    NSString *description = UMKRandomUnicodeString();
+    NSArray *errors = UMKGeneratedArrayWithElementCount(random() % 10 + 1, ^id(NSUInteger index) {
+        return UMKRandomError();
+    });
+
+    TWTValidator *validator = [self randomValidator];
+
+    __block NSUInteger invocationCount = 0;
+    NSError *error = [NSError twt_validationErrorWithCode:code
+                                         failingValidator:validator
+                                                    value:value
+                                localizedDescriptionBlock:^{
+                                    ++invocationCount;
+                                    return description;
+                                }
+                                         underlyingErrors:errors];
+
+    XCTAssertNotNil(error, @"returns nil object");
+    XCTAssertEqualObjects(error.domain, TWTValidationErrorDomain, @"domain is not set correctly");
+    XCTAssertEqual(error.code, code, @"code is not set correctly");
+    XCTAssertEqual(error.twt_failingValidator, validator, @"failing validator is not set correctly");
+    XCTAssertEqual(error.twt_validatedValue, value, @"value is not set correctly");
+    XCTAssertEqualObjects(error.twt_underlyingErrors, errors, @"underlying errors are not set correctly");
+    XCTAssertEqual(invocationCount, 0, @"description block invoked before description was requested");
+
+    XCTAssertEqualObjects(error.localizedDescription, description, @"description is not set correctly");
+    NSDictionary *userInfo = @{ TWTValidationFailingValidatorKey : validator,
+                                TWTValidationValidatedValueKey : value,
+                                NSLocalizedDescriptionKey : description,
+                                TWTValidationUnderlyingErrorsKey : errors };
+    XCTAssertEqualObjects(error.userInfo, userInfo, @"userInfo is not set correctly");
+    XCTAssertEqual(invocationCount, 1, @"description block not invoked exactly once");
+
+    error = [NSError twt_validationErrorWithCode:code failingValidator:nil value:nil localizedDescriptionBlock:nil];
+    XCTAssertEqualObjects(error.userInfo, @{ }, @"userInfo is not set correctly");
+    XCTAssertNotNil(error.localizedDescription, @"default description is nil");
+
+    error = [NSError twt_validationErrorWithCode:code failingValidator:nil value:nil localizedDescriptionBlock:^{ return description; }];
+    NSError *unarchivedError = [NSKeyedUnarchiver unarchiveObjectWithData:[NSKeyedArchiver archivedDataWithRootObject:error]];
+    XCTAssertEqual([unarchivedError class], [NSError class], @"archived error is not a plain error");
+    XCTAssertEqual(unarchivedError.code, code, @"archived code is not set correctly");
+    XCTAssertEqualObjects(unarchivedError.localizedDescription, description, @"archived description is not set correctly");
+}
+
+
 - (void)testValidatedValue
 {
     NSString *key = TWTValidationValidatedValueKey;
@@ -294,4 +349,30 @@
     XCTAssertEqualObjects(error.twt_keyValuePairValidationErrors, object, @"key-value pair validation errors is not set correctly");
 }
 
+
+- (void)testLocalization
+{
+    TWTValidationPreloadLocalizedStrings();
+
+    NSString *key = @"TWTValidator.valueNil.validationError";
+    NSString *expectedString = [[NSBundle bundleForClass:[TWTValidator class]] localizedStringForKey:key value:@"" table:@"TWTValidation"];
+    XCTAssertEqualObjects(TWTValidationLocalizedString(key), expectedString, @"returns incorrect localized string");
+    XCTAssertNotEqualObjects(TWTValidationLocalizedString(key), key, @"returns key for localized string");
+
+    NSString *missingKey = UMKRandomAlphanumericString();
+    XCTAssertEqualObjects(TWTValidationLocalizedString(missingKey), missingKey, @"does not return key for missing string");
+
+    TWTValidationSetLocalization(@"en");
+    XCTAssertEqualObjects(TWTValidationLocalization(), @"en", @"localization is not set correctly");
+    XCTAssertEqualObjects(TWTValidationLocalizedString(key), expectedString, @"returns incorrect localized string for localization");
+
+    // Localizations the framework doesn’t have fall back to the development localization
+    TWTValidationSetLocalization(UMKRandomAlphanumericString());
+    XCTAssertEqualObjects(TWTValidationLocalizedString(key), expectedString, @"does not fall back to development localization");
+
+    TWTValidationSetLocalization(nil);
+    XCTAssertNil(TWTValidationLocalization(), @"localization is not reset");
+    XCTAssertEqualObjects(TWTValidationLocalizedString(key), expectedString, @"returns incorrect localized string after reset");
+}
+
 @end
@@ -0,0 +1,130 @@
+//
+//  TWTJSONObjectValidatorGeneratorTestCase.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "TWTRandomizedTestCase.h"
+
+#import <TWTValidation/TWTValidation.h>
+#import <TWTValidation/TWTJSONObjectValidatorGenerator.h>
+
+
+@interface TWTJSONObjectValidatorGeneratorTestCase : TWTRandomizedTestCase
+
+- (void)testInit;
+- (void)testSimplification;
+- (void)testSimplificationWithRecursiveReferences;
+- (void)testSimplificationDisabled;
+
+@end
+
+
+@implementation TWTJSONObjectValidatorGeneratorTestCase
+
+- (NSDictionary *)schema
+{
+    return @{ @"definitions" : @{ @"positive" : @{ @"minimum" : @0, @"exclusiveMinimum" : @YES } },
+              @"anyOf" : @[ @{ @"$ref" : @"#/definitions/positive" }, @{ @"maxLength" : @2 }, @{ @"properties" : @{ @"a" : @{ } } } ],
+              @"allOf" : @[ @{ @"allOf" : @[ @{ @"not" : @{ @"not" : @{ @"enum" : @[ @1, @2, @"a", @"bb", @{ @"a" : @1 } ] } } } ] } ],
+              @"oneOf" : @[ @{ @"type" : @[ @"number", @"string" ] } ],
+              @"items" : @{ @"type" : @"integer" } };
+}
+
+
+- (NSArray *)values
+{
+    return @[ @1, @2, @3, @-1, @0, @"a", @"bb", @"ccc", @YES, [NSNull null], @[ ], @[ @1 ], @{ }, @{ @"a" : @1 }, @{ @"a" : @2 } ];
+}
+
+
+- (TWTJSONObjectValidator *)validatorWithSchema:(NSDictionary *)schema simplifies:(BOOL)simplifies removedValidatorCount:(NSUInteger *)outCount
+{
+    TWTJSONObjectValidatorGenerator *generator = [[TWTJSONObjectValidatorGenerator alloc] init];
+    generator.simplifiesValidators = simplifies;
+    TWTJSONObjectValidator *validator = [generator validatorFromJSONSchema:schema error:NULL warnings:NULL];
+    if (outCount) {
+        *outCount = generator.removedValidatorCount;
+    }
+
+    return validator;
+}
+
+
+- (void)testInit
+{
+    TWTJSONObjectValidatorGenerator *generator = [[TWTJSONObjectValidatorGenerator alloc] init];
+    XCTAssertTrue(generator.simplifiesValidators, @"does not simplify validators by default");
+    XCTAssertEqual(generator.removedValidatorCount, (NSUInteger)0, @"removed validator count is non-zero");
+}
+
+
+- (void)testSimplification
+{
+    NSUInteger removedValidatorCount = 0;
+    TWTJSONObjectValidator *simplifiedValidator = [self validatorWithSchema:[self schema] simplifies:YES removedValidatorCount:&removedValidatorCount];
+    TWTJSONObjectValidator *validator = [self validatorWithSchema:[self schema] simplifies:NO removedValidatorCount:NULL];
+
+    XCTAssertTrue([simplifiedValidator isKindOfClass:[TWTJSONObjectValidator class]], @"top-level validator is not a JSON object validator");
+    XCTAssertGreaterThan(removedValidatorCount, (NSUInteger)0, @"no validators removed");
+
+    for (id value in [self values]) {
+        NSError *error = nil;
+        BOOL validated = [validator validateValue:value error:NULL];
+        XCTAssertEqual([simplifiedValidator validateValue:value error:&error], validated, @"results differ for %@", value);
+        XCTAssertEqual((BOOL)(error != nil), (BOOL)!validated, @"error is incorrect for %@", value);
+    }
+}
+
+
+- (void)testSimplificationWithRecursiveReferences
+{
+    NSDictionary *schema = @{ @"properties" : @{ @"child" : @{ @"$ref" : @"#" }, @"name" : @{ @"minLength" : @1 } }, @"maxProperties" : @2 };
+
+    NSUInteger removedValidatorCount = 0;
+    TWTJSONObjectValidator *simplifiedValidator = [self validatorWithSchema:schema simplifies:YES removedValidatorCount:&removedValidatorCount];
+    TWTJSONObjectValidator *validator = [self validatorWithSchema:schema simplifies:NO removedValidatorCount:NULL];
+    XCTAssertGreaterThan(removedValidatorCount, (NSUInteger)0, @"no validators removed");
+
+    NSArray *values = @[ @{ },
+                         @{ @"child" : @{ @"child" : @{ @"name" : @"a" } } },
+                         @{ @"child" : @{ @"child" : @{ @"name" : @"" } } },
+                         @{ @"child" : @{ @"child" : @{ @"a" : @1, @"b" : @2, @"c" : @3 } } },
+                         @{ @"child" : @[ ] },
+                         @{ @"name" : @2 },
+                         @"" ];
+
+    for (id value in values) {
+        XCTAssertEqual([simplifiedValidator validateValue:value error:NULL], [validator validateValue:value error:NULL], @"results differ for %@", value);
+    }
+}
+
+
+- (void)testSimplificationDisabled
+{
+    NSUInteger removedValidatorCount = 1;
+    XCTAssertNotNil([self validatorWithSchema:[self schema] simplifies:NO removedValidatorCount:&removedValidatorCount], @"returns nil validator");
+    XCTAssertEqual(removedValidatorCount, (NSUInteger)0, @"validators removed");
+}
+
+@end
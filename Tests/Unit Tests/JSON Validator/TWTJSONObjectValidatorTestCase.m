@@ -129,6 +129,42 @@ static NSString *const TWTTestKeywordValid = @"valid";
 }
 
 
+- (void)testProgramParity
+{
+    // The test suites are copied into the test bundle, so they can be found on any machine
+    NSBundle *bundle = [NSBundle bundleForClass:[self class]];
+    NSUInteger testValueCount = 0;
+    for (NSString *directoryName in @[ @"draft4", @"JSONSchemaCustom" ]) {
+        NSString *directoryPath = [bundle pathForResource:directoryName ofType:nil];
+        XCTAssertNotNil(directoryPath, @"%@ is not in the test bundle", directoryName);
+
+        NSArray *tests = directoryPath ? [self testsInDirectory:directoryPath] : nil;
+        XCTAssertGreaterThan(tests.count, (NSUInteger)0, @"no tests found in %@", directoryName);
+
+        for (NSDictionary *test in tests) {
+            TWTJSONObjectValidator *validator = [TWTJSONObjectValidator validatorWithJSONSchema:test[TWTTestKeywordSchema] error:nil warnings:nil];
+            TWTJSONSchemaProgram *program = [TWTJSONSchemaProgram programWithJSONSchema:test[TWTTestKeywordSchema] error:nil warnings:nil];
+            XCTAssertEqual(program != nil, validator != nil, @"program and validator disagree on whether schema compiles: %@", test[TWTTestKeywordSchema]);
+            if (!program) {
+                continue;
+            }
+
+            for (NSDictionary *testValue in test[TWTTestKeywordTests]) {
+                id data = testValue[TWTTestKeywordData];
+                NSError *error = nil;
+                BOOL validated = [validator validateValue:data error:NULL];
+                XCTAssertEqual([program validateValue:data error:&error], validated, @"\nValue: %@\nSchema: %@\nprogram and validator disagree. (%@)",
+                               data, test[TWTTestKeywordSchema], testValue[TWTTestKeywordDescription]);
+                XCTAssertEqual((BOOL)(error == nil), validated, @"error is inconsistent with result");
+                ++testValueCount;
+            }
+        }
+    }
+
+    XCTAssertGreaterThan(testValueCount, (NSUInteger)0, @"no test values were validated");
+}
+
+
 - (NSArray *)testsInDirectory:(NSString *)directoryPath
 {
     NSArray *testFilenames = [[NSFileManager defaultManager] contentsOfDirectoryAtPath:directoryPath error:nil];
@@ -0,0 +1,128 @@
+//
+//  TWTJSONSchemaPatternTestCase.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "TWTRandomizedTestCase.h"
+
+#import <TWTValidation/TWTValidation.h>
+
+
+@interface TWTJSONSchemaPatternTestCase : TWTRandomizedTestCase
+
+- (void)testLiteralPatterns;
+- (void)testCharacterClassPatterns;
+- (void)testComplexPatterns;
+- (void)testKernelsMatchLikeRegularExpressions;
+
+@end
+
+
+@implementation TWTJSONSchemaPatternTestCase
+
+- (TWTStringValidator *)validatorForPattern:(NSString *)pattern
+{
+    NSRegularExpression *regularExpression = [NSRegularExpression regularExpressionWithPattern:pattern options:0 error:NULL];
+    XCTAssertNotNil(regularExpression, @"pattern %@ is invalid", pattern);
+    return TWTJSONSchemaStringValidatorForPattern(regularExpression);
+}
+
+
+- (void)testLiteralPatterns
+{
+    for (NSString *pattern in @[ @"es", @"^abc", @"\\.json$", @"^abc$", @"a\\$", @"a\\\\$" ]) {
+        XCTAssertFalse([[self validatorForPattern:pattern] isKindOfClass:[TWTRegularExpressionStringValidator class]], @"pattern %@ is not validated with a kernel", pattern);
+    }
+
+    // Escaped $s are literal, but $s after escaped backslashes are anchors
+    TWTStringValidator *validator = [self validatorForPattern:@"a\\$"];
+    XCTAssertTrue([validator validateValue:@"xa$y" error:NULL], @"escaped $ is an anchor");
+
+    validator = [self validatorForPattern:@"a\\\\$"];
+    XCTAssertTrue([validator validateValue:@"xa\\" error:NULL], @"$ after escaped backslash is not an anchor");
+    XCTAssertFalse([validator validateValue:@"xa\\b" error:NULL], @"$ after escaped backslash is not an anchor");
+}
+
+
+- (void)testCharacterClassPatterns
+{
+    for (NSString *pattern in @[ @"^[A-Z0-9]*$", @"^[A-Z0-9]+$", @"^[0-9a-f]{32}$", @"^[0-9a-f]{2,}?$", @"^[\\-._]{1,3}$" ]) {
+        XCTAssertFalse([[self validatorForPattern:pattern] isKindOfClass:[TWTRegularExpressionStringValidator class]], @"pattern %@ is not validated with a kernel", pattern);
+    }
+
+    TWTStringValidator *validator = [self validatorForPattern:@"^[\\-._]{1,3}$"];
+    XCTAssertTrue([validator validateValue:@"-._" error:NULL], @"escaped class characters are not literal");
+    XCTAssertFalse([validator validateValue:@"-._-" error:NULL], @"counted repetition is not bounded");
+}
+
+
+- (void)testComplexPatterns
+{
+    NSArray *patterns = @[ @"^$", @"", @"a.c", @"^a|b", @"^\\d+$", @"\\w+", @"^[^a-z]+$", @"^[a-z]+", @"[a-z]+$",
+                           @"^[a-z]++$", @"^[a-]$", @"^[[:alpha:]]$", @"^[a-z&&[aeiou]]$", @"^é",
+                           @"^[a-z]+(-[a-z]+)*$" ];
+
+    for (NSString *pattern in patterns) {
+        XCTAssertTrue([[self validatorForPattern:pattern] isKindOfClass:[TWTRegularExpressionStringValidator class]], @"pattern %@ is validated with a kernel", pattern);
+    }
+
+    NSRegularExpression *regularExpression = [NSRegularExpression regularExpressionWithPattern:@"^abc" options:NSRegularExpressionCaseInsensitive error:NULL];
+    XCTAssertTrue([TWTJSONSchemaStringValidatorForPattern(regularExpression) isKindOfClass:[TWTRegularExpressionStringValidator class]],
+                  @"pattern with options is validated with a kernel");
+}
+
+
+- (void)testKernelsMatchLikeRegularExpressions
+{
+    NSArray *patterns = @[ @"es", @"^abc", @"\\.json$", @"^abc$", @"^K", @";", @"^[A-Z0-9]+$", @"^[0-9a-f]{4}$", @"^[a-c]{2,3}$",
+                           @"^[ab]?$", @"^[A-Z]*$" ];
+
+    // Besides ordinary strings, these include strings with combining marks, characters that are canonically equivalent
+    // to ASCII characters (the Kelvin sign and the Greek question mark), and line terminators before $
+    NSArray *strings = @[ @"", @"a", @"ab", @"abc", @"abcd", @"ABC9", @"0f9e", @"0F9E", @"x.json", @".jsonx", @"es", @"test", @"ccc", @"\u00e4",
+                          @"abc\u0301", @"e\u0301s", @"K", @"\u212a", @"a;b", @"a\u037eb", @"x.json\n", @"x.json\r\n", @"x.json\r",
+                          @"x.json\u2028", @"x.json\n\n", @"x.json\n\r", @"abc\n", @"ABC9\n", @"ABC9\r\n", @"0f9e\u2029", @"ab\n", @"\n", @"\r\n" ];
+
+    for (NSString *pattern in patterns) {
+        NSRegularExpression *regularExpression = [NSRegularExpression regularExpressionWithPattern:pattern options:0 error:NULL];
+        TWTStringValidator *validator = TWTJSONSchemaStringValidatorForPattern(regularExpression);
+        XCTAssertFalse([validator isKindOfClass:[TWTRegularExpressionStringValidator class]], @"pattern %@ is not validated with a kernel", pattern);
+
+        TWTRegularExpressionStringValidator *regularExpressionValidator = [TWTStringValidator stringValidatorWithRegularExpression:regularExpression options:0];
+        for (NSString *string in strings) {
+            BOOL matches = [regularExpression rangeOfFirstMatchInString:string options:0 range:NSMakeRange(0, string.length)].location != NSNotFound;
+
+            NSError *error = nil;
+            XCTAssertEqual([validator validateValue:string error:&error], matches, @"kernel for %@ does not match %@ correctly", pattern, string);
+            XCTAssertEqual([regularExpressionValidator validateValue:string error:NULL], matches, @"regular expression validator for %@ does not match %@ correctly", pattern, string);
+
+            if (!matches) {
+                XCTAssertEqual(error.code, TWTValidationErrorCodeValueDoesNotMatchFormat, @"incorrect error code");
+                XCTAssertEqualObjects(error.twt_failingValidator, validator, @"incorrect failing validator");
+            }
+        }
+    }
+}
+
+@end
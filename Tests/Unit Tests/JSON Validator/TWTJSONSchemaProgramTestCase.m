@@ -0,0 +1,183 @@
+//
+//  TWTJSONSchemaProgramTestCase.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "TWTRandomizedTestCase.h"
+
+#import <TWTValidation/TWTValidation.h>
+
+
+@interface TWTJSONSchemaProgramTestCase : TWTRandomizedTestCase
+
+- (void)testInit;
+- (void)testCompilation;
+- (void)testParityWithObjectValidator;
+- (void)testRecursiveReferences;
+- (void)testErrors;
+
+@end
+
+
+@implementation TWTJSONSchemaProgramTestCase
+
+- (NSDictionary *)objectSchema
+{
+    return @{ @"type" : @"object",
+              @"properties" : @{ @"name" : @{ @"type" : @"string", @"minLength" : @1, @"pattern" : @"^[A-Z]" },
+                                 @"age" : @{ @"type" : @"integer", @"minimum" : @0, @"exclusiveMinimum" : @YES },
+                                 @"tags" : @{ @"type" : @"array", @"items" : @{ @"type" : @"string" }, @"uniqueItems" : @YES, @"maxItems" : @3 } },
+              @"patternProperties" : @{ @"^x-" : @{ @"type" : @[ @"number", @"null" ] } },
+              @"additionalProperties" : @NO,
+              @"required" : @[ @"name" ],
+              @"dependencies" : @{ @"age" : @[ @"tags" ] } };
+}
+
+
+- (NSArray *)objectSchemaValues
+{
+    return @[ @{ @"name" : @"Ann" },
+              @{ @"name" : @"ann" },
+              @{ @"name" : @"" },
+              @{ },
+              @{ @"name" : @"Ann", @"age" : @3, @"tags" : @[ @"a" ] },
+              @{ @"name" : @"Ann", @"age" : @3 },
+              @{ @"name" : @"Ann", @"age" : @0, @"tags" : @[ ] },
+              @{ @"name" : @"Ann", @"age" : @2.5, @"tags" : @[ ] },
+              @{ @"name" : @"Ann", @"age" : @YES, @"tags" : @[ ] },
+              @{ @"name" : @"Ann", @"age" : @1, @"tags" : @[ @"a", @"a" ] },
+              @{ @"name" : @"Ann", @"age" : @1, @"tags" : @[ @"a", @"b", @"c", @"d" ] },
+              @{ @"name" : @"Ann", @"x-rate" : @1.5, @"x-none" : [NSNull null] },
+              @{ @"name" : @"Ann", @"x-rate" : @"fast" },
+              @{ @"name" : @"Ann", @"other" : @1 },
+              @[ @"Ann" ],
+              @"Ann",
+              [NSNull null] ];
+}
+
+
+- (NSDictionary *)combinedSchema
+{
+    return @{ @"definitions" : @{ @"positive" : @{ @"minimum" : @0, @"exclusiveMinimum" : @YES } },
+              @"anyOf" : @[ @{ @"$ref" : @"#/definitions/positive" }, @{ @"type" : @"string", @"maxLength" : @2 } ],
+              @"not" : @{ @"enum" : @[ @7, @"no" ] },
+              @"oneOf" : @[ @{ @"multipleOf" : @3 }, @{ @"multipleOf" : @5 }, @{ @"type" : @"string" } ],
+              @"items" : @[ @{ @"type" : @"boolean" } ],
+              @"additionalItems" : @{ @"type" : @"null" } };
+}
+
+
+- (NSArray *)combinedSchemaValues
+{
+    return @[ @3, @5, @15, @7, @-3, @0, @4.5, @"ab", @"abc", @"no", @YES,
+              @[ ], @[ @YES ], @[ @YES, [NSNull null] ], @[ @YES, @1 ], @[ @1 ], @{ } ];
+}
+
+
+- (void)testInit
+{
+    TWTJSONSchemaProgram *program = [[TWTJSONSchemaProgram alloc] init];
+    XCTAssertEqualObjects(program.schema, @{ }, @"schema is not empty");
+    XCTAssertEqual(program.instructionCount, (NSUInteger)1, @"incorrect instruction count");
+    XCTAssertEqual(program.subroutineCount, (NSUInteger)1, @"incorrect subroutine count");
+    XCTAssertTrue([program validateValue:UMKRandomUnicodeStringWithLength(5) error:NULL], @"fails with any value");
+}
+
+
+- (void)testCompilation
+{
+    XCTAssertNil([TWTJSONSchemaProgram programWithJSONSchema:@{ @"type" : @"spaceship" } error:NULL warnings:NULL], @"compiles invalid schema");
+
+    NSError *error = nil;
+    TWTJSONSchemaProgram *program = [TWTJSONSchemaProgram programWithJSONSchema:[self objectSchema] error:&error warnings:NULL];
+    XCTAssertNotNil(program, @"returns nil program");
+    XCTAssertNil(error, @"returns non-nil error");
+    XCTAssertEqualObjects(program.schema, [self objectSchema], @"incorrect schema");
+    XCTAssertGreaterThan(program.instructionCount, program.subroutineCount, @"too few instructions");
+
+    // One subroutine for the schema, one for each property schema, one for the array items, one for the pattern
+    // property, one for each of that property’s types, and one for the disallowed additional properties
+    XCTAssertEqual(program.subroutineCount, (NSUInteger)9, @"incorrect subroutine count");
+
+    TWTJSONSchemaProgram *otherProgram = [TWTJSONSchemaProgram programWithJSONSchema:[self objectSchema] error:NULL warnings:NULL];
+    XCTAssertEqualObjects(program, otherProgram, @"programs for the same schema are not equal");
+    XCTAssertEqual(program.hash, otherProgram.hash, @"programs for the same schema have different hashes");
+}
+
+
+- (void)testParityWithObjectValidator
+{
+    NSDictionary *schemasToValues = @{ [self objectSchema] : [self objectSchemaValues], [self combinedSchema] : [self combinedSchemaValues] };
+
+    for (NSDictionary *schema in schemasToValues) {
+        TWTJSONSchemaProgram *program = [TWTJSONSchemaProgram programWithJSONSchema:schema error:NULL warnings:NULL];
+        TWTJSONObjectValidator *validator = [TWTJSONObjectValidator validatorWithJSONSchema:schema error:NULL warnings:NULL];
+
+        for (id value in schemasToValues[schema]) {
+            XCTAssertEqual([program validateValue:value error:NULL], [validator validateValue:value error:NULL], @"results differ for %@ with schema %@", value, schema);
+        }
+    }
+}
+
+
+- (void)testRecursiveReferences
+{
+    NSDictionary *schema = @{ @"type" : @"object",
+                              @"properties" : @{ @"value" : @{ @"type" : @"integer" }, @"next" : @{ @"$ref" : @"#" } },
+                              @"required" : @[ @"value" ] };
+
+    TWTJSONSchemaProgram *program = [TWTJSONSchemaProgram programWithJSONSchema:schema error:NULL warnings:NULL];
+    XCTAssertNotNil(program, @"returns nil program");
+
+    NSDictionary *list = @{ @"value" : @1 };
+    for (NSUInteger i = 0; i < 50; ++i) {
+        list = @{ @"value" : @(i), @"next" : list };
+    }
+
+    XCTAssertTrue([program validateValue:list error:NULL], @"fails with valid list");
+    XCTAssertFalse([program validateValue:@{ @"value" : @1, @"next" : @{ @"value" : @"2" } } error:NULL], @"passes with invalid list");
+    XCTAssertFalse([program validateValue:@{ @"value" : @1, @"next" : @{ } } error:NULL], @"passes with incomplete list");
+}
+
+
+- (void)testErrors
+{
+    TWTJSONSchemaProgram *program = [TWTJSONSchemaProgram programWithJSONSchema:[self objectSchema] error:NULL warnings:NULL];
+    TWTJSONObjectValidator *validator = [TWTJSONObjectValidator validatorWithJSONSchema:[self objectSchema] error:NULL warnings:NULL];
+
+    NSError *error = nil;
+    XCTAssertTrue([program validateValue:@{ @"name" : @"Ann" } error:&error], @"fails with valid value");
+    XCTAssertNil(error, @"returns non-nil error");
+
+    // Errors should be the same as those of the object validator
+    id value = @{ @"name" : @"ann", @"other" : @1 };
+    NSError *validatorError = nil;
+    XCTAssertFalse([program validateValue:value error:&error], @"passes with invalid value");
+    XCTAssertFalse([validator validateValue:value error:&validatorError], @"validator passes with invalid value");
+    XCTAssertNotNil(error, @"returns nil error");
+    XCTAssertEqual(error.code, validatorError.code, @"incorrect error code");
+    XCTAssertEqual(error.twt_underlyingErrors.count, validatorError.twt_underlyingErrors.count, @"incorrect underlying errors");
+}
+
+@end
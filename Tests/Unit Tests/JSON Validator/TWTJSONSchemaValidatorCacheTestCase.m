@@ -0,0 +1,174 @@
+//
+//  TWTJSONSchemaValidatorCacheTestCase.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "TWTRandomizedTestCase.h"
+
+#import <TWTValidation/TWTValidation.h>
+
+
+@interface TWTJSONSchemaValidatorCacheTestCase : TWTRandomizedTestCase
+
+- (void)testDigest;
+- (void)testHitsAndMisses;
+- (void)testInvalidSchemasAreNotCached;
+- (void)testLeastRecentlyUsedEviction;
+- (void)testSharedCache;
+
+@end
+
+
+@implementation TWTJSONSchemaValidatorCacheTestCase
+
+- (void)testDigest
+{
+    NSDictionary *schema = @{ @"type" : @"object", @"properties" : @{ @"a" : @{ @"type" : @"string" }, @"b" : @{ @"minimum" : @1 } } };
+    NSMutableDictionary *reorderedSchema = [[NSMutableDictionary alloc] init];
+    reorderedSchema[@"properties"] = @{ @"b" : @{ @"minimum" : @1.0 }, @"a" : @{ @"type" : @"string" } };
+    reorderedSchema[@"type"] = @"object";
+
+    NSString *digest = [TWTJSONSchemaValidatorCache digestForJSONSchema:schema];
+    XCTAssertEqual(digest.length, 64, @"digest is not a hex-encoded SHA-256 hash");
+    XCTAssertEqualObjects(digest, [TWTJSONSchemaValidatorCache digestForJSONSchema:reorderedSchema], @"equal schemas have different digests");
+
+    XCTAssertNotEqualObjects([TWTJSONSchemaValidatorCache digestForJSONSchema:@{ @"enum" : @[ @YES ] }],
+                             [TWTJSONSchemaValidatorCache digestForJSONSchema:@{ @"enum" : @[ @1 ] }],
+                             @"booleans and numbers have the same digest");
+    XCTAssertNotEqualObjects([TWTJSONSchemaValidatorCache digestForJSONSchema:@{ @"enum" : @[ @"ab", @"c" ] }],
+                             [TWTJSONSchemaValidatorCache digestForJSONSchema:@{ @"enum" : @[ @"a", @"bc" ] }],
+                             @"different string arrays have the same digest");
+}
+
+
+- (void)testHitsAndMisses
+{
+    TWTJSONSchemaValidatorCache *cache = [[TWTJSONSchemaValidatorCache alloc] init];
+    NSDictionary *schema = @{ @"type" : @"string", @"maxLength" : @5 };
+
+    NSArray *warnings = nil;
+    TWTJSONObjectValidator *validator = [cache validatorForJSONSchema:schema error:NULL warnings:&warnings];
+    XCTAssertNotNil(validator, @"returns nil");
+    XCTAssertEqualObjects(validator.schema, schema, @"schema is not set");
+    XCTAssertEqual(cache.hitCount, 0, @"hit count is incorrect");
+    XCTAssertEqual(cache.missCount, 1, @"miss count is incorrect");
+    XCTAssertEqual(cache.count, 1, @"count is incorrect");
+    XCTAssertGreaterThan(cache.totalCost, 0, @"total cost is incorrect");
+
+    NSArray *cachedWarnings = nil;
+    XCTAssertEqual([cache validatorForJSONSchema:[schema mutableCopy] error:NULL warnings:&cachedWarnings], validator, @"returns different validator");
+    XCTAssertEqualObjects(cachedWarnings, warnings, @"cached warnings are not returned");
+    XCTAssertEqual(cache.hitCount, 1, @"hit count is incorrect");
+    XCTAssertEqual(cache.missCount, 1, @"miss count is incorrect");
+
+    XCTAssertTrue([validator validateValue:@"hello" error:NULL], @"cached validator fails valid value");
+    XCTAssertFalse([validator validateValue:@"hellooo" error:NULL], @"cached validator passes invalid value");
+
+    [cache resetStatistics];
+    XCTAssertEqual(cache.hitCount, 0, @"hit count is not reset");
+    XCTAssertEqual(cache.missCount, 0, @"miss count is not reset");
+
+    [cache removeAllValidators];
+    XCTAssertEqual(cache.count, 0, @"validators are not removed");
+    XCTAssertEqual(cache.totalCost, 0, @"total cost is not reset");
+    XCTAssertNotEqual([cache validatorForJSONSchema:schema error:NULL warnings:NULL], validator, @"returns removed validator");
+    XCTAssertEqual(cache.missCount, 1, @"miss count is incorrect");
+}
+
+
+- (void)testInvalidSchemasAreNotCached
+{
+    TWTJSONSchemaValidatorCache *cache = [[TWTJSONSchemaValidatorCache alloc] init];
+    NSDictionary *schema = @{ @"type" : @"foo" };
+
+    NSError *error = nil;
+    XCTAssertNil([cache validatorForJSONSchema:schema error:&error warnings:NULL], @"returns non-nil for invalid schema");
+    XCTAssertNotNil(error, @"error is not set");
+    XCTAssertEqual(cache.count, 0, @"invalid schema is cached");
+
+    error = nil;
+    XCTAssertNil([cache validatorForJSONSchema:schema error:&error warnings:NULL], @"returns non-nil for invalid schema");
+    XCTAssertNotNil(error, @"error is not set on second lookup");
+    XCTAssertEqual(cache.missCount, 2, @"miss count is incorrect");
+}
+
+
+- (void)testLeastRecentlyUsedEviction
+{
+    TWTJSONSchemaValidatorCache *cache = [[TWTJSONSchemaValidatorCache alloc] init];
+    NSDictionary *schema1 = @{ @"type" : @"string", @"maxLength" : @1 };
+    NSDictionary *schema2 = @{ @"type" : @"string", @"maxLength" : @2 };
+    NSDictionary *schema3 = @{ @"type" : @"string", @"maxLength" : @3 };
+
+    TWTJSONObjectValidator *validator1 = [cache validatorForJSONSchema:schema1 error:NULL warnings:NULL];
+    NSUInteger singleCost = cache.totalCost;
+    cache.totalCostLimit = singleCost * 2;
+    XCTAssertEqual(cache.totalCostLimit, singleCost * 2, @"total cost limit is not set");
+
+    TWTJSONObjectValidator *validator2 = [cache validatorForJSONSchema:schema2 error:NULL warnings:NULL];
+
+    // Use schema 1 so that schema 2 becomes the least recently used
+    XCTAssertEqual([cache validatorForJSONSchema:schema1 error:NULL warnings:NULL], validator1, @"returns different validator");
+    [cache validatorForJSONSchema:schema3 error:NULL warnings:NULL];
+
+    XCTAssertEqual(cache.count, 2, @"count exceeds cost limit");
+    XCTAssertLessThanOrEqual(cache.totalCost, cache.totalCostLimit, @"total cost exceeds limit");
+    XCTAssertEqual([cache validatorForJSONSchema:schema1 error:NULL warnings:NULL], validator1, @"most recently used validator was evicted");
+    XCTAssertNotEqual([cache validatorForJSONSchema:schema2 error:NULL warnings:NULL], validator2, @"least recently used validator was not evicted");
+
+    cache.totalCostLimit = singleCost;
+    XCTAssertEqual(cache.count, 1, @"lowering limit does not evict validators");
+}
+
+
+- (void)testSharedCache
+{
+    TWTJSONSchemaValidatorCache *sharedCache = [TWTJSONSchemaValidatorCache sharedCache];
+    XCTAssertNotNil(sharedCache, @"returns nil");
+    XCTAssertEqual([TWTJSONSchemaValidatorCache sharedCache], sharedCache, @"returns different instances");
+
+    NSDictionary *schema = @{ @"type" : @"integer", @"minimum" : @(random()) };
+    NSUInteger hitCount = sharedCache.hitCount;
+    TWTJSONObjectValidator *validator = [sharedCache validatorForJSONSchema:schema error:NULL warnings:NULL];
+    XCTAssertEqual([sharedCache validatorForJSONSchema:schema error:NULL warnings:NULL], validator, @"schema is recompiled");
+    XCTAssertGreaterThan(sharedCache.hitCount, hitCount, @"hit count is not incremented");
+}
+
+
+- (void)testObjectValidatorFactoryDoesNotCache
+{
+    TWTJSONSchemaValidatorCache *sharedCache = [TWTJSONSchemaValidatorCache sharedCache];
+    NSDictionary *schema = @{ @"type" : @"integer", @"maximum" : @(random()) };
+    NSUInteger hitCount = sharedCache.hitCount;
+    NSUInteger missCount = sharedCache.missCount;
+
+    TWTJSONObjectValidator *validator = [TWTJSONObjectValidator validatorWithJSONSchema:schema error:NULL warnings:NULL];
+    TWTJSONObjectValidator *otherValidator = [TWTJSONObjectValidator validatorWithJSONSchema:schema error:NULL warnings:NULL];
+    XCTAssertNotNil(validator, @"returns nil");
+    XCTAssertTrue(validator != otherValidator, @"returns the same instance");
+    XCTAssertEqual(sharedCache.hitCount, hitCount, @"uses the shared cache");
+    XCTAssertEqual(sharedCache.missCount, missCount, @"uses the shared cache");
+}
+
+@end
@@ -31,6 +31,9 @@
 #import "TWTJSONSchemaParser.h"
 #import "TWTJSONSchemaASTNode.h"
 #import "TWTJSONObjectValidator.h"
+#import "TWTJSONSchemaArrayValidator.h"
+#import "TWTJSONSchemaObjectValidator.h"
+#import "TWTValidationLocalization.h"
 
 @interface TWTJSONSchemaValidatorTestCase : TWTRandomizedTestCase
 
@@ -173,6 +176,297 @@
 
 }
 
+- (void)testPatternPropertiesValidation
+{
+    TWTJSONObjectValidator *validator = [TWTJSONObjectValidator validatorWithJSONSchema:[self patternPropertiesSchema] error:nil warnings:nil];
+    XCTAssertNotNil(validator);
+
+    NSArray *passing = @[ @{ }, @{ @"foo" : @1 }, @{ @"s_name" : @"a", @"i_count" : @2 }, @{ @"s_foo" : @"a", @"foo_s" : @"b" } ];
+    NSArray *failing = @[ @{ @"s_name" : @1 }, @{ @"i_count" : @"a" }, @{ @"foo_s" : @1 }, @{ @"s_x_s" : @1 }, @{ @"bar" : @"hey" } ];
+
+    // Validate each value twice so that cached pattern matches are exercised
+    for (NSUInteger i = 0; i < 2; ++i) {
+        for (NSDictionary *object in passing) {
+            XCTAssertTrue([validator validateValue:object error:nil], @"%@", object);
+        }
+
+        for (NSDictionary *object in failing) {
+            XCTAssertFalse([validator validateValue:object error:nil], @"%@", object);
+        }
+    }
+
+    // Invalid patterns match no properties
+    validator = [TWTJSONObjectValidator validatorWithJSONSchema:@{ @"patternProperties" : @{ @"(" : @{ @"type" : @"string" } },
+                                                                   @"additionalProperties" : @NO }
+                                                          error:nil
+                                                       warnings:nil];
+    XCTAssertTrue([validator validateValue:@{ } error:nil]);
+    XCTAssertFalse([validator validateValue:@{ @"(" : @"a" } error:nil]);
+}
+
+
+- (void)testConcurrentItemValidation
+{
+    // Concurrent validation is off by default
+    NSUInteger threshold = [TWTJSONSchemaArrayValidator concurrentItemValidationThreshold];
+    XCTAssertEqual(threshold, NSUIntegerMax, @"concurrent item validation is enabled by default");
+
+    TWTJSONObjectValidator *validator = [TWTJSONObjectValidator validatorWithJSONSchema:@{ @"type" : @"array", @"items" : @{ @"type" : @"integer" } }
+                                                                                  error:nil
+                                                                               warnings:nil];
+
+    NSMutableArray *items = [[NSMutableArray alloc] init];
+    NSMutableArray *validItems = [[NSMutableArray alloc] init];
+    for (NSUInteger i = 0; i < 5000; ++i) {
+        [items addObject:i % 97 == 0 ? [NSString stringWithFormat:@"%lu", (unsigned long)i] : @(i)];
+        [validItems addObject:@(i)];
+    }
+
+    TWTValidationContext *context = [[TWTValidationContext alloc] init];
+    context.failFastModeEnabled = NO;
+
+    [TWTJSONSchemaArrayValidator setConcurrentItemValidationThreshold:NSUIntegerMax];
+    NSError *serialError = nil;
+    XCTAssertFalse([validator validateValue:items context:context error:&serialError]);
+    XCTAssertTrue([validator validateValue:validItems context:context error:nil]);
+
+    // Items are validated using the context’s executor
+    TWTWorkStealingValidationExecutor *executor = [[TWTWorkStealingValidationExecutor alloc] initWithWorkerCount:4];
+    executor.concurrencyThreshold = 2;
+    context.executor = executor;
+
+    [TWTJSONSchemaArrayValidator setConcurrentItemValidationThreshold:2];
+    NSError *concurrentError = nil;
+    XCTAssertFalse([validator validateValue:items context:context error:&concurrentError]);
+    XCTAssertFalse([validator validateValue:items context:context error:nil]);
+    XCTAssertTrue([validator validateValue:validItems context:context error:nil]);
+
+    // Errors should be identical and in item order
+    XCTAssertEqualObjects(concurrentError, serialError);
+
+    [TWTJSONSchemaArrayValidator setConcurrentItemValidationThreshold:threshold];
+}
+
+
+- (void)testErrorPaths
+{
+    NSDictionary *schema = @{ @"type" : @"object",
+                              @"properties" : @{ @"a/b" : @{ @"type" : @"array",
+                                                             @"items" : @[ @{ @"type" : @"integer" }, @{ @"type" : @"string" } ] } },
+                              @"patternProperties" : @{ @"^p_" : @{ @"type" : @"string" } },
+                              @"additionalProperties" : @{ @"type" : @"integer" } };
+    TWTJSONObjectValidator *validator = [TWTJSONObjectValidator validatorWithJSONSchema:schema error:nil warnings:nil];
+    NSDictionary *object = @{ @"a/b" : @[ @1, @2 ], @"c~" : @"x", @"p_1" : @3, @"d" : @4 };
+
+    NSError *error = nil;
+    XCTAssertFalse([validator validateValue:object error:&error]);
+    XCTAssertNil(error.twt_instancePath, @"paths recorded without context");
+
+    error = nil;
+    TWTValidationContext *context = [[TWTValidationContext alloc] init];
+    XCTAssertFalse([validator validateValue:object context:context error:&error]);
+    XCTAssertEqualObjects(error.twt_instancePath, @"");
+    XCTAssertEqualObjects(error.twt_schemaPath, @"");
+    XCTAssertEqual(context.currentPathFrame, NULL, @"path frames not popped");
+
+    // Collect the paths of every error in the tree
+    NSMutableDictionary *schemaPathsByInstancePath = [[NSMutableDictionary alloc] init];
+    NSMutableArray *errors = [NSMutableArray arrayWithObject:error];
+    while (errors.count) {
+        NSError *nextError = errors.lastObject;
+        [errors removeLastObject];
+
+        XCTAssertNotNil(nextError.twt_instancePath, @"error has no instance path: %@", nextError);
+        if (nextError.twt_instancePath.length) {
+            schemaPathsByInstancePath[nextError.twt_instancePath] = nextError.twt_schemaPath;
+        }
+
+        [errors addObjectsFromArray:nextError.twt_underlyingErrors];
+    }
+
+    XCTAssertEqualObjects(schemaPathsByInstancePath, (@{ @"/a~1b" : @"/properties/a~1b",
+                                                         @"/a~1b/1" : @"/properties/a~1b/items/1",
+                                                         @"/c~0" : @"/additionalProperties",
+                                                         @"/p_1" : @"/patternProperties/^p_" }));
+
+    XCTAssertTrue([validator validateValue:@{ @"a/b" : @[ @1, @"x" ], @"d" : @4 } context:context error:&error]);
+}
+
+
+- (void)testValidationWithoutErrorDoesNotAllocate
+{
+    // Pattern properties are matched by NSRegularExpression, which may allocate, so this schema doesn’t use any
+    NSDictionary *schema = @{ @"definitions" : @{ @"positiveInteger" : @{ @"type" : @"integer", @"minimum" : @1 } },
+                              @"type" : @"object",
+                              @"minProperties" : @2,
+                              @"maxProperties" : @10,
+                              @"required" : @[ @"id", @"name" ],
+                              @"properties" : @{ @"id" : @{ @"$ref" : @"#/definitions/positiveInteger" },
+                                                 @"name" : @{ @"type" : @"string", @"minLength" : @1, @"maxLength" : @20, @"pattern" : @"^[a-z]+(-[a-z]+)*$" },
+                                                 @"ratio" : @{ @"type" : @"number", @"multipleOf" : @0.25, @"maximum" : @1 },
+                                                 @"state" : @{ @"enum" : @[ @"on", @"off" ] },
+                                                 @"tags" : @{ @"type" : @"array",
+                                                              @"items" : @{ @"type" : @"string" },
+                                                              @"uniqueItems" : @YES,
+                                                              @"maxItems" : @5 },
+                                                 @"pair" : @{ @"type" : @"array",
+                                                              @"items" : @[ @{ @"type" : @"integer" }, @{ @"type" : @[ @"string", @"null" ] } ],
+                                                              @"additionalItems" : @NO },
+                                                 @"value" : @{ @"anyOf" : @[ @{ @"type" : @"string" }, @{ @"type" : @"boolean" } ],
+                                                               @"not" : @{ @"enum" : @[ @"" ] } },
+                                                 @"mode" : @{ @"oneOf" : @[ @{ @"type" : @"integer" }, @{ @"type" : @"string" } ] },
+                                                 @"child" : @{ @"allOf" : @[ @{ @"type" : @"object" }, @{ @"required" : @[ @"id" ] } ] } },
+                              @"additionalProperties" : @NO,
+                              @"dependencies" : @{ @"ratio" : @[ @"state" ], @"mode" : @{ @"required" : @[ @"value" ] } } };
+
+    NSDictionary *object = @{ @"id" : @7,
+                              @"name" : @"alloc-free",
+                              @"ratio" : @0.75,
+                              @"state" : @"on",
+                              @"tags" : @[ @"a", @"b", @"c" ],
+                              @"pair" : @[ @1, [NSNull null] ],
+                              @"value" : @YES,
+                              @"mode" : @"fast",
+                              @"child" : @{ @"id" : @1 } };
+
+    TWTJSONObjectValidator *validator = [TWTJSONObjectValidator validatorWithJSONSchema:schema error:nil warnings:nil];
+    TWTJSONSchemaProgram *program = [TWTJSONSchemaProgram programWithJSONSchema:schema error:nil warnings:nil];
+    XCTAssertNotNil(validator);
+    XCTAssertNotNil(program);
+
+    for (TWTValidator *schemaValidator in @[ validator, program ]) {
+        // Validate once first so that caches are filled before we start counting
+        XCTAssertTrue([schemaValidator validateValue:object error:NULL], @"%@ fails valid object", schemaValidator);
+
+        __block BOOL validated = NO;
+        NSUInteger allocationCount = [self allocationCountOfBlock:^{
+            validated = [schemaValidator validateValue:object error:NULL];
+        }];
+
+        XCTAssertTrue(validated, @"%@ fails valid object", schemaValidator);
+        if (allocationCount == NSNotFound) {
+            NSLog(@"Allocations can’t be counted; skipping allocation check for %@", schemaValidator);
+        } else {
+            XCTAssertEqual(allocationCount, (NSUInteger)0, @"%@ allocates while validating valid object", schemaValidator);
+        }
+    }
+
+    // Errors are only allocated when requested
+    NSError *error = nil;
+    XCTAssertFalse([validator validateValue:@{ @"id" : @0 } error:&error]);
+    XCTAssertNotNil(error);
+}
+
+
+- (void)testPropertyTableValidation
+{
+    // Build a schema with enough properties that its keys are spread across the property table
+    NSUInteger propertyCount = 20 + random() % 20;
+    NSMutableDictionary *properties = [[NSMutableDictionary alloc] initWithCapacity:propertyCount];
+    NSMutableDictionary *validObject = [[NSMutableDictionary alloc] initWithCapacity:propertyCount];
+    for (NSUInteger i = 0; i < propertyCount; ++i) {
+        NSString *key = [NSString stringWithFormat:@"property%lu", (unsigned long)i];
+        properties[key] = @{ @"type" : @"integer" };
+        validObject[key] = @(i);
+    }
+
+    NSArray *requiredKeys = @[ @"property0", @"property1", @"property2" ];
+    NSDictionary *dependencies = @{ @"property3" : @[ @"property4" ], @"property5" : @{ @"required" : @[ @"property6" ] } };
+    NSDictionary *openSchema = @{ @"type" : @"object", @"properties" : properties, @"required" : requiredKeys, @"dependencies" : dependencies };
+    NSMutableDictionary *closedSchema = [openSchema mutableCopy];
+    closedSchema[@"additionalProperties"] = @NO;
+
+    // Objects with more keys than the schema are validated by walking the property table instead of the object
+    NSMutableDictionary *largeObject = [validObject mutableCopy];
+    for (NSUInteger i = 0; i < propertyCount * 2; ++i) {
+        largeObject[[NSString stringWithFormat:@"unknown%lu", (unsigned long)i]] = UMKRandomUnicodeString();
+    }
+
+    NSMutableDictionary *missingRequiredObject = [largeObject mutableCopy];
+    [missingRequiredObject removeObjectForKey:requiredKeys[random() % requiredKeys.count]];
+
+    NSMutableDictionary *invalidPropertyObject = [largeObject mutableCopy];
+    invalidPropertyObject[[NSString stringWithFormat:@"property%lu", (unsigned long)(random() % propertyCount)]] = UMKRandomUnicodeString();
+
+    NSMutableDictionary *missingKeyDependencyObject = [largeObject mutableCopy];
+    [missingKeyDependencyObject removeObjectForKey:@"property4"];
+
+    NSMutableDictionary *missingSchemaDependencyObject = [largeObject mutableCopy];
+    [missingSchemaDependencyObject removeObjectForKey:@"property6"];
+
+    NSArray *invalidObjects = @[ missingRequiredObject, invalidPropertyObject, missingKeyDependencyObject, missingSchemaDependencyObject ];
+
+    for (NSDictionary *schema in @[ openSchema, closedSchema ]) {
+        TWTJSONObjectValidator *validator = [TWTJSONObjectValidator validatorWithJSONSchema:schema error:nil warnings:nil];
+        TWTJSONSchemaProgram *program = [TWTJSONSchemaProgram programWithJSONSchema:schema error:nil warnings:nil];
+        BOOL allowsAdditionalProperties = schema == openSchema;
+
+        for (TWTValidator *schemaValidator in @[ validator, program ]) {
+            NSError *error = nil;
+            XCTAssertTrue([schemaValidator validateValue:validObject error:&error], @"%@ fails valid object", schemaValidator);
+            XCTAssertNil(error);
+
+            error = nil;
+            XCTAssertEqual([schemaValidator validateValue:largeObject error:&error], allowsAdditionalProperties);
+            XCTAssertEqual(error == nil, allowsAdditionalProperties);
+
+            for (NSDictionary *invalidObject in invalidObjects) {
+                error = nil;
+                XCTAssertFalse([schemaValidator validateValue:invalidObject error:&error], @"%@ passes invalid object", schemaValidator);
+                XCTAssertNotNil(error);
+                XCTAssertFalse([schemaValidator validateValue:invalidObject error:NULL], @"%@ passes invalid object", schemaValidator);
+            }
+        }
+    }
+}
+
+
+- (void)testNilAdditionalPropertiesValidator
+{
+    NSString *key = UMKRandomAlphanumericString();
+    NSArray *propertyValidators = @[ [[TWTKeyValuePairValidator alloc] initWithKey:key valueValidator:nil] ];
+    TWTJSONSchemaObjectValidator *validator = [[TWTJSONSchemaObjectValidator alloc] initWithMinimumPropertyCount:nil
+                                                                                            maximumPropertyCount:nil
+                                                                                            requiredPropertyKeys:nil
+                                                                                              propertyValidators:propertyValidators
+                                                                                       patternPropertyValidators:nil
+                                                                                   additionalPropertiesValidator:nil
+                                                                                            propertyDependencies:nil];
+
+    XCTAssertTrue([validator validateValue:@{ key : UMKRandomUnicodeString() } error:NULL], @"fails defined property");
+
+    NSString *additionalKey = [key stringByAppendingString:@"+"];
+    NSDictionary *additionalPropertyObject = @{ key : UMKRandomUnicodeString(), additionalKey : UMKRandomUnicodeString() };
+    NSError *error = nil;
+    XCTAssertFalse([validator validateValue:additionalPropertyObject error:&error], @"passes additional property");
+    XCTAssertEqual(error.twt_underlyingErrors.count, (NSUInteger)1, @"incorrect underlying error count");
+
+    NSError *additionalPropertyError = error.twt_underlyingErrors.firstObject;
+    XCTAssertEqual(additionalPropertyError.code, TWTValidationErrorCodeAdditionalElementsNotAllowed, @"incorrect error code");
+    XCTAssertEqual(additionalPropertyError.twt_failingValidator, validator, @"incorrect failing validator");
+    XCTAssertEqualObjects(additionalPropertyError.twt_validatedValue, additionalPropertyObject[additionalKey], @"incorrect validated value");
+
+    NSString *expectedDescription = [NSString stringWithFormat:TWTLocalizedString(@"TWTJSONSchemaObjectValidator.additionalPropertyNotAllowed.validationError.format"), additionalKey];
+    XCTAssertEqualObjects(additionalPropertyError.localizedDescription, expectedDescription, @"incorrect description");
+    XCTAssertFalse([validator validateValue:additionalPropertyObject error:NULL], @"passes additional property");
+
+    TWTJSONSchemaObjectValidator *defaultValidator = [[TWTJSONSchemaObjectValidator alloc] init];
+    XCTAssertTrue([defaultValidator validateValue:@{ } error:NULL], @"fails empty object");
+    XCTAssertFalse([defaultValidator validateValue:@{ key : UMKRandomUnicodeString() } error:NULL], @"passes additional property");
+}
+
+
+- (NSDictionary *)patternPropertiesSchema
+{
+    return @{ @"type" : @"object",
+              @"properties" : @{ @"foo" : @{ @"type" : @"integer" } },
+              @"patternProperties" : @{ @"^s_" : @{ @"type" : @"string" },
+                                        @"^i_" : @{ @"type" : @"integer" },
+                                        @"_s$" : @{ @"type" : @"string" } },
+              @"additionalProperties" : @{ @"type" : @"integer" } };
+}
+
+
 - (NSDictionary *)arraySchema1
 {
     return @{ @"uniqueItems" : @(YES),
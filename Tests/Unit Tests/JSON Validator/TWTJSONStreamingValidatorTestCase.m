@@ -0,0 +1,439 @@
+//
+//  TWTJSONStreamingValidatorTestCase.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "TWTRandomizedTestCase.h"
+
+#import <TWTValidation/TWTValidation.h>
+
+#import "TWTJSONSchemaArrayValidator.h"
+#import "TWTJSONSchemaImpliedTypeValidator.h"
+
+
+/*!
+ TWTJSONTestMaterializingDelegate builds the object graph described by a stream parser’s events so that it can be
+ compared with the output of NSJSONSerialization.
+ */
+@interface TWTJSONTestMaterializingDelegate : NSObject <TWTJSONStreamParserDelegate>
+
+@property (nonatomic, strong, readonly) NSMutableArray *containers;
+@property (nonatomic, strong, readonly) NSMutableArray *keys;
+@property (nonatomic, strong) id result;
+
+@end
+
+
+@implementation TWTJSONTestMaterializingDelegate
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _containers = [[NSMutableArray alloc] init];
+        _keys = [[NSMutableArray alloc] init];
+    }
+
+    return self;
+}
+
+
+- (void)addValue:(id)value
+{
+    id container = self.containers.lastObject;
+    if (!container) {
+        self.result = value;
+    } else if ([container isKindOfClass:[NSMutableDictionary class]]) {
+        container[self.keys.lastObject] = value;
+        [self.keys removeLastObject];
+    } else {
+        [container addObject:value];
+    }
+}
+
+
+- (void)parserDidStartObject:(TWTJSONStreamParser *)parser
+{
+    [self.containers addObject:[[NSMutableDictionary alloc] init]];
+}
+
+
+- (void)parser:(TWTJSONStreamParser *)parser didReadKey:(NSString *)key
+{
+    [self.keys addObject:key];
+}
+
+
+- (void)parserDidEndObject:(TWTJSONStreamParser *)parser
+{
+    id container = self.containers.lastObject;
+    [self.containers removeLastObject];
+    [self addValue:container];
+}
+
+
+- (void)parserDidStartArray:(TWTJSONStreamParser *)parser
+{
+    [self.containers addObject:[[NSMutableArray alloc] init]];
+}
+
+
+- (void)parserDidEndArray:(TWTJSONStreamParser *)parser
+{
+    [self parserDidEndObject:parser];
+}
+
+
+- (void)parser:(TWTJSONStreamParser *)parser didReadValue:(id)value
+{
+    [self addValue:value];
+}
+
+@end
+
+
+#pragma mark
+
+/*!
+ TWTJSONTestRecordingArrayValidator counts the arrays it is asked to validate whole, which streamed arrays never are.
+ */
+@interface TWTJSONTestRecordingArrayValidator : TWTJSONSchemaArrayValidator
+
+@property (nonatomic, assign) NSUInteger validatedArrayCount;
+
+@end
+
+
+@implementation TWTJSONTestRecordingArrayValidator
+
+- (BOOL)validateJSONValue:(id)value ofType:(TWTJSONType)type context:(TWTValidationContext *)context error:(out NSError *__autoreleasing *)outError
+{
+    self.validatedArrayCount++;
+    return [super validateJSONValue:value ofType:type context:context error:outError];
+}
+
+@end
+
+
+#pragma mark
+
+@interface TWTJSONStreamingValidatorTestCase : TWTRandomizedTestCase
+
+- (void)testParserMatchesJSONSerialization;
+- (void)testParserRejectsMalformedJSON;
+- (void)testParserNumbersMatchJSONSerialization;
+- (void)testParserRejectsLoneSurrogates;
+- (void)testStreamingValidationMatchesValidateValue;
+- (void)testStreamingValidationOfDuplicateKeys;
+- (void)testStreamingValidationOfImpliedTypeArrays;
+- (void)testStreamingValidationSources;
+
+@end
+
+
+@implementation TWTJSONStreamingValidatorTestCase
+
+- (NSData *)draft4SchemaData
+{
+    NSString *path = [[NSBundle bundleForClass:[TWTJSONObjectValidator class]] pathForResource:@"JSONSchemaDraft4" ofType:@"json"];
+    return [NSData dataWithContentsOfFile:path];
+}
+
+
+- (id)objectByParsingData:(NSData *)data inChunksOfLength:(NSUInteger)chunkLength error:(NSError *__autoreleasing *)outError
+{
+    TWTJSONTestMaterializingDelegate *delegate = [[TWTJSONTestMaterializingDelegate alloc] init];
+    TWTJSONStreamParser *parser = [[TWTJSONStreamParser alloc] init];
+    parser.delegate = delegate;
+
+    for (NSUInteger location = 0; location < data.length; location += chunkLength) {
+        NSData *chunk = [data subdataWithRange:NSMakeRange(location, MIN(chunkLength, data.length - location))];
+        if (![parser parseData:chunk error:outError]) {
+            return nil;
+        }
+    }
+
+    return [parser finishParsingWithError:outError] ? delegate.result : nil;
+}
+
+
+- (void)testParserMatchesJSONSerialization
+{
+    NSArray *documents = @[ @"{\"a\" : [1, -2.5, 3e2, true, false, null], \"b\" : {\"c\" : \"d\"}}",
+                            @"[\"esc\\\"aped\\\\\", \"\\u00e9\\ud83d\\ude00\\n\", \"café\", 9223372036854775807, 1e400]",
+                            @"  [ [ ], { }, [ [ [ 0 ] ] ] ]  ",
+                            @"\"top-level string\"",
+                            @"-0.125" ];
+
+    for (NSString *document in documents) {
+        NSData *data = [document dataUsingEncoding:NSUTF8StringEncoding];
+        id expectedObject = [NSJSONSerialization JSONObjectWithData:data options:NSJSONReadingAllowFragments error:NULL];
+
+        NSError *error = nil;
+        id object = [self objectByParsingData:data inChunksOfLength:data.length error:&error];
+        XCTAssertEqualObjects(object, expectedObject, @"incorrect result for %@", document);
+        XCTAssertNil(error, @"error is non-nil for %@", document);
+
+        // Splitting the document into small chunks shouldn’t change anything
+        object = [self objectByParsingData:data inChunksOfLength:1 + random() % 4 error:&error];
+        XCTAssertEqualObjects(object, expectedObject, @"incorrect result for chunked %@", document);
+    }
+
+    NSData *draft4Data = [self draft4SchemaData];
+    id draft4 = [NSJSONSerialization JSONObjectWithData:draft4Data options:0 error:NULL];
+    XCTAssertEqualObjects([self objectByParsingData:draft4Data inChunksOfLength:1 + random() % 64 error:NULL], draft4, @"incorrect result for draft 4 schema");
+}
+
+
+- (void)testParserRejectsMalformedJSON
+{
+    NSArray *documents = @[ @"", @"[1, 2", @"{\"a\" 1}", @"{\"a\" : 1,}", @"[01]", @"[1.]", @"[tru]", @"\"unterminated",
+                            @"[\"bad \\x escape\"]", @"{1 : 2}", @"[1] [2]", @"[1}" ];
+
+    for (NSString *document in documents) {
+        NSData *data = [document dataUsingEncoding:NSUTF8StringEncoding];
+        NSError *error = nil;
+        XCTAssertNil([self objectByParsingData:data inChunksOfLength:MAX(data.length, 1) error:&error], @"parsed malformed %@", document);
+        XCTAssertEqualObjects(error.domain, TWTValidationErrorDomain, @"incorrect error domain for %@", document);
+        XCTAssertEqual(error.code, TWTValidationErrorCodeMalformedJSON, @"incorrect error code for %@", document);
+    }
+}
+
+
+- (void)testParserNumbersMatchJSONSerialization
+{
+    NSArray *documents = @[ @"-0", @"0", @"-0.0", @"9223372036854775807", @"-9223372036854775808", @"9223372036854775808",
+                            @"-9223372036854775809", @"123456789012345678901234567890", @"-123456789012345678901234567890" ];
+
+    for (NSString *document in documents) {
+        NSData *data = [document dataUsingEncoding:NSUTF8StringEncoding];
+        NSNumber *expectedNumber = [NSJSONSerialization JSONObjectWithData:data options:NSJSONReadingAllowFragments error:NULL];
+        NSNumber *number = [self objectByParsingData:data inChunksOfLength:data.length error:NULL];
+
+        XCTAssertEqualObjects(number, expectedNumber, @"incorrect result for %@", document);
+        XCTAssertEqual([number isKindOfClass:[NSDecimalNumber class]], [expectedNumber isKindOfClass:[NSDecimalNumber class]], @"incorrect class for %@", document);
+        XCTAssertEqual(strcmp(number.objCType, expectedNumber.objCType), 0, @"incorrect type for %@", document);
+        XCTAssertEqual(signbit(number.doubleValue), signbit(expectedNumber.doubleValue), @"incorrect sign for %@", document);
+    }
+
+    // Validation depends on the number’s type, so streaming validation must see the same numbers
+    TWTJSONObjectValidator *validator = [TWTJSONObjectValidator validatorWithJSONSchema:@{ @"type" : @"array", @"items" : @{ @"type" : @"integer", @"maximum" : @0 } }
+                                                                                  error:NULL
+                                                                               warnings:NULL];
+    TWTJSONStreamingValidator *streamingValidator = [[TWTJSONStreamingValidator alloc] initWithValidator:validator];
+    for (NSString *document in documents) {
+        NSData *data = [[NSString stringWithFormat:@"[%@]", document] dataUsingEncoding:NSUTF8StringEncoding];
+        BOOL expectedValidated = [validator validateValue:[NSJSONSerialization JSONObjectWithData:data options:0 error:NULL] error:NULL];
+        XCTAssertEqual([streamingValidator validateJSONData:data error:NULL], expectedValidated, @"incorrect result for %@", document);
+    }
+}
+
+
+- (void)testParserRejectsLoneSurrogates
+{
+    NSArray *documents = @[ @"[\"\\ud800\"]", @"[\"\\udc00\"]", @"[\"\\ud800x\"]", @"[\"\\ud800\\u0041\"]", @"[\"\\ud800\\ud800\"]",
+                            @"[\"\\udc00\\ud800\"]", @"{\"\\ud83d\" : 1}" ];
+
+    for (NSString *document in documents) {
+        NSData *data = [document dataUsingEncoding:NSUTF8StringEncoding];
+        XCTAssertNil([NSJSONSerialization JSONObjectWithData:data options:0 error:NULL], @"NSJSONSerialization parsed %@", document);
+
+        NSError *error = nil;
+        XCTAssertNil([self objectByParsingData:data inChunksOfLength:1 + random() % 4 error:&error], @"parsed lone surrogate in %@", document);
+        XCTAssertEqual(error.code, TWTValidationErrorCodeMalformedJSON, @"incorrect error code for %@", document);
+    }
+
+    NSData *pairData = [@"[\"\\ud83d\\ude00\"]" dataUsingEncoding:NSUTF8StringEncoding];
+    XCTAssertEqualObjects([self objectByParsingData:pairData inChunksOfLength:1 + random() % 4 error:NULL], @[ @"\U0001F600" ], @"incorrect surrogate pair");
+}
+
+
+- (void)testStreamingValidationMatchesValidateValue
+{
+    NSDictionary *itemSchema = @{ @"type" : @"object",
+                                  @"properties" : @{ @"id" : @{ @"type" : @"integer", @"minimum" : @0 },
+                                                     @"tags" : @{ @"type" : @"array", @"items" : @{ @"type" : @"string" }, @"maxItems" : @3 },
+                                                     @"color" : @{ @"enum" : @[ @"red", @"green" ] } },
+                                  @"patternProperties" : @{ @"^x-" : @{ @"type" : @"string" } },
+                                  @"additionalProperties" : @NO,
+                                  @"required" : @[ @"id" ],
+                                  @"dependencies" : @{ @"color" : @[ @"tags" ] } };
+    NSDictionary *schema = @{ @"type" : @"array", @"items" : itemSchema, @"minItems" : @1 };
+
+    TWTJSONObjectValidator *validator = [TWTJSONObjectValidator validatorWithJSONSchema:schema error:NULL warnings:NULL];
+    XCTAssertNotNil(validator, @"validator is nil");
+    TWTJSONStreamingValidator *streamingValidator = [[TWTJSONStreamingValidator alloc] initWithValidator:validator];
+
+    NSArray *documents = @[ @"[]",
+                            @"[{\"id\" : 1}]",
+                            @"[{\"id\" : 1, \"tags\" : [\"a\", \"b\"], \"color\" : \"red\", \"x-note\" : \"hi\"}]",
+                            @"[{\"id\" : -1}]",
+                            @"[{\"tags\" : [\"a\"]}]",
+                            @"[{\"id\" : 1, \"tags\" : [\"a\", \"b\", \"c\", \"d\"]}]",
+                            @"[{\"id\" : 1, \"tags\" : [1]}]",
+                            @"[{\"id\" : 1, \"color\" : \"blue\", \"tags\" : []}]",
+                            @"[{\"id\" : 1, \"color\" : \"red\"}]",
+                            @"[{\"id\" : 1, \"x-note\" : 2}]",
+                            @"[{\"id\" : 1, \"extra\" : {\"deeply\" : [\"nested\"]}}]",
+                            @"[{\"id\" : 1}, 2, \"three\", null]",
+                            @"{\"id\" : 1}" ];
+
+    for (NSString *document in documents) {
+        NSData *data = [document dataUsingEncoding:NSUTF8StringEncoding];
+        id object = [NSJSONSerialization JSONObjectWithData:data options:0 error:NULL];
+
+        NSError *expectedError = nil;
+        BOOL expectedValidated = [validator validateValue:object error:&expectedError];
+
+        NSError *error = nil;
+        XCTAssertEqual([streamingValidator validateJSONData:data error:&error], expectedValidated, @"incorrect result for %@", document);
+        XCTAssertEqual([streamingValidator validateJSONData:data error:NULL], expectedValidated, @"incorrect result without error for %@", document);
+        if (expectedValidated) {
+            XCTAssertNil(error, @"error is non-nil for %@", document);
+        } else {
+            XCTAssertEqual(error.code, expectedError.code, @"incorrect error code for %@", document);
+            XCTAssertEqual(error.twt_underlyingErrors.count, expectedError.twt_underlyingErrors.count, @"incorrect underlying errors for %@", document);
+        }
+    }
+
+    // The draft 4 meta-schema exercises $ref, anyOf, and schema dependencies, which are validated by materializing
+    NSData *draft4Data = [self draft4SchemaData];
+    id draft4 = [NSJSONSerialization JSONObjectWithData:draft4Data options:0 error:NULL];
+    TWTJSONObjectValidator *draft4Validator = [TWTJSONObjectValidator validatorWithJSONSchema:draft4 error:NULL warnings:NULL];
+    streamingValidator = [[TWTJSONStreamingValidator alloc] initWithValidator:draft4Validator];
+    XCTAssertTrue([streamingValidator validateJSONData:draft4Data error:NULL], @"draft 4 schema does not validate itself");
+
+    NSData *invalidSchemaData = [@"{\"type\" : \"foo\", \"properties\" : {\"a\" : {\"minimum\" : \"1\"}}}" dataUsingEncoding:NSUTF8StringEncoding];
+    XCTAssertFalse([streamingValidator validateJSONData:invalidSchemaData error:NULL], @"invalid schema passes draft 4 schema");
+}
+
+
+- (void)testStreamingValidationOfDuplicateKeys
+{
+    NSDictionary *schema = @{ @"type" : @"object", @"properties" : @{ @"a" : @{ @"type" : @"integer" } }, @"maxProperties" : @1 };
+    TWTJSONObjectValidator *validator = [TWTJSONObjectValidator validatorWithJSONSchema:schema error:NULL warnings:NULL];
+    TWTJSONStreamingValidator *streamingValidator = [[TWTJSONStreamingValidator alloc] initWithValidator:validator];
+
+    // Every value of a duplicated key is validated, and each occurrence counts toward the number of properties
+    NSData *data = [@"{\"a\" : \"one\", \"a\" : 1}" dataUsingEncoding:NSUTF8StringEncoding];
+    NSError *error = nil;
+    XCTAssertFalse([streamingValidator validateJSONData:data error:&error], @"passes invalid duplicate value");
+    XCTAssertNotNil(error, @"error is nil");
+
+    data = [@"{\"a\" : 1, \"a\" : 2}" dataUsingEncoding:NSUTF8StringEncoding];
+    error = nil;
+    XCTAssertFalse([streamingValidator validateJSONData:data error:&error], @"passes too many properties");
+    XCTAssertNotNil(error, @"error is nil");
+
+    data = [@"{\"a\" : 1, \"b\" : {\"c\" : [2]}}" dataUsingEncoding:NSUTF8StringEncoding];
+    XCTAssertFalse([streamingValidator validateJSONData:data error:NULL], @"passes too many properties");
+    data = [@"{\"a\" : 1}" dataUsingEncoding:NSUTF8StringEncoding];
+    XCTAssertTrue([streamingValidator validateJSONData:data error:NULL], @"fails valid object");
+}
+
+
+- (void)testStreamingValidationOfImpliedTypeArrays
+{
+    // Schemas without a type keyword are simplified into implied type validators, which shouldn’t stop streaming
+    TWTValidator *integerValidator = [TWTJSONObjectValidator validatorWithJSONSchema:@{ @"type" : @"integer" } error:NULL warnings:NULL];
+    TWTJSONTestRecordingArrayValidator *innerArrayValidator = [[TWTJSONTestRecordingArrayValidator alloc] initWithMinimumItemCount:nil
+                                                                                                                  maximumItemCount:nil
+                                                                                                               requiresUniqueItems:NO
+                                                                                                                     itemValidator:integerValidator
+                                                                                                             indexedItemValidators:nil
+                                                                                                          additionalItemsValidator:nil];
+    TWTValidator *innerValidator = [[TWTJSONSchemaImpliedTypeValidator alloc] initWithImpliedTypes:TWTJSONTypeMaskArray typeValidator:innerArrayValidator];
+    TWTJSONTestRecordingArrayValidator *outerArrayValidator = [[TWTJSONTestRecordingArrayValidator alloc] initWithMinimumItemCount:@1
+                                                                                                                  maximumItemCount:nil
+                                                                                                               requiresUniqueItems:NO
+                                                                                                                     itemValidator:innerValidator
+                                                                                                             indexedItemValidators:nil
+                                                                                                          additionalItemsValidator:nil];
+    TWTValidator *validator = [[TWTJSONSchemaImpliedTypeValidator alloc] initWithImpliedTypes:TWTJSONTypeMaskArray typeValidator:outerArrayValidator];
+    TWTJSONStreamingValidator *streamingValidator = [[TWTJSONStreamingValidator alloc] initWithValidator:validator];
+
+    NSUInteger arrayCount = 100 + random() % 100;
+    NSArray *arrays = UMKGeneratedArrayWithElementCount(arrayCount, ^id(NSUInteger index) {
+        return UMKGeneratedArrayWithElementCount(1 + random() % 100, ^id(NSUInteger itemIndex) {
+            return @(random());
+        });
+    });
+
+    NSData *data = [NSJSONSerialization dataWithJSONObject:arrays options:0 error:NULL];
+    XCTAssertTrue([streamingValidator validateJSONData:data error:NULL], @"fails valid arrays");
+    XCTAssertEqual(outerArrayValidator.validatedArrayCount, (NSUInteger)0, @"outer array is materialized");
+    XCTAssertEqual(innerArrayValidator.validatedArrayCount, (NSUInteger)0, @"inner arrays are materialized");
+
+    NSMutableArray *invalidArrays = [arrays mutableCopy];
+    invalidArrays[random() % arrayCount] = @[ UMKRandomUnicodeString() ];
+    NSData *invalidData = [NSJSONSerialization dataWithJSONObject:invalidArrays options:0 error:NULL];
+    NSError *error = nil;
+    XCTAssertFalse([streamingValidator validateJSONData:invalidData error:&error], @"passes invalid arrays");
+    XCTAssertNotNil(error, @"returns nil error");
+    XCTAssertEqual(outerArrayValidator.validatedArrayCount, (NSUInteger)0, @"outer array is materialized");
+    XCTAssertEqual(innerArrayValidator.validatedArrayCount, (NSUInteger)0, @"inner arrays are materialized");
+
+    // Validating the arrays whole validates each of them
+    XCTAssertTrue([validator validateValue:arrays error:NULL], @"fails valid arrays");
+    XCTAssertEqual(outerArrayValidator.validatedArrayCount, (NSUInteger)1, @"incorrect outer array count");
+    XCTAssertEqual(innerArrayValidator.validatedArrayCount, arrayCount, @"incorrect inner array count");
+}
+
+
+- (void)testStreamingValidationSources
+{
+    TWTJSONObjectValidator *validator = [TWTJSONObjectValidator validatorWithJSONSchema:@{ @"type" : @"array", @"items" : @{ @"type" : @"integer" } }
+                                                                                  error:NULL
+                                                                               warnings:NULL];
+    TWTJSONStreamingValidator *streamingValidator = [[TWTJSONStreamingValidator alloc] initWithValidator:validator];
+
+    // Make a document large enough to span several input stream chunks
+    NSMutableString *document = [[NSMutableString alloc] initWithString:@"["];
+    NSUInteger itemCount = 50000 + random() % 10000;
+    for (NSUInteger i = 0; i < itemCount; ++i) {
+        [document appendFormat:@"%@%lu", i > 0 ? @", " : @"", (unsigned long)random()];
+    }
+
+    [document appendString:@"]"];
+    NSData *data = [document dataUsingEncoding:NSUTF8StringEncoding];
+
+    NSError *error = nil;
+    XCTAssertTrue([streamingValidator validateJSONInputStream:[NSInputStream inputStreamWithData:data] error:&error], @"valid stream fails");
+    XCTAssertNil(error, @"error is non-nil");
+
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+    XCTAssertTrue([data writeToFile:path atomically:YES], @"could not write test file");
+    XCTAssertTrue([streamingValidator validateJSONContentsOfFile:path error:&error], @"valid file fails");
+    [[NSFileManager defaultManager] removeItemAtPath:path error:NULL];
+
+    XCTAssertFalse([streamingValidator validateJSONContentsOfFile:path error:&error], @"missing file passes");
+    XCTAssertNotNil(error, @"error is nil for missing file");
+
+    NSData *malformedData = [data subdataWithRange:NSMakeRange(0, data.length - 1)];
+    error = nil;
+    XCTAssertFalse([streamingValidator validateJSONInputStream:[NSInputStream inputStreamWithData:malformedData] error:&error], @"truncated stream passes");
+    XCTAssertEqual(error.code, TWTValidationErrorCodeMalformedJSON, @"incorrect error code for truncated stream");
+}
+
+@end
@@ -0,0 +1,134 @@
+//
+//  TWTJSONTypeTestCase.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "TWTRandomizedTestCase.h"
+
+#import <TWTValidation/TWTValidation.h>
+#import <TWTValidation/TWTJSONSchemaTypeValidator.h>
+
+
+@interface TWTJSONTypeTestCase : TWTRandomizedTestCase
+
+- (void)testTypeOfValue;
+- (void)testTypeMaskForSchemaTypes;
+- (void)testTypeValidator;
+- (void)testAmbiguousTypeValidator;
+
+@end
+
+
+@implementation TWTJSONTypeTestCase
+
+- (void)testTypeOfValue
+{
+    XCTAssertEqual(TWTJSONTypeOfValue(nil), TWTJSONTypeNone, @"nil has a JSON type");
+    XCTAssertEqual(TWTJSONTypeOfValue([NSDate date]), TWTJSONTypeNone, @"date has a JSON type");
+    XCTAssertEqual(TWTJSONTypeOfValue([NSNull null]), TWTJSONTypeNull, @"incorrect type for null");
+    XCTAssertEqual(TWTJSONTypeOfValue(@YES), TWTJSONTypeBoolean, @"incorrect type for boolean");
+    XCTAssertEqual(TWTJSONTypeOfValue([NSNumber numberWithBool:NO]), TWTJSONTypeBoolean, @"incorrect type for boolean");
+    XCTAssertEqual(TWTJSONTypeOfValue(@(random())), TWTJSONTypeInteger, @"incorrect type for integer");
+    XCTAssertEqual(TWTJSONTypeOfValue(@((char)1)), TWTJSONTypeInteger, @"incorrect type for char");
+    XCTAssertEqual(TWTJSONTypeOfValue(@3.0), TWTJSONTypeInteger, @"incorrect type for integral double");
+    XCTAssertEqual(TWTJSONTypeOfValue(@3.5), TWTJSONTypeNumber, @"incorrect type for double");
+    XCTAssertEqual(TWTJSONTypeOfValue([NSDecimalNumber decimalNumberWithString:@"0.25"]), TWTJSONTypeNumber, @"incorrect type for decimal");
+    XCTAssertEqual(TWTJSONTypeOfValue(UMKRandomUnicodeString()), TWTJSONTypeString, @"incorrect type for string");
+    XCTAssertEqual(TWTJSONTypeOfValue(@[ ]), TWTJSONTypeArray, @"incorrect type for array");
+    XCTAssertEqual(TWTJSONTypeOfValue(@{ }), TWTJSONTypeObject, @"incorrect type for object");
+
+    // Numbers include integers
+    XCTAssertTrue(TWTJSONTypeMaskContainsType(TWTJSONTypeMaskNumber, TWTJSONTypeInteger), @"numbers do not include integers");
+    XCTAssertFalse(TWTJSONTypeMaskContainsType(TWTJSONTypeMaskInteger, TWTJSONTypeNumber), @"integers include numbers");
+    XCTAssertFalse(TWTJSONTypeMaskContainsType(TWTJSONTypeMaskAll, TWTJSONTypeNone), @"all types include non-JSON values");
+}
+
+
+- (void)testTypeMaskForSchemaTypes
+{
+    XCTAssertEqual(TWTJSONTypeMaskForSchemaTypes([NSSet set]), (TWTJSONTypeMask)0, @"incorrect mask for no types");
+    XCTAssertEqual(TWTJSONTypeMaskForSchemaTypes([NSSet setWithObject:@"integer"]), TWTJSONTypeMaskInteger, @"incorrect mask for integer");
+    XCTAssertEqual(TWTJSONTypeMaskForSchemaTypes([NSSet setWithObject:@"any"]), TWTJSONTypeMaskAll, @"incorrect mask for any");
+
+    NSSet *types = [NSSet setWithObjects:@"number", @"string", @"null", nil];
+    XCTAssertEqual(TWTJSONTypeMaskForSchemaTypes(types), (TWTJSONTypeMask)(TWTJSONTypeMaskNumber | TWTJSONTypeMaskString | TWTJSONTypeMaskNull),
+                   @"incorrect mask for multiple types");
+    XCTAssertEqualObjects(TWTJSONTypeMaskDescription(TWTJSONTypeMaskForSchemaTypes(types)), @"number, null, string", @"incorrect description");
+}
+
+
+- (void)testTypeValidator
+{
+    TWTJSONSchemaTypeValidator *validator = [[TWTJSONSchemaTypeValidator alloc] initWithTypes:TWTJSONTypeMaskNumber | TWTJSONTypeMaskNull];
+    XCTAssertEqual(validator.types, (TWTJSONTypeMask)(TWTJSONTypeMaskNumber | TWTJSONTypeMaskNull), @"types not set correctly");
+    XCTAssertEqualObjects(validator, [[TWTJSONSchemaTypeValidator alloc] initWithTypes:TWTJSONTypeMaskNumber | TWTJSONTypeMaskNull], @"equal validators are not equal");
+
+    XCTAssertTrue([validator validateValue:@1 error:NULL], @"fails with integer");
+    XCTAssertTrue([validator validateValue:@1.5 error:NULL], @"fails with number");
+    XCTAssertTrue([validator validateValue:[NSNull null] error:NULL], @"fails with null");
+
+    NSError *error = nil;
+    XCTAssertFalse([validator validateValue:@NO error:&error], @"passes with boolean");
+    XCTAssertNotNil(error, @"returns nil error");
+    XCTAssertEqual(error.code, TWTValidationErrorCodeValueHasIncorrectClass, @"incorrect error code");
+    XCTAssertEqualObjects(error.twt_failingValidator, validator, @"incorrect failing validator");
+
+    error = nil;
+    XCTAssertFalse([validator validateValue:nil error:&error], @"passes with nil");
+    XCTAssertNotNil(error, @"returns nil error");
+
+    // The type isn’t checked again if it’s known
+    XCTAssertTrue([validator validateJSONValue:@"string" ofType:TWTJSONTypeNumber error:NULL], @"fails with known type");
+}
+
+
+- (void)testAmbiguousTypeValidator
+{
+    TWTValidator *integerValidator = [[TWTNumberValidator alloc] initWithMinimum:@10 maximum:nil];
+    integerValidator = [TWTCompoundValidator andValidatorWithSubvalidators:@[ [[TWTJSONSchemaTypeValidator alloc] initWithTypes:TWTJSONTypeMaskInteger],
+                                                                              integerValidator ]];
+    TWTValidator *numberValidator = [TWTCompoundValidator andValidatorWithSubvalidators:@[ [[TWTJSONSchemaTypeValidator alloc] initWithTypes:TWTJSONTypeMaskNumber],
+                                                                                          [[TWTNumberValidator alloc] initWithMinimum:nil maximum:@5] ]];
+    TWTValidator *stringValidator = [TWTStringValidator stringValidatorWithLength:2];
+
+    TWTJSONSchemaAmbiguousTypeValidator *validator = [[TWTJSONSchemaAmbiguousTypeValidator alloc] initWithSubvalidators:@[ integerValidator, numberValidator, stringValidator ]
+                                                                                                                  types:@[ @(TWTJSONTypeMaskInteger),
+                                                                                                                           @(TWTJSONTypeMaskNumber),
+                                                                                                                           @(TWTJSONTypeMaskString) ]];
+    TWTCompoundValidator *orValidator = [TWTCompoundValidator orValidatorWithSubvalidators:@[ integerValidator, numberValidator, stringValidator ]];
+
+    NSArray *values = @[ @12, @12.5, @4, @4.5, @7, @"ab", @"abc", @YES, [NSNull null], @[ ], @{ } ];
+    for (id value in values) {
+        NSError *error = nil;
+        BOOL validated = [orValidator validateValue:value error:NULL];
+        XCTAssertEqual([validator validateValue:value error:&error], validated, @"result differs from or validator for %@", value);
+        XCTAssertEqual((BOOL)(error != nil), (BOOL)!validated, @"error is incorrect for %@", value);
+    }
+
+    NSError *error = nil;
+    XCTAssertFalse([validator validateValue:@YES error:&error], @"passes with boolean");
+    XCTAssertEqual(error.code, TWTValidationErrorCodeValueHasIncorrectClass, @"incorrect error code");
+}
+
+@end
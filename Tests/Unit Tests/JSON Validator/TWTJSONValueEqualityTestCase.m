@@ -0,0 +1,153 @@
+//
+//  TWTJSONValueEqualityTestCase.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "TWTRandomizedTestCase.h"
+
+#import <TWTValidation/TWTValidation.h>
+
+
+@interface TWTJSONValueEqualityTestCase : TWTRandomizedTestCase
+
+- (void)testEquality;
+- (void)testHashConsistency;
+- (void)testUniqueStrings;
+- (void)testUniqueNumbers;
+- (void)testUniqueMixedValues;
+
+@end
+
+
+@implementation TWTJSONValueEqualityTestCase
+
+- (NSArray *)equalValuePairs
+{
+    return @[ @[ [NSNull null], [NSNull null] ],
+              @[ @YES, @YES ],
+              @[ @1, @1.0 ],
+              @[ @-0.0, @0 ],
+              @[ @(9007199254740993LL), @(9007199254740993ULL) ],
+              @[ @2.5, @2.5f ],
+              @[ @"abc", [@"ab" stringByAppendingString:@"c"] ],
+              @[ @[ @1, @"a", @[ @NO ] ], @[ @1.0, @"a", @[ @NO ] ] ],
+              @[ @{ @"a" : @1, @"b" : @[ @2 ] }, @{ @"b" : @[ @2.0 ], @"a" : @1 } ] ];
+}
+
+
+- (NSArray *)unequalValuePairs
+{
+    return @[ @[ @YES, @1 ],
+              @[ @NO, @0 ],
+              @[ @YES, @NO ],
+              @[ [NSNull null], @0 ],
+              @[ @1, @1.5 ],
+              @[ @(9007199254740993LL), @(9007199254740992LL) ],
+              @[ @"1", @1 ],
+              @[ @"abc", @"abd" ],
+              @[ @[ @1, @2 ], @[ @2, @1 ] ],
+              @[ @[ @1 ], @[ @1, @1 ] ],
+              @[ @[ @1 ], @[ @YES ] ],
+              @[ @{ @"a" : @1 }, @{ @"a" : @YES } ],
+              @[ @{ @"a" : @1 }, @{ @"b" : @1 } ],
+              @[ @{ @"a" : @1 }, @[ @"a", @1 ] ] ];
+}
+
+
+- (void)testEquality
+{
+    for (NSArray *pair in [self equalValuePairs]) {
+        XCTAssertTrue(TWTJSONValuesAreEqual(pair[0], pair[1]), @"%@ and %@ are not equal", pair[0], pair[1]);
+        XCTAssertTrue(TWTJSONValuesAreEqual(pair[1], pair[0]), @"%@ and %@ are not equal", pair[1], pair[0]);
+    }
+
+    for (NSArray *pair in [self unequalValuePairs]) {
+        XCTAssertFalse(TWTJSONValuesAreEqual(pair[0], pair[1]), @"%@ and %@ are equal", pair[0], pair[1]);
+        XCTAssertFalse(TWTJSONValuesAreEqual(pair[1], pair[0]), @"%@ and %@ are equal", pair[1], pair[0]);
+    }
+}
+
+
+- (void)testHashConsistency
+{
+    for (NSArray *pair in [self equalValuePairs]) {
+        XCTAssertEqual(TWTJSONValueHash(pair[0]), TWTJSONValueHash(pair[1]), @"equal values %@ and %@ have different hashes", pair[0], pair[1]);
+    }
+}
+
+
+- (void)testUniqueStrings
+{
+    NSUInteger count = 1000 + random() % 1000;
+    NSMutableArray *strings = [[NSMutableArray alloc] initWithCapacity:count];
+    for (NSUInteger i = 0; i < count; ++i) {
+        [strings addObject:[NSString stringWithFormat:@"%@-%lu", UMKRandomAlphanumericString(), (unsigned long)i]];
+    }
+
+    XCTAssertTrue(TWTJSONArrayHasUniqueItems(strings), @"unique strings are not unique");
+    XCTAssertTrue(TWTJSONArrayHasUniqueItems(@[ ]), @"empty array is not unique");
+    XCTAssertTrue(TWTJSONArrayHasUniqueItems(@[ @"a" ]), @"single item array is not unique");
+
+    [strings insertObject:[strings[random() % count] mutableCopy] atIndex:random() % count];
+    XCTAssertFalse(TWTJSONArrayHasUniqueItems(strings), @"duplicate strings are unique");
+}
+
+
+- (void)testUniqueNumbers
+{
+    NSUInteger count = 1000 + random() % 1000;
+    NSMutableArray *numbers = [[NSMutableArray alloc] initWithCapacity:count];
+    for (NSUInteger i = 0; i < count; ++i) {
+        [numbers addObject:(i % 2) ? @(i) : @(i + 0.5)];
+    }
+
+    XCTAssertTrue(TWTJSONArrayHasUniqueItems(numbers), @"unique numbers are not unique");
+    XCTAssertTrue(TWTJSONArrayHasUniqueItems(@[ @(9007199254740993LL), @(9007199254740992LL) ]), @"large integers are not unique");
+
+    [numbers addObject:@1.0];
+    XCTAssertFalse(TWTJSONArrayHasUniqueItems(numbers), @"1 and 1.0 are unique");
+    XCTAssertFalse(TWTJSONArrayHasUniqueItems(@[ @0, @-0.0 ]), @"0 and -0 are unique");
+}
+
+
+- (void)testUniqueMixedValues
+{
+    XCTAssertTrue(TWTJSONArrayHasUniqueItems(@[ @1, @YES ]), @"1 and true are not unique");
+    XCTAssertTrue(TWTJSONArrayHasUniqueItems(@[ @0, @NO, [NSNull null], @"0", @[ @0 ], @{ @"0" : @0 } ]), @"distinct values are not unique");
+    XCTAssertTrue(TWTJSONArrayHasUniqueItems(@[ @{ @"a" : @1 }, @{ @"a" : @YES } ]), @"distinct objects are not unique");
+
+    XCTAssertFalse(TWTJSONArrayHasUniqueItems(@[ @YES, @1, @YES ]), @"duplicate booleans are unique");
+    XCTAssertFalse(TWTJSONArrayHasUniqueItems(@[ [NSNull null], @"a", [NSNull null] ]), @"duplicate nulls are unique");
+    XCTAssertFalse(TWTJSONArrayHasUniqueItems(@[ @{ @"a" : @1, @"b" : @2 }, @"x", @{ @"b" : @2.0, @"a" : @1 } ]), @"duplicate objects are unique");
+    XCTAssertFalse(TWTJSONArrayHasUniqueItems(@[ @[ @1, @[ @2 ] ], @[ @1.0, @[ @2 ] ] ]), @"duplicate arrays are unique");
+
+    // The schema validator should use the same semantics
+    TWTJSONObjectValidator *validator = [TWTJSONObjectValidator validatorWithJSONSchema:@{ @"type" : @"array", @"uniqueItems" : @YES } error:NULL warnings:NULL];
+    XCTAssertTrue([validator validateValue:@[ @1, @YES, @0, @NO ] error:NULL], @"numbers and booleans are not unique");
+    NSError *error = nil;
+    XCTAssertFalse([validator validateValue:@[ @1, @YES, @1.0 ] error:&error], @"1 and 1.0 are unique");
+    XCTAssertNotNil(error, @"error is nil");
+}
+
+@end
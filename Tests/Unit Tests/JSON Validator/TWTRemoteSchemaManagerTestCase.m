@@ -9,7 +9,9 @@
 #import "TWTRandomizedTestCase.h"
 
 #import <TWTValidation/TWTJSONRemoteSchemaManager.h>
+#import <TWTValidation/TWTJSONSchemaParser.h>
 #import <TWTValidation/TWTJSONSchemaReferenceASTNode.h>
+#import <TWTValidation/TWTJSONSchemaTopLevelASTNode.h>
 
 
 @interface TWTRemoteSchemaManagerTestCase : TWTRandomizedTestCase
@@ -145,4 +147,120 @@
     XCTAssertNoThrow([remoteManager loadSchemaForReferencePath:validPath filePath:nil pathComponents:nil error:nil]);
 }
 
+
+- (NSString *)temporaryFilePathWithJSONObject:(id)object
+{
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[[[NSUUID UUID] UUIDString] stringByAppendingPathExtension:@"json"]];
+    [[NSJSONSerialization dataWithJSONObject:object options:0 error:NULL] writeToFile:path atomically:YES];
+    return path;
+}
+
+
+- (TWTJSONSchemaASTNode *)remoteNodeForFilePath:(NSString *)path manager:(TWTJSONRemoteSchemaManager *)remoteManager
+{
+    NSString *filePath;
+    NSArray *pathComponents;
+    if (![remoteManager loadSchemaForReferencePath:path filePath:&filePath pathComponents:&pathComponents error:nil]) {
+        return nil;
+    }
+
+    TWTJSONSchemaReferenceASTNode *referenceNode = [[TWTJSONSchemaReferenceASTNode alloc] init];
+    referenceNode.filePath = filePath;
+    referenceNode.referencePathComponents = pathComponents;
+    return [remoteManager remoteNodeForReferenceNode:referenceNode];
+}
+
+
+- (void)testSharedManager
+{
+    TWTJSONRemoteSchemaManager *sharedManager = [TWTJSONRemoteSchemaManager sharedManager];
+    XCTAssertNotNil(sharedManager, @"shared manager is nil");
+    XCTAssertEqual(sharedManager, [TWTJSONRemoteSchemaManager sharedManager], @"shared manager is not shared");
+
+    TWTJSONSchemaASTNode *node = [self remoteNodeForFilePath:TWTJSONSchemaKeywordDraft4Path manager:sharedManager];
+    XCTAssertNotNil(node, @"draft 4 schema could not be loaded");
+    XCTAssertEqual([self remoteNodeForFilePath:TWTJSONSchemaKeywordDraft4Path manager:sharedManager], node, @"draft 4 schema was parsed twice");
+}
+
+
+- (void)testModificationDateInvalidation
+{
+    NSString *path = [self temporaryFilePathWithJSONObject:@{ @"type" : @"integer" }];
+    TWTJSONRemoteSchemaManager *remoteManager = [[TWTJSONRemoteSchemaManager alloc] init];
+
+    TWTJSONSchemaASTNode *node = [self remoteNodeForFilePath:path manager:remoteManager];
+    XCTAssertNotNil(node, @"file could not be loaded");
+    XCTAssertEqual([self remoteNodeForFilePath:path manager:remoteManager], node, @"unchanged file was parsed twice");
+
+    [[NSFileManager defaultManager] setAttributes:@{ NSFileModificationDate : [NSDate dateWithTimeIntervalSinceNow:60] } ofItemAtPath:path error:NULL];
+    TWTJSONSchemaASTNode *modifiedNode = [self remoteNodeForFilePath:path manager:remoteManager];
+    XCTAssertNotNil(modifiedNode, @"modified file could not be loaded");
+    XCTAssertNotEqual(modifiedNode, node, @"modified file was not parsed again");
+
+    [remoteManager removeAllSchemas];
+    XCTAssertNotEqual([self remoteNodeForFilePath:path manager:remoteManager], modifiedNode, @"file was not parsed again after removing all schemas");
+
+    [[NSFileManager defaultManager] removeItemAtPath:path error:NULL];
+}
+
+
+- (void)testConcurrentLoads
+{
+    NSString *path = [self temporaryFilePathWithJSONObject:@{ @"type" : @"object", @"properties" : @{ @"id" : @{ @"type" : @"integer" } } }];
+    TWTJSONRemoteSchemaManager *remoteManager = [[TWTJSONRemoteSchemaManager alloc] init];
+
+    NSUInteger count = 16 + random() % 16;
+    NSPointerArray *nodes = [NSPointerArray strongObjectsPointerArray];
+    nodes.count = count;
+    NSLock *lock = [[NSLock alloc] init];
+
+    dispatch_apply(count, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t i) {
+        TWTJSONSchemaASTNode *node = [self remoteNodeForFilePath:path manager:remoteManager];
+        [lock lock];
+        [nodes replacePointerAtIndex:i withPointer:(__bridge void *)node];
+        [lock unlock];
+    });
+
+    TWTJSONSchemaASTNode *firstNode = (__bridge TWTJSONSchemaASTNode *)[nodes pointerAtIndex:0];
+    XCTAssertNotNil(firstNode, @"file could not be loaded");
+    for (NSUInteger i = 1; i < count; ++i) {
+        XCTAssertEqual((__bridge TWTJSONSchemaASTNode *)[nodes pointerAtIndex:i], firstNode, @"file was parsed more than once");
+    }
+
+    [[NSFileManager defaultManager] removeItemAtPath:path error:NULL];
+}
+
+
+- (void)testCyclicReference
+{
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[[[NSUUID UUID] UUIDString] stringByAppendingPathExtension:@"json"]];
+    [[NSJSONSerialization dataWithJSONObject:@{ @"properties" : @{ @"child" : @{ @"$ref" : path } } } options:0 error:NULL] writeToFile:path atomically:YES];
+
+    TWTJSONRemoteSchemaManager *remoteManager = [[TWTJSONRemoteSchemaManager alloc] init];
+    NSError *error;
+    XCTAssertFalse([remoteManager loadSchemaForReferencePath:path filePath:nil pathComponents:nil error:&error], @"cyclic file was successful");
+    XCTAssertEqual(error.code, TWTJSONRemoteSchemaManagerErrorCodeCyclicReferenceError, @"Error was not coded correctly for cyclic file");
+
+    [[NSFileManager defaultManager] removeItemAtPath:path error:NULL];
+}
+
+
+- (void)testParserRemoteSchemaManager
+{
+    NSString *path = [self temporaryFilePathWithJSONObject:@{ @"type" : @"integer" }];
+    TWTJSONRemoteSchemaManager *remoteManager = [[TWTJSONRemoteSchemaManager alloc] init];
+    TWTJSONSchemaASTNode *node = [self remoteNodeForFilePath:path manager:remoteManager];
+    XCTAssertNotNil(node, @"file could not be loaded");
+
+    TWTJSONSchemaParser *parser = [[TWTJSONSchemaParser alloc] initWithJSONSchema:@{ @"$ref" : path } remoteSchemaManager:remoteManager];
+    TWTJSONSchemaTopLevelASTNode *topLevelNode = [parser parseWithError:NULL warnings:NULL];
+    XCTAssertNotNil(topLevelNode, @"schema could not be parsed");
+
+    TWTJSONSchemaReferenceASTNode *referenceNode = (TWTJSONSchemaReferenceASTNode *)topLevelNode.schema;
+    XCTAssertEqual(referenceNode.referentNode, node, @"parser did not use its remote schema manager");
+    XCTAssertNotEqual([self remoteNodeForFilePath:path manager:[TWTJSONRemoteSchemaManager sharedManager]], node, @"file was loaded by the shared manager");
+
+    [[NSFileManager defaultManager] removeItemAtPath:path error:NULL];
+}
+
 @end
@@ -65,6 +65,7 @@
 - (void)testValidateValueErrorKeys;
 - (void)testValidateValueErrorValues;
 - (void)testValidateValueErrorKeyValuePairs;
+- (void)testValidateValueWideKeyValuePairs;
 
 @end
 
@@ -595,6 +596,55 @@
     }
 }
 
+
+- (void)testValidateValueWideKeyValuePairs
+{
+    // Wide collections with hundreds of known keys, some of which have more than one key-value pair validator
+    NSUInteger keyCount = 200 + random() % 200;
+    NSMutableDictionary *dictionary = [[NSMutableDictionary alloc] initWithCapacity:keyCount];
+    NSMutableArray *keyValuePairValidators = [[NSMutableArray alloc] init];
+    NSMutableArray *expectedErrors = [[NSMutableArray alloc] init];
+    for (NSUInteger i = 0; i < keyCount; ++i) {
+        NSString *key = [NSString stringWithFormat:@"key%lu", (unsigned long)i];
+        dictionary[key] = [self randomObject];
+
+        // Validators get equal keys that aren’t the same objects as the collection’s keys
+        [keyValuePairValidators addObject:[self passingKeyValuePairValidatorWithKey:[key mutableCopy]]];
+        if (i % 3 == 0) {
+            NSError *error = UMKRandomError();
+            [expectedErrors addObject:error];
+            [keyValuePairValidators addObject:[self failingKeyValuePairValidatorWithKey:[key mutableCopy] error:error]];
+        }
+    }
+
+    NSMapTable *mapTable = [NSMapTable strongToStrongObjectsMapTable];
+    for (id key in dictionary) {
+        [mapTable setObject:dictionary[key] forKey:key];
+    }
+
+    TWTKeyedCollectionValidator *validator = [[TWTKeyedCollectionValidator alloc] initWithCountValidator:nil
+                                                                                           keyValidators:nil
+                                                                                         valueValidators:nil
+                                                                                  keyValuePairValidators:keyValuePairValidators];
+    for (id collection in @[ dictionary, mapTable ]) {
+        XCTAssertFalse([validator validateValue:collection error:NULL], @"passes with failing key-value pair validators");
+
+        NSError *error = nil;
+        XCTAssertFalse([validator validateValue:collection error:&error], @"passes with failing key-value pair validators");
+        XCTAssertNotNil(error, @"error is nil");
+        XCTAssertEqual(error.code, TWTValidationErrorCodeKeyedCollectionValidatorError, @"incorrect error code");
+        XCTAssertEqualObjects([NSSet setWithArray:error.twt_keyValuePairValidationErrors], [NSSet setWithArray:expectedErrors],
+                              @"key-value pair validation errors is not set correctly");
+    }
+
+    // Removing the entries with failing validators makes the collection valid
+    for (NSUInteger i = 0; i < keyCount; i += 3) {
+        [dictionary removeObjectForKey:[NSString stringWithFormat:@"key%lu", (unsigned long)i]];
+    }
+
+    XCTAssertTrue([validator validateValue:dictionary error:NULL], @"fails with passing key-value pair validators");
+}
+
 @end
 
 
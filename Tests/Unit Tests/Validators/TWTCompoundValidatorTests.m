@@ -54,6 +54,8 @@
 - (void)testValidateValueErrorForMutualExclusionWithOneFailingValidator;
 - (void)testValidateValueErrorForMutualExclusionWithMultipleFailingValidators;
 
+- (void)testValidateValueErrorInFailFastMode;
+
 @end
 
 
@@ -538,4 +540,59 @@
     XCTAssertEqualObjects(error.twt_underlyingErrors, expectedErrors, @"incorrect underlying errors");
 }
 
+
+- (void)testValidateValueErrorInFailFastMode
+{
+    __block NSUInteger validationCount = 0;
+    TWTValidator *passingValidator = [[TWTBlockValidator alloc] initWithBlock:^BOOL(id value, NSError *__autoreleasing *outError) {
+        ++validationCount;
+        return YES;
+    }];
+
+    NSError *expectedError = UMKRandomError();
+    TWTValidator *failingValidator = [[TWTBlockValidator alloc] initWithBlock:^BOOL(id value, NSError *__autoreleasing *outError) {
+        ++validationCount;
+        if (outError) {
+            *outError = expectedError;
+        }
+
+        return NO;
+    }];
+
+    NSArray *subvalidators = @[ passingValidator, failingValidator, passingValidator, passingValidator, failingValidator ];
+
+    [TWTValidator setFailFastModeEnabled:YES];
+    XCTAssertTrue([TWTValidator isFailFastModeEnabled], @"fail-fast mode is not enabled");
+
+    NSError *error = nil;
+    TWTCompoundValidator *validator = [TWTCompoundValidator andValidatorWithSubvalidators:subvalidators];
+    XCTAssertFalse([validator validateValue:[self randomObject] error:&error], @"passes with failing validator");
+    XCTAssertEqual(validationCount, 2, @"And validator does not stop after first failure");
+    XCTAssertEqual(error.twt_underlyingErrors.count, 1, @"incorrect underlying errors");
+    XCTAssertEqual([error.twt_underlyingErrors.firstObject code], expectedError.code, @"incorrect underlying error code");
+
+    validationCount = 0;
+    validator = [TWTCompoundValidator orValidatorWithSubvalidators:subvalidators];
+    XCTAssertTrue([validator validateValue:[self randomObject] error:NULL], @"fails with passing validator");
+    XCTAssertEqual(validationCount, 1, @"Or validator does not stop after first success");
+
+    validationCount = 0;
+    validator = [TWTCompoundValidator mutualExclusionValidatorWithSubvalidators:subvalidators];
+    XCTAssertFalse([validator validateValue:[self randomObject] error:NULL], @"passes with multiple passing validators");
+    XCTAssertEqual(validationCount, 3, @"Mutual Exclusion validator does not stop after second success");
+
+    validationCount = 0;
+    validator = [TWTCompoundValidator notValidatorWithSubvalidator:passingValidator];
+    XCTAssertFalse([validator validateValue:[self randomObject] error:NULL], @"passes with passing validator");
+    XCTAssertEqual(validationCount, 1, @"Not validator validates more than once");
+
+    [TWTValidator setFailFastModeEnabled:NO];
+    XCTAssertFalse([TWTValidator isFailFastModeEnabled], @"fail-fast mode is not disabled");
+
+    validationCount = 0;
+    validator = [TWTCompoundValidator andValidatorWithSubvalidators:subvalidators];
+    XCTAssertFalse([validator validateValue:[self randomObject] error:NULL], @"passes with failing validator");
+    XCTAssertEqual(validationCount, subvalidators.count, @"short-circuits when fail-fast mode is disabled");
+}
+
 @end
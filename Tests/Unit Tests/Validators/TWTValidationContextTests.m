@@ -0,0 +1,257 @@
+//
+//  TWTValidationContextTests.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "TWTRandomizedTestCase.h"
+
+
+@interface TWTValidationContextTests : TWTRandomizedTestCase
+
+- (void)testInit;
+- (void)testCopy;
+- (void)testValidateValueContextError;
+- (void)testFailFastMode;
+- (void)testDeadline;
+- (void)testPaths;
+- (void)testErrorBudget;
+
+@end
+
+
+@implementation TWTValidationContextTests
+
+- (void)tearDown
+{
+    [TWTValidator setFailFastModeEnabled:NO];
+    [super tearDown];
+}
+
+
+- (void)testInit
+{
+    BOOL failsFast = UMKRandomBoolean();
+    [TWTValidator setFailFastModeEnabled:failsFast];
+
+    TWTValidationContext *context = [[TWTValidationContext alloc] init];
+    XCTAssertNotNil(context, @"returns nil");
+    XCTAssertNil(context.executor, @"executor is non-nil");
+    XCTAssertEqual(context.isFailFastModeEnabled, failsFast, @"fail-fast mode is not initialized from global setting");
+    XCTAssertNil(context.deadline, @"deadline is non-nil");
+    XCTAssertFalse([context isPastDeadline], @"past deadline without deadline");
+
+    XCTAssertEqual(TWTValidationContextExecutor(context), [TWTValidationExecutor serialExecutor], @"does not fall back on serial executor");
+    XCTAssertEqual(TWTValidationContextExecutor(nil), [TWTValidationExecutor serialExecutor], @"does not fall back on serial executor");
+    XCTAssertEqual(TWTValidationContextIsFailFastModeEnabled(nil), failsFast, @"does not fall back on global fail-fast mode");
+
+    context.failFastModeEnabled = !failsFast;
+    XCTAssertEqual(TWTValidationContextIsFailFastModeEnabled(context), !failsFast, @"does not use context’s fail-fast mode");
+}
+
+
+- (void)testCopy
+{
+    TWTValidationContext *context = [[TWTValidationContext alloc] init];
+    context.executor = [[TWTValidationExecutor alloc] init];
+    context.failFastModeEnabled = UMKRandomBoolean();
+    context.deadline = [NSDate dateWithTimeIntervalSinceNow:60 + random() % 60];
+
+    TWTValidationContext *copy = [context copy];
+    XCTAssertNotEqual(copy, context, @"returns self");
+    XCTAssertEqual(copy.executor, context.executor, @"executor is not copied");
+    XCTAssertEqual(copy.isFailFastModeEnabled, context.isFailFastModeEnabled, @"fail-fast mode is not copied");
+    XCTAssertEqualObjects(copy.deadline, context.deadline, @"deadline is not copied");
+}
+
+
+- (void)testValidateValueContextError
+{
+    TWTValidator *validator = [[TWTValidator alloc] init];
+    TWTValidationContext *context = [[TWTValidationContext alloc] init];
+
+    for (id value in @[ [self randomObject], [NSNull null] ]) {
+        NSError *expectedError = nil;
+        BOOL expectedValidated = [validator validateValue:value error:&expectedError];
+
+        NSError *error = nil;
+        XCTAssertEqual([validator validateValue:value context:context error:&error], expectedValidated, @"result differs from -validateValue:error:");
+        XCTAssertEqualObjects(error, expectedError, @"error differs from -validateValue:error:");
+        XCTAssertEqual([validator validateValue:value context:nil error:NULL], expectedValidated, @"result differs with nil context");
+    }
+}
+
+
+- (void)testFailFastMode
+{
+    __block NSUInteger validationCount = 0;
+    TWTValidator *failingValidator = [[TWTBlockValidator alloc] initWithBlock:^BOOL(id value, NSError *__autoreleasing *outError) {
+        ++validationCount;
+        return NO;
+    }];
+
+    NSArray *subvalidators = @[ failingValidator, failingValidator, failingValidator ];
+    TWTCompoundValidator *andValidator = [TWTCompoundValidator andValidatorWithSubvalidators:subvalidators];
+    TWTCollectionValidator *collectionValidator = [[TWTCollectionValidator alloc] initWithCountValidator:nil elementValidators:@[ andValidator ]];
+
+    [TWTValidator setFailFastModeEnabled:NO];
+    TWTValidationContext *context = [[TWTValidationContext alloc] init];
+    context.failFastModeEnabled = YES;
+
+    XCTAssertFalse([collectionValidator validateValue:@[ @1, @2, @3 ] context:context error:NULL], @"passes with failing validator");
+    XCTAssertEqual(validationCount, 1, @"context’s fail-fast mode is not passed to subvalidators");
+
+    validationCount = 0;
+    XCTAssertFalse([collectionValidator validateValue:@[ @1, @2, @3 ] error:NULL], @"passes with failing validator");
+    XCTAssertEqual(validationCount, 9, @"global fail-fast mode is not used without context");
+}
+
+
+- (void)testDeadline
+{
+    TWTValidationContext *context = [[TWTValidationContext alloc] init];
+    context.deadline = [NSDate dateWithTimeIntervalSinceNow:-1];
+    XCTAssertTrue([context isPastDeadline], @"not past deadline in the past");
+
+    TWTCompoundValidator *andValidator = [TWTCompoundValidator andValidatorWithSubvalidators:@[ [self passingValidator] ]];
+    NSError *error = nil;
+    XCTAssertFalse([andValidator validateValue:[self randomObject] context:context error:&error], @"passes after deadline");
+    XCTAssertEqual(error.twt_underlyingErrors.count, 1, @"incorrect underlying errors");
+    XCTAssertEqual([error.twt_underlyingErrors.firstObject code], TWTValidationErrorCodeDeadlineExceeded, @"incorrect underlying error code");
+    XCTAssertTrue([andValidator validateValue:[self randomObject] error:NULL], @"fails without deadline");
+
+    TWTCollectionValidator *collectionValidator = [[TWTCollectionValidator alloc] initWithCountValidator:nil elementValidators:@[ [self passingValidator] ]];
+    error = nil;
+    XCTAssertFalse([collectionValidator validateValue:@[ @1 ] context:context error:&error], @"passes after deadline");
+    XCTAssertEqual([error.userInfo[TWTValidationElementValidationErrorsKey] count], 1, @"incorrect element errors");
+    XCTAssertTrue([collectionValidator validateValue:@[ ] context:context error:NULL], @"fails without work to do");
+
+    context.deadline = [NSDate distantFuture];
+    XCTAssertFalse([context isPastDeadline], @"past deadline in the future");
+    XCTAssertTrue([andValidator validateValue:[self randomObject] context:context error:NULL], @"fails before deadline");
+
+    context.deadline = nil;
+    XCTAssertFalse([context isPastDeadline], @"past deadline after deadline is removed");
+}
+
+
+- (void)testPaths
+{
+    TWTValidationContext *context = [[TWTValidationContext alloc] init];
+    XCTAssertEqual(context.currentPathFrame, NULL, @"initial frame is non-NULL");
+    XCTAssertEqualObjects([context currentInstancePath], @"", @"initial instance path is incorrect");
+    XCTAssertEqualObjects([context currentSchemaPath], @"", @"initial schema path is incorrect");
+
+    TWTValidationPathFrame propertyFrame = TWTValidationPathFrameMakeWithKey(@"a/b~c", @"properties", @"a/b~c");
+    [context pushPathFrame:&propertyFrame];
+    XCTAssertEqual(context.currentPathFrame, &propertyFrame, @"frame is not pushed");
+
+    TWTValidationPathFrame itemFrame = TWTValidationPathFrameMakeWithIndex(3, @"items", NSNotFound);
+    [context pushPathFrame:&itemFrame];
+
+    TWTValidationPathFrame dependencyFrame = TWTValidationPathFrameMakeWithKey(nil, @"dependencies", @"d");
+    [context pushPathFrame:&dependencyFrame];
+
+    XCTAssertEqualObjects([context currentInstancePath], @"/a~1b~0c/3", @"instance path is incorrect");
+    XCTAssertEqualObjects([context currentSchemaPath], @"/properties/a~1b~0c/items/dependencies/d", @"schema path is incorrect");
+    XCTAssertEqual([[context copy] currentPathFrame], &dependencyFrame, @"copy does not have the same path");
+
+    NSError *underlyingError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueNull
+                                                   failingValidator:nil
+                                                              value:nil
+                                               localizedDescription:UMKRandomUnicodeString()];
+    NSError *error = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeCompoundValidatorError
+                                         failingValidator:nil
+                                                    value:nil
+                                     localizedDescription:UMKRandomUnicodeString()
+                                         underlyingErrors:@[ underlyingError ]];
+
+    NSError *errorWithPaths = [context errorByAddingCurrentPathsToError:error];
+    XCTAssertEqualObjects(errorWithPaths.twt_instancePath, @"/a~1b~0c/3", @"instance path is incorrect");
+    XCTAssertEqualObjects(errorWithPaths.userInfo[TWTValidationSchemaPathKey], @"/properties/a~1b~0c/items/dependencies/d", @"schema path is incorrect");
+    XCTAssertEqualObjects(errorWithPaths.localizedDescription, error.localizedDescription, @"description is not preserved");
+    XCTAssertEqualObjects([errorWithPaths.twt_underlyingErrors.firstObject twt_instancePath], @"/a~1b~0c/3", @"underlying error has no path");
+
+    [context popPathFrame];
+    [context popPathFrame];
+    XCTAssertEqual([context errorByAddingCurrentPathsToError:errorWithPaths], errorWithPaths, @"paths are replaced");
+    XCTAssertNil([context errorByAddingCurrentPathsToError:nil], @"returns non-nil error for nil");
+
+    [context popPathFrame];
+    XCTAssertEqual(context.currentPathFrame, NULL, @"frames are not popped");
+}
+
+
+- (void)testErrorBudget
+{
+    TWTValidator *failingValidator = [[TWTBlockValidator alloc] initWithBlock:^BOOL(id value, NSError *__autoreleasing *outError) {
+        if (outError) {
+            *outError = [NSError twt_validationErrorWithCode:TWTValidationErrorCodeValueNull
+                                            failingValidator:nil
+                                                       value:value
+                                        localizedDescription:UMKRandomUnicodeString()];
+        }
+
+        return NO;
+    }];
+
+    TWTCollectionValidator *collectionValidator = [[TWTCollectionValidator alloc] initWithCountValidator:nil elementValidators:@[ failingValidator ]];
+    NSArray *elements = UMKGeneratedArrayWithElementCount(20 + random() % 20, ^id(NSUInteger index) {
+        return @(index);
+    });
+
+    [TWTValidator setFailFastModeEnabled:NO];
+    TWTValidationContext *context = [[TWTValidationContext alloc] init];
+    XCTAssertEqual(context.maximumErrorCount, NSUIntegerMax, @"maximum error count is not initialized to NSUIntegerMax");
+
+    NSError *error = nil;
+    XCTAssertFalse([collectionValidator validateValue:elements context:context error:&error], @"passes with failing validator");
+    XCTAssertEqual([error.userInfo[TWTValidationElementValidationErrorsKey] count], elements.count, @"incorrect element errors without limit");
+    XCTAssertFalse(context.isErrorCollectionTruncated, @"truncated without limit");
+    XCTAssertFalse(error.twt_isTruncated, @"error is marked truncated without limit");
+
+    NSUInteger maximumErrorCount = 1 + random() % 5;
+    context.maximumErrorCount = maximumErrorCount;
+    [context resetErrorCount];
+    XCTAssertEqual(context.errorCount, 0, @"error count is not reset");
+
+    error = nil;
+    XCTAssertFalse([collectionValidator validateValue:elements context:context error:&error], @"passes with failing validator");
+    XCTAssertLessThan([error.userInfo[TWTValidationElementValidationErrorsKey] count], elements.count, @"element errors are not limited");
+    XCTAssertGreaterThanOrEqual(context.errorCount, maximumErrorCount, @"error count does not reach maximum");
+    XCTAssertTrue(context.isErrorCollectionTruncated, @"not truncated after reaching limit");
+    XCTAssertTrue(error.twt_isTruncated, @"error is not marked truncated");
+    XCTAssertEqualObjects(error.userInfo[TWTValidationErrorsTruncatedKey], @YES, @"truncated key is not set");
+
+    TWTValidationContext *copy = [context copy];
+    XCTAssertEqual(copy.maximumErrorCount, maximumErrorCount, @"maximum error count is not copied");
+    XCTAssertEqual(copy.errorCount, context.errorCount, @"copy does not share error count");
+
+    [context resetErrorCount];
+    XCTAssertEqual(context.errorCount, 0, @"error count is not reset");
+    XCTAssertFalse(context.isErrorCollectionTruncated, @"truncation is not reset");
+    XCTAssertFalse([collectionValidator validateValue:elements context:context error:NULL], @"passes with failing validator");
+    XCTAssertEqual(context.errorCount, 0, @"errors are counted without error pointer");
+}
+
+@end
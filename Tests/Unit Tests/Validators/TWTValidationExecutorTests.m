@@ -0,0 +1,298 @@
+//
+//  TWTValidationExecutorTests.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "TWTRandomizedTestCase.h"
+
+#import <stdatomic.h>
+
+
+@interface TWTValidationExecutorTests : TWTRandomizedTestCase
+
+@property (nonatomic, strong) NSMutableArray *workStealingExecutors;
+
+- (void)testSerialExecutor;
+- (void)testDeallocation;
+- (void)testExecuteCountBlock;
+- (void)testResultsOfExecutingCountBlock;
+- (void)testNestedExecution;
+- (void)testConcurrentValidation;
+- (void)testContextResultsOfExecutingCountBlock;
+- (void)testConcurrentValidationAfterDeadline;
+
+@end
+
+
+@implementation TWTValidationExecutorTests
+
+- (void)setUp
+{
+    [super setUp];
+    self.workStealingExecutors = [[NSMutableArray alloc] init];
+}
+
+
+- (void)tearDown
+{
+    [self.workStealingExecutors makeObjectsPerformSelector:@selector(invalidate)];
+    [super tearDown];
+}
+
+
+- (TWTWorkStealingValidationExecutor *)workStealingExecutor
+{
+    TWTWorkStealingValidationExecutor *executor = [[TWTWorkStealingValidationExecutor alloc] initWithWorkerCount:1 + random() % 4];
+    executor.concurrencyThreshold = 2;
+    [self.workStealingExecutors addObject:executor];
+
+    return executor;
+}
+
+
+- (void)testSerialExecutor
+{
+    TWTValidationExecutor *serialExecutor = [TWTValidationExecutor serialExecutor];
+    XCTAssertNotNil(serialExecutor, @"returns nil");
+    XCTAssertEqual([TWTValidationExecutor serialExecutor], serialExecutor, @"returns different serial executors");
+    XCTAssertFalse([serialExecutor shouldExecuteConcurrentlyWithCount:random() % 10000], @"serial executor executes concurrently");
+
+    TWTWorkStealingValidationExecutor *defaultWorkerCountExecutor = [[TWTWorkStealingValidationExecutor alloc] init];
+    XCTAssertEqual(defaultWorkerCountExecutor.workerCount, MAX([[NSProcessInfo processInfo] activeProcessorCount], 1), @"worker count not set correctly");
+    XCTAssertEqual(defaultWorkerCountExecutor.concurrencyThreshold, 32, @"concurrency threshold not set correctly");
+    XCTAssertFalse([defaultWorkerCountExecutor shouldExecuteConcurrentlyWithCount:31], @"executes below concurrency threshold");
+    XCTAssertTrue([defaultWorkerCountExecutor shouldExecuteConcurrentlyWithCount:32], @"does not execute at concurrency threshold");
+
+    [defaultWorkerCountExecutor invalidate];
+    XCTAssertFalse([defaultWorkerCountExecutor shouldExecuteConcurrentlyWithCount:random() % 10000], @"executes concurrently after invalidation");
+}
+
+
+- (void)testDeallocation
+{
+    // Worker threads must not keep their executor alive once it has been used
+    __weak TWTWorkStealingValidationExecutor *weakExecutor = nil;
+    @autoreleasepool {
+        TWTWorkStealingValidationExecutor *executor = [[TWTWorkStealingValidationExecutor alloc] initWithWorkerCount:1 + random() % 4];
+        executor.concurrencyThreshold = 2;
+        weakExecutor = executor;
+
+        __block atomic_size_t executionCount = ATOMIC_VAR_INIT(0);
+        [executor executeCount:100 block:^(NSUInteger index) {
+            atomic_fetch_add(&executionCount, 1);
+        }];
+
+        XCTAssertEqual(atomic_load(&executionCount), (size_t)100, @"incorrect number of executions");
+    }
+
+    XCTAssertNil(weakExecutor, @"executor is not deallocated");
+}
+
+
+- (void)testExecuteCountBlock
+{
+    for (TWTValidationExecutor *executor in @[ [[TWTValidationExecutor alloc] init], [self workStealingExecutor] ]) {
+        NSUInteger count = 100 + random() % 1000;
+        NSUInteger *executionCounts = calloc(count, sizeof(NSUInteger));
+
+        [executor executeCount:count block:^(NSUInteger index) {
+            ++executionCounts[index];
+        }];
+
+        for (NSUInteger i = 0; i < count; ++i) {
+            XCTAssertEqual(executionCounts[i], 1, @"index %lu not executed exactly once", (unsigned long)i);
+        }
+
+        free(executionCounts);
+    }
+}
+
+
+- (void)testResultsOfExecutingCountBlock
+{
+    for (TWTValidationExecutor *executor in @[ [[TWTValidationExecutor alloc] init], [self workStealingExecutor] ]) {
+        NSArray *expectedResults = UMKGeneratedArrayWithElementCount(100 + random() % 1000, ^id(NSUInteger index) {
+            return UMKRandomBoolean() ? [NSNull null] : @(index);
+        });
+
+        NSArray *results = [executor resultsOfExecutingCount:expectedResults.count block:^id(NSUInteger index) {
+            id result = expectedResults[index];
+            return result != [NSNull null] ? result : nil;
+        }];
+
+        XCTAssertEqualObjects(results, expectedResults, @"results are incorrect");
+    }
+}
+
+
+- (void)testNestedExecution
+{
+    TWTWorkStealingValidationExecutor *executor = [self workStealingExecutor];
+    NSUInteger outerCount = 10 + random() % 50;
+    NSUInteger innerCount = 10 + random() % 50;
+
+    NSArray *results = [executor resultsOfExecutingCount:outerCount block:^id(NSUInteger outerIndex) {
+        return [executor resultsOfExecutingCount:innerCount block:^id(NSUInteger innerIndex) {
+            return @(outerIndex * innerCount + innerIndex);
+        }];
+    }];
+
+    XCTAssertEqual(results.count, outerCount, @"incorrect number of results");
+    for (NSUInteger outerIndex = 0; outerIndex < results.count; ++outerIndex) {
+        NSArray *innerResults = results[outerIndex];
+        XCTAssertEqual(innerResults.count, innerCount, @"incorrect number of inner results");
+        for (NSUInteger innerIndex = 0; innerIndex < innerResults.count; ++innerIndex) {
+            XCTAssertEqualObjects(innerResults[innerIndex], @(outerIndex * innerCount + innerIndex), @"inner result is incorrect");
+        }
+    }
+}
+
+
+- (void)testConcurrentValidation
+{
+    TWTNumberValidator *numberValidator = [[TWTNumberValidator alloc] initWithMinimum:@0 maximum:@100];
+    TWTCompoundValidator *compoundValidator = [TWTCompoundValidator andValidatorWithSubvalidators:UMKGeneratedArrayWithElementCount(50, ^id(NSUInteger index) {
+        return [[TWTNumberValidator alloc] initWithMinimum:@(index) maximum:nil];
+    })];
+
+    TWTCollectionValidator *collectionValidator = [[TWTCollectionValidator alloc] initWithCountValidator:nil elementValidators:@[ numberValidator ]];
+    TWTKeyedCollectionValidator *keyedCollectionValidator = [[TWTKeyedCollectionValidator alloc] initWithCountValidator:nil
+                                                                                                          keyValidators:@[ [TWTStringValidator stringValidatorWithMinimumLength:2 maximumLength:NSUIntegerMax] ]
+                                                                                                        valueValidators:@[ numberValidator ]
+                                                                                                 keyValuePairValidators:nil];
+
+    NSArray *numbers = UMKGeneratedArrayWithElementCount(500 + random() % 500, ^id(NSUInteger index) {
+        return @((NSInteger)(random() % 150) - 25);
+    });
+
+    NSMutableDictionary *dictionary = [[NSMutableDictionary alloc] init];
+    for (NSNumber *number in numbers) {
+        dictionary[[number stringValue]] = number;
+    }
+
+    NSArray *validatorsAndValues = @[ @[ compoundValidator, @(random() % 75) ],
+                                      @[ collectionValidator, numbers ],
+                                      @[ keyedCollectionValidator, dictionary ] ];
+
+    for (NSArray *validatorAndValue in validatorsAndValues) {
+        TWTValidator *validator = validatorAndValue[0];
+        id value = validatorAndValue[1];
+
+        TWTValidationContext *context = [[TWTValidationContext alloc] init];
+        context.failFastModeEnabled = NO;
+
+        NSError *serialError = nil;
+        BOOL serialValidated = [validator validateValue:value context:context error:&serialError];
+
+        context.executor = [self workStealingExecutor];
+
+        NSError *concurrentError = nil;
+        BOOL concurrentValidated = [validator validateValue:value context:context error:&concurrentError];
+
+        XCTAssertEqual(concurrentValidated, serialValidated, @"concurrent result differs from serial result");
+        XCTAssertEqualObjects(concurrentError, serialError, @"concurrent error differs from serial error");
+        XCTAssertEqual([validator validateValue:value context:context error:NULL], serialValidated, @"result differs when not collecting errors");
+    }
+}
+
+
+
+- (void)testContextResultsOfExecutingCountBlock
+{
+    TWTValidationContext *context = [[TWTValidationContext alloc] init];
+    context.executor = [self workStealingExecutor];
+
+    NSUInteger count = 100 + random() % 1000;
+    NSMutableSet *chunkContexts = [[NSMutableSet alloc] init];
+    BOOL deadlineExceeded = YES;
+    NSArray *results = [context resultsOfExecutingCount:count deadlineExceeded:&deadlineExceeded block:^id(TWTValidationContext *chunkContext, NSUInteger index) {
+        @synchronized(chunkContexts) {
+            [chunkContexts addObject:[NSValue valueWithNonretainedObject:chunkContext]];
+        }
+
+        return @(index);
+    }];
+
+    XCTAssertFalse(deadlineExceeded, @"deadline exceeded without deadline");
+    XCTAssertEqualObjects(results, UMKGeneratedArrayWithElementCount(count, ^id(NSUInteger index) { return @(index); }), @"results are incorrect");
+    XCTAssertFalse([chunkContexts containsObject:[NSValue valueWithNonretainedObject:context]], @"block is passed receiver");
+    XCTAssertLessThanOrEqual(chunkContexts.count, (NSUInteger)64, @"context is copied for each index");
+
+    context.deadline = [NSDate dateWithTimeIntervalSinceNow:-1];
+    results = [context resultsOfExecutingCount:count deadlineExceeded:&deadlineExceeded block:^id(TWTValidationContext *chunkContext, NSUInteger index) {
+        return @(index);
+    }];
+
+    XCTAssertTrue(deadlineExceeded, @"deadline not exceeded after deadline");
+    XCTAssertEqual(results.count, count, @"incorrect number of results");
+    XCTAssertEqual([results indexOfObjectPassingTest:^BOOL(id result, NSUInteger index, BOOL *stop) { return result != [NSNull null]; }],
+                   (NSUInteger)NSNotFound, @"executes block after deadline");
+}
+
+
+- (void)testConcurrentValidationAfterDeadline
+{
+    TWTCompoundValidator *compoundValidator = [TWTCompoundValidator andValidatorWithSubvalidators:UMKGeneratedArrayWithElementCount(50, ^id(NSUInteger index) {
+        return [[TWTValidator alloc] init];
+    })];
+
+    TWTCollectionValidator *collectionValidator = [[TWTCollectionValidator alloc] initWithCountValidator:nil elementValidators:@[ [[TWTValidator alloc] init] ]];
+    TWTKeyedCollectionValidator *keyedCollectionValidator = [[TWTKeyedCollectionValidator alloc] initWithCountValidator:nil
+                                                                                                          keyValidators:nil
+                                                                                                        valueValidators:@[ [[TWTValidator alloc] init] ]
+                                                                                                 keyValuePairValidators:nil];
+
+    NSArray *numbers = UMKGeneratedArrayWithElementCount(500 + random() % 500, ^id(NSUInteger index) {
+        return @(index);
+    });
+
+    NSMutableDictionary *dictionary = [[NSMutableDictionary alloc] init];
+    for (NSNumber *number in numbers) {
+        dictionary[[number stringValue]] = number;
+    }
+
+    NSArray *validatorsAndValues = @[ @[ compoundValidator, @(random()) ],
+                                      @[ collectionValidator, numbers ],
+                                      @[ keyedCollectionValidator, dictionary ] ];
+
+    TWTValidationContext *context = [[TWTValidationContext alloc] init];
+    context.failFastModeEnabled = NO;
+    context.executor = [self workStealingExecutor];
+
+    for (NSArray *validatorAndValue in validatorsAndValues) {
+        TWTValidator *validator = validatorAndValue[0];
+        id value = validatorAndValue[1];
+
+        context.deadline = nil;
+        XCTAssertTrue([validator validateValue:value context:context error:NULL], @"fails before deadline");
+
+        context.deadline = [NSDate dateWithTimeIntervalSinceNow:-1];
+        NSError *error = nil;
+        XCTAssertFalse([validator validateValue:value context:context error:&error], @"passes after deadline");
+        XCTAssertNotNil(error, @"returns nil error");
+        XCTAssertFalse([validator validateValue:value context:context error:NULL], @"passes after deadline");
+    }
+}
+
+@end
@@ -35,6 +35,7 @@
 - (void)testCopy;
 - (void)testHashAndIsEqual;
 - (void)testValidateValueError;
+- (void)testValidateValuesResults;
 
 @end
 
@@ -90,4 +91,21 @@
     XCTAssertEqualObjects(error.twt_validatedValue, [NSNull null], @"incorrect validated value");
 }
 
+
+- (void)testValidateValuesResults
+{
+    NSArray *values = @[ UMKRandomUnsignedNumber(), [NSNull null], UMKRandomUnicodeStringWithLength(10), [NSNull null] ];
+    NSMutableIndexSet *expectedIndexes = [[NSMutableIndexSet alloc] init];
+    [expectedIndexes addIndex:1];
+    [expectedIndexes addIndex:3];
+
+    NSIndexSet *invalidIndexes = nil;
+    XCTAssertFalse([self.validator validateValues:values results:&invalidIndexes], @"passes with null values");
+    XCTAssertEqualObjects(invalidIndexes, expectedIndexes, @"incorrect invalid indexes");
+
+    XCTAssertTrue([self.validator validateValues:@[ ] results:&invalidIndexes], @"fails with no values");
+    XCTAssertEqual(invalidIndexes.count, 0, @"returns invalid indexes for no values");
+    XCTAssertTrue([self.validator validateValues:@[ UMKRandomUnsignedNumber() ] results:NULL], @"fails with valid values");
+}
+
 @end
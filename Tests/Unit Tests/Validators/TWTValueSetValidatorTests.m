@@ -33,6 +33,7 @@
 - (void)testCopy;
 - (void)testHashAndIsEqual;
 - (void)testValidateValueError;
+- (void)testValidateValuesResults;
 
 @end
 
@@ -139,4 +140,23 @@
     XCTAssertTrue([validator validateValue:nil error:NULL], @"fails with nil value");
 }
 
+
+- (void)testValidateValuesResults
+{
+    NSSet *validValues = [NSSet setWithArray:UMKGeneratedArrayWithElementCount(5 + random() % 5, ^id(NSUInteger index) {
+        return [self randomNonNilObject];
+    })];
+
+    TWTValueSetValidator *validator = [[TWTValueSetValidator alloc] initWithValidValues:validValues];
+    NSArray *values = UMKGeneratedArrayWithElementCount(50, ^id(NSUInteger index) {
+        return UMKRandomBoolean() ? [validValues anyObject] : [self randomNonNilObject];
+    });
+
+    NSIndexSet *expectedIndexes = [self indexesOfValues:values invalidForValidator:validator];
+
+    NSIndexSet *invalidIndexes = nil;
+    XCTAssertEqual([validator validateValues:values results:&invalidIndexes], expectedIndexes.count == 0, @"incorrect result");
+    XCTAssertEqualObjects(invalidIndexes, expectedIndexes, @"incorrect invalid indexes");
+}
+
 @end
@@ -38,6 +38,10 @@
 - (void)testValidateValueErrorNoMaximum;
 - (void)testValidateValueErrorMaximum;
 - (void)testValidateValueErrorRequiresIntegralValue;
+- (void)testValidateValuesResults;
+- (void)testValidateIntegerError;
+- (void)testValidateDoubleError;
+- (void)testValidatorValidateCount;
 
 @end
 
@@ -305,4 +309,143 @@
     XCTAssertEqualObjects(error.twt_validatedValue, value, @"incorrect validated value");
 }
 
+
+- (void)testValidateValuesResults
+{
+    NSArray *values = UMKGeneratedArrayWithElementCount(100, ^id(NSUInteger index) {
+        switch (random() % 6) {
+            case 0:
+                return [self randomFloatingPointNumber];
+            case 1:
+                return @(UMKRandomUnsignedNumber().longLongValue * (UMKRandomBoolean() ? 1 : -1));
+            case 2:
+                return @((1ULL << 60) + random());
+            case 3:
+                return [NSDecimalNumber decimalNumberWithMantissa:random() exponent:-(short)(random() % 4) isNegative:UMKRandomBoolean()];
+            case 4:
+                return [NSNull null];
+            default:
+                return UMKRandomUnicodeStringWithLength(5);
+        }
+    });
+
+    NSArray *bounds = @[ [self randomFloatingPointNumber], @((1ULL << 60) + 1), @(random()), @(-random()) ];
+    for (NSUInteger i = 0; i < 16; ++i) {
+        NSNumber *minimum = UMKRandomBoolean() ? bounds[random() % bounds.count] : nil;
+        NSNumber *maximum = UMKRandomBoolean() ? bounds[random() % bounds.count] : nil;
+        if (minimum && maximum && [minimum compare:maximum] == NSOrderedDescending) {
+            NSNumber *temporary = minimum;
+            minimum = maximum;
+            maximum = temporary;
+        }
+
+        TWTNumberValidator *validator = [[TWTNumberValidator alloc] initWithMinimum:minimum maximum:maximum];
+        validator.minimumExclusive = UMKRandomBoolean();
+        validator.maximumExclusive = UMKRandomBoolean();
+        validator.requiresIntegralValue = UMKRandomBoolean();
+        validator.allowsNull = UMKRandomBoolean();
+
+        NSIndexSet *expectedIndexes = [self indexesOfValues:values invalidForValidator:validator];
+        NSIndexSet *invalidIndexes = nil;
+        XCTAssertEqual([validator validateValues:values results:&invalidIndexes], expectedIndexes.count == 0, @"incorrect result");
+        XCTAssertEqualObjects(invalidIndexes, expectedIndexes, @"incorrect invalid indexes for %@", validator);
+    }
+}
+
+
+- (void)testValidateIntegerError
+{
+    long long minimum = -(long long)random();
+    long long maximum = random();
+    TWTNumberValidator *validator = [[TWTNumberValidator alloc] initWithMinimum:@(minimum) maximum:@(maximum)];
+    validator.requiresIntegralValue = YES;
+
+    XCTAssertTrue([validator validateInteger:minimum error:NULL], @"fails with minimum integer");
+    XCTAssertTrue([validator validateInteger:maximum error:NULL], @"fails with maximum integer");
+
+    NSError *error = nil;
+    XCTAssertFalse([validator validateInteger:minimum - 1 error:&error], @"passes with smaller integer");
+    XCTAssertNotNil(error, @"returns nil error");
+    XCTAssertEqual(error.code, TWTValidationErrorCodeValueLessThanMinimum, @"incorrect error code");
+    XCTAssertEqualObjects(error.twt_failingValidator, validator, @"incorrect failing validator");
+    XCTAssertEqualObjects(error.twt_validatedValue, @(minimum - 1), @"incorrect validated value");
+
+    error = nil;
+    XCTAssertFalse([validator validateInteger:maximum + 1 error:&error], @"passes with larger integer");
+    XCTAssertEqual(error.code, TWTValidationErrorCodeValueGreaterThanMaximum, @"incorrect error code");
+    XCTAssertEqualObjects(error.twt_validatedValue, @(maximum + 1), @"incorrect validated value");
+
+    validator.minimumExclusive = YES;
+    validator.maximumExclusive = YES;
+    XCTAssertFalse([validator validateInteger:minimum error:NULL], @"passes with minimum integer");
+    XCTAssertFalse([validator validateInteger:maximum error:NULL], @"passes with maximum integer");
+
+    // Integers that can’t be represented exactly by a double are compared exactly
+    long long largeInteger = (1LL << 60) + 1;
+    validator = [[TWTNumberValidator alloc] initWithMinimum:@(largeInteger) maximum:nil];
+    XCTAssertTrue([validator validateInteger:largeInteger error:NULL], @"fails with minimum integer");
+    XCTAssertFalse([validator validateInteger:largeInteger - 1 error:NULL], @"passes with smaller integer");
+    XCTAssertFalse([validator validateValue:@(largeInteger - 1) error:NULL], @"passes with smaller number");
+    XCTAssertFalse([validator validateValue:@((unsigned long long)largeInteger - 1) error:NULL], @"passes with smaller unsigned number");
+    XCTAssertTrue([validator validateValue:@(ULLONG_MAX) error:NULL], @"fails with larger unsigned number");
+
+    // Decimal bounds are compared using -compare:
+    validator = [[TWTNumberValidator alloc] initWithMinimum:[NSDecimalNumber decimalNumberWithString:@"0.1"] maximum:nil];
+    XCTAssertTrue([validator validateInteger:1 error:NULL], @"fails with larger integer");
+    XCTAssertFalse([validator validateInteger:0 error:NULL], @"passes with smaller integer");
+}
+
+
+- (void)testValidateDoubleError
+{
+    double minimum = [self randomFloatingPointNumber].doubleValue;
+    double maximum = minimum + random() + 1.0;
+    TWTNumberValidator *validator = [[TWTNumberValidator alloc] initWithMinimum:@(minimum) maximum:@(maximum)];
+
+    XCTAssertTrue([validator validateDouble:minimum error:NULL], @"fails with minimum double");
+    XCTAssertTrue([validator validateDouble:maximum error:NULL], @"fails with maximum double");
+    XCTAssertTrue([validator validateDouble:(minimum + maximum) / 2 error:NULL], @"fails with intermediate double");
+
+    NSError *error = nil;
+    XCTAssertFalse([validator validateDouble:minimum - 0.5 error:&error], @"passes with smaller double");
+    XCTAssertEqual(error.code, TWTValidationErrorCodeValueLessThanMinimum, @"incorrect error code");
+    XCTAssertEqualObjects(error.twt_validatedValue, @(minimum - 0.5), @"incorrect validated value");
+
+    error = nil;
+    XCTAssertFalse([validator validateDouble:maximum + 0.5 error:&error], @"passes with larger double");
+    XCTAssertEqual(error.code, TWTValidationErrorCodeValueGreaterThanMaximum, @"incorrect error code");
+
+    validator = [[TWTNumberValidator alloc] init];
+    validator.requiresIntegralValue = YES;
+    XCTAssertTrue([validator validateDouble:(double)random() error:NULL], @"fails with integral double");
+    XCTAssertTrue([validator validateDouble:1e100 error:NULL], @"fails with large integral double");
+
+    error = nil;
+    XCTAssertFalse([validator validateDouble:random() + 0.5 error:&error], @"passes with non-integral double");
+    XCTAssertEqual(error.code, TWTValidationErrorCodeValueIsNotIntegral, @"incorrect error code");
+
+    // Every integer is less than doubles that are too large to be represented by a long long
+    validator = [[TWTNumberValidator alloc] initWithMinimum:nil maximum:@(LLONG_MAX)];
+    XCTAssertFalse([validator validateDouble:9223372036854775808.0 error:NULL], @"passes with larger double");
+    XCTAssertTrue([validator validateInteger:LLONG_MAX error:NULL], @"fails with maximum integer");
+}
+
+
+- (void)testValidatorValidateCount
+{
+    NSUInteger count = random() % 100 + 1;
+    TWTNumberValidator *numberValidator = [[TWTNumberValidator alloc] initWithMinimum:@(count) maximum:nil];
+    XCTAssertTrue(TWTValidatorValidateCount(nil, count, NULL), @"fails with nil validator");
+    XCTAssertTrue(TWTValidatorValidateCount(numberValidator, count, NULL), @"fails with minimum count");
+
+    NSError *error = nil;
+    XCTAssertFalse(TWTValidatorValidateCount(numberValidator, count - 1, &error), @"passes with smaller count");
+    XCTAssertEqualObjects(error.twt_validatedValue, @(count - 1), @"incorrect validated value");
+
+    TWTValueValidator *valueValidator = [TWTValueValidator valueValidatorWithClass:[NSString class] allowsNil:NO allowsNull:NO];
+    error = nil;
+    XCTAssertFalse(TWTValidatorValidateCount(valueValidator, count, &error), @"passes with value validator");
+    XCTAssertEqualObjects(error.twt_validatedValue, @(count), @"incorrect validated value");
+}
+
 @end
@@ -0,0 +1,130 @@
+//
+//  TWTRegularExpressionMatcherTests.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "TWTRandomizedTestCase.h"
+
+#import "TWTRegularExpressionMatcher.h"
+
+
+@interface TWTRegularExpressionMatcherTests : TWTRandomizedTestCase
+
+- (void)testUnsupportedPatterns;
+- (void)testMatchesLikeRegularExpression;
+- (void)testUndecidedCharacters;
+- (void)testPathologicalPatterns;
+
+@end
+
+
+@implementation TWTRegularExpressionMatcherTests
+
+- (TWTRegularExpressionMatcher *)matcherWithPattern:(NSString *)pattern options:(NSRegularExpressionOptions)options
+{
+    NSRegularExpression *regularExpression = [[NSRegularExpression alloc] initWithPattern:pattern options:options error:NULL];
+    XCTAssertNotNil(regularExpression, @"invalid test pattern %@", pattern);
+    return [[TWTRegularExpressionMatcher alloc] initWithRegularExpression:regularExpression matchingOptions:0];
+}
+
+
+- (void)testUnsupportedPatterns
+{
+    NSArray *unsupportedPatterns = @[ @"(a)\\1", @"a(?=b)", @"a(?!b)", @"(?<=a)b", @"\\bword\\b", @"a*+", @"a++",
+                                      @"(?i)abc", @"[[:alpha:]]", @"[a-z&&[^aeiou]]", @"\\p{L}", @"\\Qa.b\\E", @"(?<name>a)" ];
+    for (NSString *pattern in unsupportedPatterns) {
+        XCTAssertNil([self matcherWithPattern:pattern options:0], @"supports %@", pattern);
+    }
+
+    XCTAssertNil([self matcherWithPattern:@"abc" options:NSRegularExpressionCaseInsensitive], @"supports case-insensitive matching");
+    XCTAssertNil([self matcherWithPattern:@"^abc$" options:NSRegularExpressionAnchorsMatchLines], @"supports anchors that match lines");
+
+    // Counted repetition that would compile into too many instructions
+    XCTAssertNil([self matcherWithPattern:@"(a{1000}){10}" options:0], @"supports oversized repetition");
+}
+
+
+- (void)testMatchesLikeRegularExpression
+{
+    NSArray *patterns = @[ @"", @"abc", @"^abc$", @"^[A-Z][a-z]+ [0-9]+$", @"a|b|c", @"^(ab|cd)*$", @"^a{2,4}$", @"^a{3}$",
+                           @"^a{2,}b?$", @"x*?y", @"^[^a-c]+$", @"\\d+", @"^\\w+@\\w+\\.com$", @"^\\s*$", @"[\\d_-]",
+                           @"^\\D\\W\\S$", @"^.$", @"^(?:[a-z0-9-]+\\.)+[a-z]{2,}$", @"a.c", @"\\u00e9", @"\\x41", @"^$",
+                           @"[.]", @"\\.", @"^(a|ab)(c|bcd)(d*)$", @"(^a|b$)", @"😀+", @"^[😀-😂]$" ];
+    NSArray *strings = @[ @"", @"abc", @"ABC", @"Abc 123", @"aa", @"aaa", @"aaaaa", @"abcd", @"cdab", @"xxy", @"def",
+                          @"a1", @"me@example.com", @" \t", @"\n", @"abc\n", @"abc\r\n", @"a\nc", @"é", @"A", @"a.b",
+                          @"_", @"-", @"x-y.io", @"abcd", @"😀😀", @"😁", @"a😀" ];
+
+    for (NSString *pattern in patterns) {
+        for (NSNumber *options in @[ @0, @(NSRegularExpressionDotMatchesLineSeparators) ]) {
+            NSRegularExpression *regularExpression = [[NSRegularExpression alloc] initWithPattern:pattern options:options.unsignedIntegerValue error:NULL];
+            for (NSNumber *matchingOptions in @[ @0, @(NSMatchingAnchored) ]) {
+                TWTRegularExpressionMatcher *matcher = [[TWTRegularExpressionMatcher alloc] initWithRegularExpression:regularExpression
+                                                                                                     matchingOptions:matchingOptions.unsignedIntegerValue];
+                XCTAssertNotNil(matcher, @"does not support %@", pattern);
+
+                for (NSString *string in strings) {
+                    BOOL matches = [regularExpression rangeOfFirstMatchInString:string
+                                                                        options:matchingOptions.unsignedIntegerValue
+                                                                          range:NSMakeRange(0, string.length)].location != NSNotFound;
+                    TWTRegularExpressionMatchResult expectedResult = matches ? TWTRegularExpressionMatchResultMatch : TWTRegularExpressionMatchResultNoMatch;
+                    XCTAssertEqual([matcher resultOfMatchingString:string], expectedResult, @"%@ matches %@ incorrectly", pattern, string);
+                }
+            }
+        }
+    }
+}
+
+
+- (void)testUndecidedCharacters
+{
+    // Letter numbers are word characters, but Foundation can’t tell them apart from other numbers
+    TWTRegularExpressionMatcher *matcher = [self matcherWithPattern:@"^\\w+$" options:0];
+    XCTAssertEqual([matcher resultOfMatchingString:@"abcⅫ"], TWTRegularExpressionMatchResultUndecided);
+    XCTAssertEqual([matcher resultOfMatchingString:@"abcé"], TWTRegularExpressionMatchResultMatch);
+    XCTAssertEqual([matcher resultOfMatchingString:@"abc—"], TWTRegularExpressionMatchResultNoMatch);
+
+    // The regular expression decides these strings through the validator
+    NSRegularExpression *regularExpression = [[NSRegularExpression alloc] initWithPattern:@"^\\w+$" options:0 error:NULL];
+    TWTRegularExpressionStringValidator *validator = [TWTStringValidator stringValidatorWithRegularExpression:regularExpression options:0];
+    NSString *string = @"abcⅫ";
+    BOOL matches = [regularExpression rangeOfFirstMatchInString:string options:0 range:NSMakeRange(0, string.length)].location != NSNotFound;
+    XCTAssertEqual([validator validateValue:string error:NULL], matches);
+}
+
+
+- (void)testPathologicalPatterns
+{
+    // These take exponential time with a backtracking matcher
+    NSString *string = [[@"" stringByPaddingToLength:10000 withString:@"a" startingAtIndex:0] stringByAppendingString:@"!"];
+    for (NSString *pattern in @[ @"^(a+)+$", @"^(a|aa)*$", @"^(a*)*b$", @"^(?:a?){30}a{30}$" ]) {
+        TWTRegularExpressionMatcher *matcher = [self matcherWithPattern:pattern options:0];
+        XCTAssertNotNil(matcher, @"does not support %@", pattern);
+        XCTAssertEqual([matcher resultOfMatchingString:string], TWTRegularExpressionMatchResultNoMatch, @"%@ matches", pattern);
+    }
+
+    TWTRegularExpressionMatcher *matcher = [self matcherWithPattern:@"^(?:a?){30}a{30}$" options:0];
+    XCTAssertEqual([matcher resultOfMatchingString:[@"" stringByPaddingToLength:30 withString:@"a" startingAtIndex:0]], TWTRegularExpressionMatchResultMatch);
+}
+
+@end
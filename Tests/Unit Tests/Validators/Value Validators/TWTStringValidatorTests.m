@@ -66,6 +66,13 @@
 - (void)testCopyCharacterSet;
 - (void)testHashAndIsEqualCharacterSet;
 - (void)testValidateValueErrorCharacterSet;
+- (void)testValidateValueCharacterSetStringStorage;
+
+- (void)testInitBoundedLengthCharacterSet;
+- (void)testCopyBoundedLengthCharacterSet;
+- (void)testValidateValueErrorBoundedLengthCharacterSet;
+
+- (void)testValidateValuesResults;
 
 @end
 
@@ -956,4 +963,151 @@
     XCTAssertEqualObjects(error.twt_validatedValue, stringValue, @"incorrect validated value");
 }
 
+
+- (void)testValidateValueCharacterSetStringStorage
+{
+    NSString *longString = [@"" stringByPaddingToLength:200 withString:@"abc123" startingAtIndex:0];
+    NSArray *baseStrings = @[ @"", @"a", @"abc", @"abc1", @"abcd123", @"abc-123", @"abcé", @"abc😀", longString,
+                              [longString stringByAppendingString:@"-"], [longString stringByAppendingString:@"é"] ];
+
+    // Constant, 8-bit, UTF-16, and mutable strings are stored differently, and each is checked differently
+    NSMutableArray *strings = [[NSMutableArray alloc] init];
+    for (NSString *string in baseStrings) {
+        [strings addObject:string];
+        [strings addObject:[[NSString alloc] initWithData:[string dataUsingEncoding:NSUTF8StringEncoding] encoding:NSUTF8StringEncoding]];
+        [strings addObject:[[NSString alloc] initWithData:[string dataUsingEncoding:NSUTF16LittleEndianStringEncoding] encoding:NSUTF16LittleEndianStringEncoding]];
+        [strings addObject:[string mutableCopy]];
+    }
+
+    NSArray *characterSets = @[ [NSCharacterSet characterSetWithCharactersInString:@"abcdefghijklmnopqrstuvwxyz0123456789"],
+                                [NSCharacterSet characterSetWithCharactersInString:@"abc123é"],
+                                [NSCharacterSet alphanumericCharacterSet],
+                                [[NSCharacterSet alloc] init] ];
+
+    for (NSCharacterSet *characterSet in characterSets) {
+        TWTCharacterSetStringValidator *validator = [TWTStringValidator stringValidatorWithCharacterSet:characterSet];
+        TWTCharacterSetStringValidator *copy = [validator copy];
+        NSCharacterSet *invertedCharacterSet = characterSet.invertedSet;
+
+        NSMutableIndexSet *expectedIndexes = [[NSMutableIndexSet alloc] init];
+        [strings enumerateObjectsUsingBlock:^(NSString *string, NSUInteger index, BOOL *stop) {
+            BOOL expectedValid = [string rangeOfCharacterFromSet:invertedCharacterSet].location == NSNotFound;
+            XCTAssertEqual([validator validateValue:string error:NULL], expectedValid, @"incorrectly validates %@", string);
+            XCTAssertEqual([copy validateValue:string error:NULL], expectedValid, @"copy incorrectly validates %@", string);
+            if (!expectedValid) {
+                [expectedIndexes addIndex:index];
+            }
+        }];
+
+        NSIndexSet *invalidIndexes = nil;
+        [validator validateValues:strings results:&invalidIndexes];
+        XCTAssertEqualObjects(invalidIndexes, expectedIndexes, @"incorrect invalid indexes");
+
+        // Validators derive everything they need when they are initialized, so they can be used on many threads at once
+        __block BOOL failed = NO;
+        dispatch_apply(strings.count, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t index) {
+            if ([validator validateValue:strings[index] error:NULL] == [expectedIndexes containsIndex:index]) {
+                failed = YES;
+            }
+        });
+
+        XCTAssertFalse(failed, @"incorrectly validates strings concurrently");
+    }
+}
+
+
+#pragma mark - Bounded Length Character Set
+
+- (void)testInitBoundedLengthCharacterSet
+{
+    NSCharacterSet *characterSet = [NSCharacterSet alphanumericCharacterSet];
+    NSUInteger minimumLength = random() % 10;
+    NSUInteger maximumLength = minimumLength + random() % 10;
+
+    TWTBoundedLengthCharacterSetStringValidator *validator = [TWTStringValidator stringValidatorWithCharacterSet:characterSet
+                                                                                                  minimumLength:minimumLength
+                                                                                                  maximumLength:maximumLength];
+    XCTAssertNotNil(validator, @"returns nil");
+    XCTAssertEqualObjects(validator.valueClass, [NSString class], @"value class is not NSString");
+    XCTAssertEqualObjects(validator.characterSet, characterSet, @"character set is not set correctly");
+    XCTAssertEqual(validator.minimumLength, minimumLength, @"minimum length is not set correctly");
+    XCTAssertEqual(validator.maximumLength, maximumLength, @"maximum length is not set correctly");
+
+    validator = [[TWTBoundedLengthCharacterSetStringValidator alloc] initWithCharacterSet:characterSet];
+    XCTAssertNotNil(validator, @"returns nil");
+    XCTAssertEqualObjects(validator.characterSet, characterSet, @"character set is not set correctly");
+    XCTAssertEqual(validator.minimumLength, (NSUInteger)0, @"minimum length is non-zero");
+    XCTAssertEqual(validator.maximumLength, NSUIntegerMax, @"maximum length is not NSUIntegerMax");
+}
+
+
+- (void)testCopyBoundedLengthCharacterSet
+{
+    NSCharacterSet *characterSet = [NSCharacterSet alphanumericCharacterSet];
+    TWTBoundedLengthCharacterSetStringValidator *validator = [TWTStringValidator stringValidatorWithCharacterSet:characterSet minimumLength:2 maximumLength:5];
+    validator.allowsNil = UMKRandomBoolean();
+
+    TWTBoundedLengthCharacterSetStringValidator *copy = [validator copy];
+    XCTAssertEqualObjects(validator, copy, @"copy is not equal to original");
+    XCTAssertEqual(validator.hash, copy.hash, @"hashes are not equal for equal objects");
+    XCTAssertEqual(copy.minimumLength, (NSUInteger)2, @"minimum length is not set correctly");
+    XCTAssertEqual(copy.maximumLength, (NSUInteger)5, @"maximum length is not set correctly");
+
+    XCTAssertNotEqualObjects(validator, [TWTStringValidator stringValidatorWithCharacterSet:characterSet minimumLength:2 maximumLength:6], @"unequal objects are equal");
+}
+
+
+- (void)testValidateValueErrorBoundedLengthCharacterSet
+{
+    NSCharacterSet *characterSet = [NSCharacterSet characterSetWithCharactersInString:@"0123456789abcdef"];
+    TWTBoundedLengthCharacterSetStringValidator *validator = [TWTStringValidator stringValidatorWithCharacterSet:characterSet minimumLength:4 maximumLength:4];
+
+    XCTAssertTrue([validator validateValue:@"0f9e" error:NULL], @"fails with valid string");
+
+    NSError *error = nil;
+    XCTAssertFalse([validator validateValue:@"0g9e" error:&error], @"passes with string containing characters not in character set");
+    XCTAssertEqual(error.code, TWTValidationErrorCodeValueDoesNotMatchFormat, @"incorrect error code");
+    XCTAssertEqualObjects(error.twt_failingValidator, validator, @"incorrect failing validator");
+
+    error = nil;
+    XCTAssertFalse([validator validateValue:@"0f9" error:&error], @"passes with string that is too short");
+    XCTAssertEqual(error.code, TWTValidationErrorCodeLengthLessThanMinimum, @"incorrect error code");
+
+    error = nil;
+    XCTAssertFalse([validator validateValue:@"0f9ea" error:&error], @"passes with string that is too long");
+    XCTAssertEqual(error.code, TWTValidationErrorCodeLengthGreaterThanMaximum, @"incorrect error code");
+    XCTAssertEqualObjects(error.twt_validatedValue, @"0f9ea", @"incorrect validated value");
+
+    NSIndexSet *invalidIndexes = nil;
+    XCTAssertFalse([validator validateValues:@[ @"0f9e", @"0g9e", @"0f9", @"abcd" ] results:&invalidIndexes], @"passes with invalid strings");
+    XCTAssertEqualObjects(invalidIndexes, ([NSIndexSet indexSetWithIndexesInRange:NSMakeRange(1, 2)]), @"incorrect invalid indexes");
+}
+
+
+#pragma mark - Batch Validation
+
+- (void)testValidateValuesResults
+{
+    NSArray *values = @[ @"abc", @"ABCdef", @"xyzabc", @"123", @"", @"a", [NSNull null], @42, @"éclair", @"defABC", @"a1b2c3" ];
+    NSArray *validators = @[ [TWTStringValidator stringValidatorWithMinimumLength:1 maximumLength:3],
+                             [TWTStringValidator stringValidatorWithComposedCharacterMinimumLength:2 maximumLength:6],
+                             [TWTStringValidator stringValidatorWithRegularExpression:[NSRegularExpression regularExpressionWithPattern:@"^[a-z]+$" options:0 error:NULL]
+                                                                              options:0],
+                             [TWTStringValidator stringValidatorWithPrefix:@"abc" caseSensitive:NO],
+                             [TWTStringValidator stringValidatorWithSuffix:@"abc" caseSensitive:YES],
+                             [TWTStringValidator stringValidatorWithSubstring:@"b" caseSensitive:NO],
+                             [TWTStringValidator stringValidatorWithPattern:@"*c?" caseSensitive:YES],
+                             [TWTStringValidator stringValidatorWithCharacterSet:[NSCharacterSet alphanumericCharacterSet]],
+                             [[TWTPrefixStringValidator alloc] init] ];
+
+    for (TWTStringValidator *validator in validators) {
+        validator.allowsNull = UMKRandomBoolean();
+
+        NSIndexSet *expectedIndexes = [self indexesOfValues:values invalidForValidator:validator];
+        NSIndexSet *invalidIndexes = nil;
+        XCTAssertEqual([validator validateValues:values results:&invalidIndexes], expectedIndexes.count == 0, @"incorrect result");
+        XCTAssertEqualObjects(invalidIndexes, expectedIndexes, @"incorrect invalid indexes for %@", validator);
+    }
+}
+
 @end
@@ -36,6 +36,7 @@
 - (void)testValidateValueErrorValueClass;
 - (void)testValidateValueErrorAllowsNil;
 - (void)testValidateValueErrorAllowsNull;
+- (void)testValidateValuesResults;
 
 @end
 
@@ -195,4 +196,21 @@
     XCTAssertTrue([validator validateValue:[NSNull null] error:NULL], @"fails when value is null");
 }
 
+
+- (void)testValidateValuesResults
+{
+    NSArray *values = UMKGeneratedArrayWithElementCount(50, ^id(NSUInteger index) {
+        return [self randomNonNilObject];
+    });
+
+    for (NSUInteger i = 0; i < 8; ++i) {
+        TWTValueValidator *validator = [TWTValueValidator valueValidatorWithClass:[self randomClass] allowsNil:UMKRandomBoolean() allowsNull:UMKRandomBoolean()];
+        NSIndexSet *expectedIndexes = [self indexesOfValues:values invalidForValidator:validator];
+
+        NSIndexSet *invalidIndexes = nil;
+        XCTAssertEqual([validator validateValues:values results:&invalidIndexes], expectedIndexes.count == 0, @"incorrect result");
+        XCTAssertEqualObjects(invalidIndexes, expectedIndexes, @"incorrect invalid indexes");
+    }
+}
+
 @end
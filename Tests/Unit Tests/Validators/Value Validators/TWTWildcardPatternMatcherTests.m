@@ -0,0 +1,159 @@
+//
+//  TWTWildcardPatternMatcherTests.m
+//  TWTValidation
+//
+//  Created by Prachi Gauriar on 10/17/26.
+//  Copyright (c) 2026 Ticketmaster Entertainment, Inc. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "TWTRandomizedTestCase.h"
+
+#import "TWTWildcardPatternMatcher.h"
+
+
+@interface TWTWildcardPatternMatcherTests : TWTRandomizedTestCase
+
+- (void)testUnsupportedPatterns;
+- (void)testMatchesLikePredicate;
+- (void)testUndecidedCharacters;
+- (void)testPathologicalPatterns;
+- (void)testMatcherPerformance;
+- (void)testPredicatePerformance;
+
+@end
+
+
+@implementation TWTWildcardPatternMatcherTests
+
+- (NSPredicate *)predicateWithPattern:(NSString *)pattern caseSensitive:(BOOL)caseSensitive
+{
+    NSString *predicateString = [NSString stringWithFormat:@"SELF LIKE%@ %%@", caseSensitive ? @"" : @"[c]"];
+    return [NSPredicate predicateWithFormat:predicateString, pattern];
+}
+
+
+- (NSArray *)benchmarkStrings
+{
+    NSMutableArray *strings = [[NSMutableArray alloc] initWithCapacity:1000];
+    for (NSUInteger i = 0; i < 1000; ++i) {
+        [strings addObject:[NSString stringWithFormat:@"user-%lu@%@.example.com", (unsigned long)i, UMKRandomAlphanumericStringWithLength(12)]];
+    }
+
+    return strings;
+}
+
+
+- (void)testUnsupportedPatterns
+{
+    XCTAssertNil([[TWTWildcardPatternMatcher alloc] initWithPattern:@"a\\*b" caseSensitive:YES], @"supports escapes");
+    XCTAssertNil([[TWTWildcardPatternMatcher alloc] initWithPattern:@"é*" caseSensitive:NO], @"supports case-insensitive non-ASCII characters");
+    XCTAssertNotNil([[TWTWildcardPatternMatcher alloc] initWithPattern:@"é*" caseSensitive:YES], @"does not support case-sensitive non-ASCII characters");
+}
+
+
+- (void)testMatchesLikePredicate
+{
+    NSArray *patterns = @[ @"", @"*", @"?", @"abc", @"a*", @"*c", @"a?c", @"a*c", @"*b*", @"a**c", @"?*?", @"*a*b*c*", @"A?C", @"é*", @"*.json" ];
+    NSArray *strings = @[ @"", @"a", @"c", @"ab", @"abc", @"ABC", @"aBc", @"abcabc", @"acbc", @"aXbYc", @"ca", @"é", @"éclair", @"file.json",
+                          @"file.JSON", @"aac" ];
+
+    for (NSNumber *caseSensitive in @[ @YES, @NO ]) {
+        for (NSString *pattern in patterns) {
+            TWTWildcardPatternMatcher *matcher = [[TWTWildcardPatternMatcher alloc] initWithPattern:pattern caseSensitive:caseSensitive.boolValue];
+            if (!matcher) {
+                continue;
+            }
+
+            NSPredicate *predicate = [self predicateWithPattern:pattern caseSensitive:caseSensitive.boolValue];
+            for (NSString *string in strings) {
+                TWTWildcardPatternMatchResult result = [matcher resultOfMatchingString:string];
+                XCTAssertNotEqual(result, TWTWildcardPatternMatchResultUndecided, @"%@ is undecided for %@", pattern, string);
+                XCTAssertEqual(result == TWTWildcardPatternMatchResultMatch, [predicate evaluateWithObject:string],
+                               @"%@ (case-sensitive: %@) does not match %@ like a predicate", pattern, caseSensitive, string);
+            }
+        }
+    }
+}
+
+
+- (void)testUndecidedCharacters
+{
+    TWTWildcardPatternMatcher *matcher = [[TWTWildcardPatternMatcher alloc] initWithPattern:@"a?c" caseSensitive:YES];
+    XCTAssertEqual([matcher resultOfMatchingString:@"a\nc"], TWTWildcardPatternMatchResultUndecided);
+    XCTAssertEqual([matcher resultOfMatchingString:@"a😀c"], TWTWildcardPatternMatchResultUndecided);
+
+    matcher = [[TWTWildcardPatternMatcher alloc] initWithPattern:@"a*" caseSensitive:YES];
+    XCTAssertEqual([matcher resultOfMatchingString:@"ab\r\n"], TWTWildcardPatternMatchResultUndecided);
+    XCTAssertEqual([matcher resultOfMatchingString:@"b\n"], TWTWildcardPatternMatchResultNoMatch);
+
+    matcher = [[TWTWildcardPatternMatcher alloc] initWithPattern:@"stra*e" caseSensitive:NO];
+    XCTAssertEqual([matcher resultOfMatchingString:@"STRASSE"], TWTWildcardPatternMatchResultMatch);
+    XCTAssertEqual([matcher resultOfMatchingString:@"ſtrasse"], TWTWildcardPatternMatchResultUndecided);
+
+    // Undecided strings are matched with a predicate by the validator
+    for (NSString *pattern in @[ @"a?c", @"a*" ]) {
+        TWTWildcardPatternStringValidator *validator = [TWTStringValidator stringValidatorWithPattern:pattern caseSensitive:YES];
+        NSPredicate *predicate = [self predicateWithPattern:pattern caseSensitive:YES];
+        for (NSString *string in @[ @"a\nc", @"a😀c", @"ab\r\n" ]) {
+            XCTAssertEqual([validator validateValue:string error:NULL], [predicate evaluateWithObject:string], @"%@ does not match %@ like a predicate", pattern, string);
+        }
+    }
+}
+
+
+- (void)testPathologicalPatterns
+{
+    // These take time exponential in the number of *s with a matcher that backtracks to every *
+    NSString *string = [@"" stringByPaddingToLength:10000 withString:@"a" startingAtIndex:0];
+    TWTWildcardPatternMatcher *matcher = [[TWTWildcardPatternMatcher alloc] initWithPattern:@"*a*a*a*a*a*a*a*a*b" caseSensitive:YES];
+    XCTAssertEqual([matcher resultOfMatchingString:string], TWTWildcardPatternMatchResultNoMatch);
+
+    matcher = [[TWTWildcardPatternMatcher alloc] initWithPattern:@"*a*a*a*a*a*a*a*a*" caseSensitive:NO];
+    XCTAssertEqual([matcher resultOfMatchingString:string], TWTWildcardPatternMatchResultMatch);
+}
+
+
+- (void)testMatcherPerformance
+{
+    NSArray *strings = [self benchmarkStrings];
+    TWTWildcardPatternMatcher *matcher = [[TWTWildcardPatternMatcher alloc] initWithPattern:@"user-*@*.EXAMPLE.com" caseSensitive:NO];
+
+    [self measureBlock:^{
+        for (NSString *string in strings) {
+            XCTAssertEqual([matcher resultOfMatchingString:string], TWTWildcardPatternMatchResultMatch);
+        }
+    }];
+}
+
+
+- (void)testPredicatePerformance
+{
+    NSArray *strings = [self benchmarkStrings];
+    NSPredicate *predicate = [self predicateWithPattern:@"user-*@*.EXAMPLE.com" caseSensitive:NO];
+
+    [self measureBlock:^{
+        for (NSString *string in strings) {
+            XCTAssertTrue([predicate evaluateWithObject:string]);
+        }
+    }];
+}
+
+@end